@@ -0,0 +1,112 @@
+#ifndef __EXTRACTIONBENCHMARK_H__
+#define __EXTRACTIONBENCHMARK_H__
+
+#include <OverhangTerrainPrerequisites.h>
+#include <OverhangTerrainOptions.h>
+#include <IsoSurfaceSharedTypes.h>
+#include <IsoSurfaceBuilderPool.h>
+
+#include <ostream>
+#include <vector>
+
+using namespace Ogre;
+
+/** Measures surface extraction headless, without a render system or GPU
+@remarks Loads a cube region from each terrain capture, or fills one from each kind of synthetic voxel field when nothing was
+	captured, and builds every level of detail and every stitch configuration of it on a fresh hardware shadow, so every build 
+	extracts from scratch.  A capture is a raw dump of the voxel values of a single cube region of the terrain channel, one signed
+	byte per grid-point in grid-point index order, as the example writes them when F5 is pressed.  Every level of detail of the same cube region
+	is also built with Surface Nets instead of Transvoxel to compare both engines, and its voxel values are run-length
+	encoded and decoded to measure the compression on the release path of leases.  The measurements of the isosurface 
+	builder pool are reported for each configuration as JSON. */
+class ExtractionBenchmark
+{
+public:
+	/// The kinds of voxel fields the cube region is filled from
+	enum Field
+	{
+		/// Rolling terrain sampled from a meta height-map
+		Field_HeightMap = 0,
+		/// Overlapping solid meta-balls floating in open space
+		Field_MetaBalls,
+		/// Uniformly random voxels, the worst case with a surface crossing nearly every cell
+		Field_Random,
+
+		CountFields
+	};
+
+	/**
+	@param options Top-level options, the tile size determines the dimensions of the cube region
+	@param nIterations Number of times each configuration is built
+	@param nWorkers Greatest number of threads that build concurrently when measuring scaling across threads
+	@param vCaptures Paths of terrain captures to measure instead of the synthetic fields, captured with the same tile size
+	*/
+	ExtractionBenchmark(const OverhangTerrainOptions & options, const size_t nIterations, const size_t nWorkers, const std::vector< String > & vCaptures);
+	~ExtractionBenchmark();
+
+	/** Builds every configuration of every field and writes the measurements
+	@param os Receives a single JSON object, times are in microseconds */
+	void run (std::ostream & os);
+
+private:
+	/// Options that the factory was created with
+	OverhangTerrainOptions _options;
+	/// Number of times each configuration is built
+	const size_t _nIterations;
+	/// Number of levels of detail built of each field
+	const unsigned _nLODCount;
+	/// Greatest number of threads that build concurrently
+	const size_t _nWorkers;
+	/// Creates the voxel regions, builders and vertex layout
+	MetaBaseFactory * _pFactory;
+	/// Creates builders that extract every level of detail with Surface Nets
+	MetaBaseFactory * _pNetsFactory;
+
+	/// Creates a meta-fragment centred on the origin whose cube region is loaded from the capture or filled from the field of the source
+	MetaFragment::Container * createFragment (const Channel::Ident channel, const Source & source) const;
+
+	/// A cube region to measure, either captured from a running scene or filled from a synthetic field
+	struct Source
+	{
+		/// Name of the source in the output, the path of a capture or the name of a field
+		String name;
+		/// The voxel values of a captured region in grid-point index order, empty for a synthetic field
+		std::vector< FieldStrength > values;
+		/// The field the region is filled from unless it was captured
+		Field field;
+	};
+
+	/// The cube regions measured, the captures if any and otherwise every synthetic field
+	std::vector< Source > _vSources;
+
+	/** Reads a capture of the voxel values of a single cube region
+	@param sPath Path of the raw dump, it must contain exactly one value per grid-point of a cube region
+	@param source (out) Receives the capture */
+	void loadCapture (const String & sPath, Source & source) const;
+
+	/** Builds one configuration of a meta-fragment and writes the measurements accumulated over all iterations
+	@param os Receives a single JSON object
+	@param pPool The builders to build with
+	@param pMF The meta-fragment to build
+	@param channel The channel of the meta-fragment
+	@param nLOD The level of detail to build
+	@param enStitches The sides with transition cells */
+	void measure (std::ostream & os, IsoSurfaceBuilderPool * pPool, const MetaFragment::Container * pMF, const Channel::Ident channel, const unsigned nLOD, const Touch3DFlags enStitches);
+
+	/** Run-length encodes and decodes the voxel values of a meta-fragment and writes the sizes and rates over all iterations
+	@param os Receives a single JSON object, rates are in megabytes per second of decompressed data
+	@param pMF The meta-fragment whose voxel values are compressed */
+	void measureRLE (std::ostream & os, const MetaFragment::Container * pMF);
+
+	/** Builds every level of detail of a source on several threads at once and writes the measurements of a pool of as many builders
+	@remarks Each thread builds its own meta-fragment so that the threads never contend for the same voxel region
+	@param os Receives a single JSON object
+	@param source The source that the meta-fragments are loaded or filled from
+	@param nWorkers Number of threads and builders */
+	void measureWorkers (std::ostream & os, const Source & source, const size_t nWorkers);
+
+	/// Names of the fields in the output
+	static const char * FieldNames[CountFields];
+};
+
+#endif
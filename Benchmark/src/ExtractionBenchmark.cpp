@@ -0,0 +1,341 @@
+#include "ExtractionBenchmark.h"
+
+#include <OverhangTerrainPageInitParams.h>
+#include <MetaFactory.h>
+#include <MetaWorldFragment.h>
+#include <MetaHeightmap.h>
+#include <MetaBall.h>
+#include <CubeDataRegion.h>
+#include <CubeDataRegionDescriptor.h>
+#include <HardwareIsoVertexShadow.h>
+#include <IsoSurfaceBuilder.h>
+#include <IsoSurfaceBuilderPool.h>
+#include <RLE.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/thread.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+	/// Copies the options extracting every level of detail of the channel with Surface Nets
+	OverhangTerrainOptions withSurfaceNets (const OverhangTerrainOptions & options, const Channel::Ident channel)
+	{
+		OverhangTerrainOptions nets (options);
+
+		nets.channels[channel].surfaceNetsLODBegin = 0;
+		nets.channels[channel].surfaceNetsLODEnd = static_cast< unsigned short > (options.channels[channel].maxGeoMipMapLevel);
+		return nets;
+	}
+
+	/// Writes a JSON string, the paths of captures may contain backslashes
+	void writeString (std::ostream & os, const String & s)
+	{
+		os << '"';
+		for (String::const_iterator i = s.begin(); i != s.end(); ++i)
+		{
+			if (*i == '"' || *i == '\\')
+				os << '\\';
+			os << *i;
+		}
+		os << '"';
+	}
+}
+
+const char * ExtractionBenchmark::FieldNames[CountFields] =
+{
+	"heightMap",
+	"metaBalls",
+	"random"
+};
+
+ExtractionBenchmark::ExtractionBenchmark( const OverhangTerrainOptions & options, const size_t nIterations, const size_t nWorkers, const std::vector< String > & vCaptures )
+	:	_options(options),
+		_nIterations(nIterations),
+		_nLODCount(static_cast< unsigned > (options.channels[TERRAIN_ENTITY_CHANNEL].maxGeoMipMapLevel)),
+		_nWorkers(nWorkers),
+		_pFactory(new MetaBaseFactory(NULL, options, NULL)),
+		_pNetsFactory(new MetaBaseFactory(NULL, withSurfaceNets(options, TERRAIN_ENTITY_CHANNEL), NULL))
+{
+	// Terrain captured from a running scene is representative of what is extracted, the synthetic fields only stand in for it
+	_vSources.resize(vCaptures.empty() ? CountFields : vCaptures.size());
+	for (size_t s = 0; s < _vSources.size(); ++s)
+	{
+		Source & source = _vSources[s];
+
+		if (vCaptures.empty())
+		{
+			source.field = static_cast< Field > (s);
+			source.name = FieldNames[s];
+		} else
+			loadCapture(vCaptures[s], source);
+	}
+}
+
+void ExtractionBenchmark::loadCapture( const String & sPath, Source & source ) const
+{
+	const size_t nCount = _pFactory->getCubeDataRegionDescriptor()->gpcount;
+	std::ifstream file (sPath.c_str(), std::ios::binary);
+
+	if (!file)
+		OGRE_EXCEPT(Exception::ERR_FILE_NOT_FOUND, "Cannot open terrain capture " + sPath, __FUNCTION__);
+
+	const std::vector< char > vBytes = std::vector< char > (std::istreambuf_iterator< char > (file), std::istreambuf_iterator< char > ());
+
+	// Captures do not record their size, a capture of a different tile size is rejected rather than misread
+	if (vBytes.size() != nCount * sizeof(FieldStrength))
+		OGRE_EXCEPT(Exception::ERR_INVALIDPARAMS, "Terrain capture " + sPath + " does not match the tile size", __FUNCTION__);
+
+	source.name = sPath;
+	source.field = Field_HeightMap;
+	source.values.resize(nCount);
+	memcpy(&source.values[0], &vBytes[0], vBytes.size());
+}
+
+ExtractionBenchmark::~ExtractionBenchmark()
+{
+	delete _pNetsFactory;
+	delete _pFactory;
+}
+
+MetaFragment::Container * ExtractionBenchmark::createFragment( const Channel::Ident channel, const Source & source ) const
+{
+	const Voxel::CubeDataRegionDescriptor & cubemeta = *_pFactory->getCubeDataRegionDescriptor();
+	const Real fExtent = Real(cubemeta.dimensions) * cubemeta.scale;
+
+	MetaFragment::Container * pMF = _pFactory->getVoxelFactory(channel) ->createMetaFragment(
+		NULL,
+		AxisAlignedBox(Vector3(-fExtent / 2), Vector3(fExtent / 2))
+	);
+	Voxel::CubeDataRegion * pBlock = pMF->acquire< MetaFragment::Interfaces::Basic >().block;
+	Voxel::DataAccessor data = pBlock->lease();
+
+	data.reset();
+	if (!source.values.empty())
+	{
+		memcpy(data.values, &source.values[0], source.values.size() * sizeof(FieldStrength));
+		data.touch(Voxel::DataBase::DBC_Values);
+	}
+	else switch (source.field)
+	{
+	case Field_HeightMap:
+		{
+			// Hills and valleys spanning the middle half of the cube vertically, one height per column of grid points
+			const size_t nSide = cubemeta.dimensions + 1;
+			std::vector< Real > vHeights (nSide * nSide);
+			MetaHeightMap heightmap;
+
+			for (size_t z = 0; z < nSide; ++z)
+				for (size_t x = 0; x < nSide; ++x)
+					vHeights[z * nSide + x] =
+						fExtent / 4 *
+						Math::Sin(Radian(Math::TWO_PI * 2 * Real(x) / Real(nSide))) *
+						Math::Cos(Radian(Math::TWO_PI * 3 * Real(z) / Real(nSide)));
+
+			heightmap.load(&vHeights[0], nSide, nSide, cubemeta.scale, 1);
+			heightmap.updateDataGrid(pBlock, &data);
+		}
+		break;
+
+	case Field_MetaBalls:
+		{
+			MetaBall balls[] =
+			{
+				MetaBall(Vector3::ZERO, fExtent * 0.35f, false),
+				MetaBall(Vector3(0.25f, 0.1f, -0.15f) * fExtent, fExtent * 0.2f, false),
+				MetaBall(Vector3(-0.2f, -0.2f, 0.25f) * fExtent, fExtent * 0.25f, false)
+			};
+
+			for (size_t c = 0; c < sizeof(balls) / sizeof(*balls); ++c)
+				balls[c].updateDataGrid(pBlock, &data);
+		}
+		break;
+
+	case Field_Random:
+		{
+			// A fixed linear congruential sequence so that every run measures the same voxels
+			uint32 nSeed = 0x2545F491;
+
+			for (size_t i = 0; i < data.count; ++i)
+			{
+				nSeed = nSeed * 1664525 + 1013904223;
+				data.values[i] = Voxel::FieldStrength(signed int((nSeed >> 16) % 255) - 127);
+			}
+			data.touch(Voxel::DataBase::DBC_Values);
+		}
+		break;
+	}
+
+	if (pBlock->hasGradient())
+		data.updateGradient();
+
+	return pMF;
+}
+
+void ExtractionBenchmark::measure( std::ostream & os, IsoSurfaceBuilderPool * pPool, const MetaFragment::Container * pMF, const Channel::Ident channel, const unsigned nLOD, const Touch3DFlags enStitches )
+{
+	const Voxel::CubeDataRegionDescriptor & cubemeta = *_pFactory->getCubeDataRegionDescriptor();
+
+	pPool->resetStatistics();
+	for (size_t i = 0; i < _nIterations; ++i)
+	{
+		// Nothing is shadowed yet so every iteration extracts the surface from scratch, the shadow is created before the builder is leased
+		SharedPtr< HardwareShadow::HardwareIsoVertexShadow > pShadow (new HardwareShadow::HardwareIsoVertexShadow(_nLODCount));
+
+		// Room for an iso-vertex on every edge of the cube so the vertex buffer is never reset
+		pPool->lease()->queueBuild(pMF, pShadow, channel, nLOD, pMF->factory->surfaceFlags, enStitches, cubemeta.gpcount * 3);
+	}
+
+	os << "{\"lod\":" << nLOD << ",\"stitches\":" << unsigned(enStitches) << ",\"sides\":\"" << Touch3DFlagNames[enStitches] << "\",\"statistics\":";
+	pPool->getStatistics().writeJSON(os);
+	os << '}';
+}
+
+void ExtractionBenchmark::measureRLE( std::ostream & os, const MetaFragment::Container * pMF )
+{
+	using namespace boost::posix_time;
+
+	const Voxel::CubeDataRegion * pBlock = pMF->acquire< MetaFragment::Interfaces::const_Basic >().block;
+	std::vector< unsigned char > vValues, vDecompressed;
+	RLE::Channel channel;
+	uint64 nCompressTime = 0, nDecompressTime = 0;
+
+	{
+		const Voxel::const_DataAccessor data = pBlock->lease();
+		const unsigned char * pcValues = reinterpret_cast< const unsigned char * > (data.values);
+
+		vValues.assign(pcValues, pcValues + data.count * sizeof(*data.values));
+	}
+	vDecompressed.resize(vValues.size());
+
+	for (size_t i = 0; i < _nIterations; ++i)
+	{
+		const ptime tmStart = microsec_clock::universal_time();
+
+		channel.compress(vValues.size(), &vValues[0]);
+
+		const ptime tmCompressed = microsec_clock::universal_time();
+
+		channel.decompress(vDecompressed.size(), &vDecompressed[0]);
+		nCompressTime += (tmCompressed - tmStart).total_microseconds();
+		nDecompressTime += (microsec_clock::universal_time() - tmCompressed).total_microseconds();
+	}
+
+	// Bytes per microsecond are megabytes per second
+	const Real fTotal = Real(vValues.size() * _nIterations);
+
+	os 
+		<< "{\"bytes\":" << vValues.size()
+		<< ",\"compressed\":" << channel.getCompressedSize()
+		<< ",\"identical\":" << (vDecompressed == vValues ? "true" : "false")
+		<< ",\"compressTime\":" << nCompressTime
+		<< ",\"decompressTime\":" << nDecompressTime
+		<< ",\"compressMBPerSecond\":" << (nCompressTime > 0 ? fTotal / Real(nCompressTime) : 0)
+		<< ",\"decompressMBPerSecond\":" << (nDecompressTime > 0 ? fTotal / Real(nDecompressTime) : 0)
+		<< '}';
+}
+
+void ExtractionBenchmark::measureWorkers( std::ostream & os, const Source & source, const size_t nWorkers )
+{
+	const Voxel::CubeDataRegionDescriptor & cubemeta = *_pFactory->getCubeDataRegionDescriptor();
+	IsoSurfaceBuilderPool pool (cubemeta, _options, nWorkers);
+	std::vector< MetaFragment::Container * > vpMF;
+	boost::thread_group threads;
+
+	for (size_t w = 0; w < nWorkers; ++w)
+		vpMF.push_back(createFragment(TERRAIN_ENTITY_CHANNEL, source));
+
+	pool.resetStatistics();
+	for (size_t w = 0; w < nWorkers; ++w)
+	{
+		const MetaFragment::Container * pMF = vpMF[w];
+		const size_t nIterations = _nIterations;
+		const unsigned nLODCount = _nLODCount;
+
+		threads.create_thread(
+			[&pool, &cubemeta, pMF, nIterations, nLODCount] ()
+			{
+				for (size_t i = 0; i < nIterations; ++i)
+					for (unsigned nLOD = 0; nLOD < nLODCount; ++nLOD)
+					{
+						SharedPtr< HardwareShadow::HardwareIsoVertexShadow > pShadow (new HardwareShadow::HardwareIsoVertexShadow(nLODCount));
+
+						pool.lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, nLOD, pMF->factory->surfaceFlags, T3DS_None, cubemeta.gpcount * 3);
+					}
+			}
+		);
+	}
+	threads.join_all();
+
+	os << "{\"workers\":" << nWorkers << ",\"statistics\":";
+	pool.getStatistics().writeJSON(os);
+	os << '}';
+
+	for (std::vector< MetaFragment::Container * >::iterator i = vpMF.begin(); i != vpMF.end(); ++i)
+		delete *i;
+}
+
+void ExtractionBenchmark::run( std::ostream & os )
+{
+	os
+		<< "{\"tileSize\":" << _options.tileSize
+		<< ",\"lods\":" << _nLODCount
+		<< ",\"iterations\":" << _nIterations
+		<< ",\"extractionSlabs\":" << _options.extractionSlabs
+		<< ",\"fields\":[";
+
+	for (size_t s = 0; s < _vSources.size(); ++s)
+	{
+		const Source & source = _vSources[s];
+		MetaFragment::Container * pMF = createFragment(TERRAIN_ENTITY_CHANNEL, source);
+		IsoSurfaceBuilderPool * pPool = _pFactory->getIsoSurfaceBuilderPool();
+
+		if (s > 0)
+			os << ',';
+		os << "{\"field\":";
+		writeString(os, source.name);
+		os << ",\"captured\":" << (source.values.empty() ? "false" : "true") << ",\"configurations\":[";
+
+		// The finest level of detail has no finer neighbours to stitch with
+		measure(os, pPool, pMF, TERRAIN_ENTITY_CHANNEL, 0, T3DS_None);
+		for (unsigned nLOD = 1; nLOD < _nLODCount; ++nLOD)
+			for (unsigned s = 0; s < CountTouch3DSides; ++s)
+			{
+				os << ',';
+				measure(os, pPool, pMF, TERRAIN_ENTITY_CHANNEL, nLOD, static_cast< Touch3DFlags > (s));
+			}
+
+		// Both engines are compared without stitching so that only the extraction of the cells differs
+		os << "],\"engines\":[";
+		for (unsigned nLOD = 0; nLOD < _nLODCount; ++nLOD)
+		{
+			if (nLOD > 0)
+				os << ',';
+			os << "{\"lod\":" << nLOD << ",\"transvoxel\":";
+			measure(os, pPool, pMF, TERRAIN_ENTITY_CHANNEL, nLOD, T3DS_None);
+			os << ",\"surfaceNets\":";
+			measure(os, _pNetsFactory->getIsoSurfaceBuilderPool(), pMF, TERRAIN_ENTITY_CHANNEL, nLOD, T3DS_None);
+			os << '}';
+		}
+
+		os << "],\"rle\":";
+		measureRLE(os, pMF);
+		os << '}';
+		delete pMF;
+	}
+
+	// Throughput of the first capture or else of the rolling terrain from one thread up to the greatest number of threads
+	os << "],\"scaling\":[";
+	for (size_t nWorkers = 1; nWorkers <= _nWorkers; ++nWorkers)
+	{
+		if (nWorkers > 1)
+			os << ',';
+		measureWorkers(os, _vSources.front(), nWorkers);
+	}
+
+	os << "]}" << std::endl;
+}
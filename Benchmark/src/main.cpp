@@ -0,0 +1,85 @@
+#include <Ogre.h>
+#include <OgreDefaultHardwareBufferManager.h>
+
+#include <OverhangTerrainPageInitParams.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include "ExtractionBenchmark.h"
+
+using namespace Ogre;
+
+int main (int argc, char * argv[])
+{
+	size_t nIterations = 5, nTileSize = 33, nSlabs = 1, nWorkers = std::max(size_t(boost::thread::hardware_concurrency()), size_t(1));
+	const char * szOutput = NULL;
+	std::vector< String > vCaptures;
+
+	for (int c = 1; c + 1 < argc; c += 2)
+	{
+		if (strcmp(argv[c], "-iterations") == 0)
+			nIterations = strtoul(argv[c + 1], NULL, 10);
+		else if (strcmp(argv[c], "-tile") == 0)
+			nTileSize = strtoul(argv[c + 1], NULL, 10);
+		else if (strcmp(argv[c], "-slabs") == 0)
+			nSlabs = strtoul(argv[c + 1], NULL, 10);
+		else if (strcmp(argv[c], "-workers") == 0)
+			nWorkers = strtoul(argv[c + 1], NULL, 10);
+		else if (strcmp(argv[c], "-out") == 0)
+			szOutput = argv[c + 1];
+		else if (strcmp(argv[c], "-capture") == 0)
+			vCaptures.push_back(argv[c + 1]);
+		else
+		{
+			std::cerr << "Usage: Benchmark [-iterations N] [-tile 2^n+1] [-slabs N] [-workers N] [-out file.json] [-capture file.raw]..." << std::endl;
+			return 1;
+		}
+	}
+
+	// Nothing here renders, the root provides logging and the default work queue, vertex declarations come from a software buffer manager
+	Root * pRoot = new Root(StringUtil::BLANK, StringUtil::BLANK, "Benchmark.log");
+	DefaultHardwareBufferManager * pBufMan = OGRE_NEW DefaultHardwareBufferManager();
+	int nResult = 0;
+
+	try
+	{
+		OverhangTerrainOptions options;
+		size_t nCoarsest = 0;
+
+		// Every level of detail down to a single cell
+		while ((size_t(1) << nCoarsest) < nTileSize - 1)
+			++nCoarsest;
+
+		options.pageSize = nTileSize;
+		options.tileSize = nTileSize;
+		options.extractionSlabs = nSlabs;
+		options.channels[TERRAIN_ENTITY_CHANNEL].maxGeoMipMapLevel = nCoarsest + 1;
+		// Triangle lists are reordered for the post-transform vertex cache so that the statistics report the ACMR before and after
+		options.channels[TERRAIN_ENTITY_CHANNEL].optimizeVertexCache = true;
+
+		ExtractionBenchmark benchmark (options, nIterations, nWorkers, vCaptures);
+
+		if (szOutput != NULL)
+		{
+			std::ofstream file (szOutput);
+			benchmark.run(file);
+		} else
+			benchmark.run(std::cout);
+	}
+	catch (const std::exception & e)
+	{
+		std::cerr << "Benchmark failed: " << e.what() << std::endl;
+		nResult = 1;
+	}
+
+	OGRE_DELETE pBufMan;
+	delete pRoot;
+	return nResult;
+}
@@ -14,6 +14,7 @@ public:
 		RenderWindow * pRendWind, 
 		Camera * pCam, 
 		OverhangTerrainSceneManager * pScMgr, 
+		OverhangTerrainGroup * pGroup,
 		bool bBufferedKeys = false, 
 		bool bBufferedMouse = false, 
 		bool bBufferedJoy = false 
@@ -27,10 +28,15 @@ protected:
 
 private:
 	Real _nTimeTracker;
+	/// Number of terrain captures written so far, names the next one
+	unsigned _nCaptures;
 	OverhangTerrainSceneManager * _pScMgr;
+	OverhangTerrainGroup * _pGroup;
 
 	void shootMetaball(const Ray & ray, const bool bExcavating = true);
 	void placeMetaball(const bool bExcavating = true);
+	void reportBuilderStatistics();
+	void captureTerrain();
 
 	class DiggerRSQL : public RaySceneQueryListener
 	{
@@ -1,17 +1,24 @@
 #include "ExampleController.h"
 
 #include <OverhangTerrainSceneManager.h>
+#include <OverhangTerrainGroup.h>
+#include <MetaWorldFragment.h>
+#include <CubeDataRegion.h>
 #include <stdlib.h>
 
+#include <fstream>
+#include <vector>
+
 ExampleController::ExampleController( 
 	RenderWindow * pRendWind, 
 	Camera * pCam, 
 	OverhangTerrainSceneManager * pScMgr, 
+	OverhangTerrainGroup * pGroup,
 	bool bBufferedKeys /*= false*/, 
 	bool bBufferedMouse /*= false*/, 
 	bool bBufferedJoy /*= false */ 
 ) : ExampleFrameListener(pRendWind, pCam, bBufferedKeys, bBufferedMouse, bBufferedJoy), 
-	_digger(pScMgr, true), _builder(pScMgr, false), _nTimeTracker(0), _pScMgr(pScMgr)
+	_digger(pScMgr, true), _builder(pScMgr, false), _nTimeTracker(0), _nCaptures(0), _pScMgr(pScMgr), _pGroup(pGroup)
 {
 	showDebugOverlay(false);
 }
@@ -51,9 +58,64 @@ bool ExampleController::processUnbufferedKeyInput( const FrameEvent& evt )
 		_nTimeTracker = 0.0f;
 	}
 
+	if (mKeyboard->isKeyDown(OIS::KC_F4) && _nTimeTracker > 0.25f)
+	{
+		reportBuilderStatistics();
+		_nTimeTracker = 0.0f;
+	}
+
+	if (mKeyboard->isKeyDown(OIS::KC_F5) && _nTimeTracker > 0.25f)
+	{
+		captureTerrain();
+		_nTimeTracker = 0.0f;
+	}
+
 	return ExampleFrameListener::processUnbufferedKeyInput(evt);
 }
 
+void ExampleController::reportBuilderStatistics()
+{
+	const IsoSurfaceBuilderPool::Statistics stats = _pGroup->getBuilderStatistics();
+	std::strstream ss;
+
+	ss 
+		<< "Surface builds: " << stats.builds
+		<< ", replays " << stats.replays
+		<< ", throughput " << stats.getThroughput() << " builds/s"
+		<< ", latency " << stats.getLatency() << "us"
+		<< ", concurrency " << stats.getConcurrency() << " (peak " << stats.peak << " of " << stats.capacity << " builders)"
+		<< std::endl << std::ends;
+	OutputDebugStringA(ss.str());
+
+	_pGroup->resetBuilderStatistics();
+}
+
+void ExampleController::captureTerrain()
+{
+	// The cube region of the terrain in the crosshairs is dumped raw for the benchmark to extract ("-capture capture-N.raw")
+	const OverhangTerrainManager::RayResult result = _pGroup->rayIntersects(
+		Ray(mCamera->getPosition(), mCamera->getDirection()), 
+		OverhangTerrainManager::RayQueryParams::from(100000, TERRAIN_ENTITY_CHANNEL, Channel::Ident_INVALID)
+	);
+
+	if (!result.hit || result.mwf == NULL)
+		return;
+
+	auto fragment = static_cast< const MetaFragment::Container * > (result.mwf) ->acquire< MetaFragment::Interfaces::const_Basic > ();
+	const DimensionType d = fragment.block->meta.dimensions;
+	std::vector< FieldStrength > vValues (fragment.block->meta.gpcount);
+	std::strstream ssName, ss;
+
+	fragment.block->extractValues(0, 0, 0, d, d, d, &vValues[0]);
+
+	ssName << "capture-" << _nCaptures++ << ".raw" << std::ends;
+	std::ofstream file (ssName.str(), std::ios::binary);
+	file.write(reinterpret_cast< const char * > (&vValues[0]), vValues.size() * sizeof(FieldStrength));
+
+	ss << "Captured terrain to " << ssName.str() << std::endl << std::ends;
+	OutputDebugStringA(ss.str());
+}
+
 void ExampleController::shootMetaball( const Ray & ray, const bool bExcavating /*= true*/ )
 {
 	// zAxis because by default the camera's direction is 
@@ -38,6 +38,20 @@ int WINAPI WinMain ( HINSTANCE hInst, HINSTANCE, LPSTR szCmdLine, int)
 	pRoot->loadPlugin(PLUGIN("RenderSystem_Direct3D9"));
 	pRoot->addResourceLocation("paging", "FileSystem", "Paging");
 
+	// Optionally store vertices in the compact format ("-compact"), the material decoding them is a Cg vertex program
+	const bool bCompact = strstr(szCmdLine, "-compact") != NULL;
+	if (bCompact)
+	{
+		pRoot->loadPlugin(PLUGIN("Plugin_CgProgramManager"));
+		pRoot->addResourceLocation("media/OhTSM", "FileSystem");
+	}
+
+	// Optionally override the number of background workers (e.g. "-workers 4") to measure surface extraction throughput scaling
+	const char * szWorkers = strstr(szCmdLine, "-workers ");
+	DefaultWorkQueueBase * pWorkQueue = dynamic_cast< DefaultWorkQueueBase * > (pRoot->getWorkQueue());
+	if (szWorkers != NULL && pWorkQueue != NULL)
+		pWorkQueue->setWorkerThreadCount(std::max(1, atoi(szWorkers + strlen("-workers "))));
+
 	if (pRoot->showConfigDialog())
 	{
 		OverhangTerrainSceneManager * pScMgr = OGRE_NEW OverhangTerrainSceneManager("Default");
@@ -51,13 +65,19 @@ int WINAPI WinMain ( HINSTANCE hInst, HINSTANCE, LPSTR szCmdLine, int)
 		pSun->setDirection(Vector3(0.4f, 1.0f, 0.3f).normalisedCopy());
 		pSun->setType(Light::LT_DIRECTIONAL);
 
-		MaterialPtr pMat = MaterialManager::getSingleton().create("BaseMaterial", ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
-		Pass * pPass = pMat->getTechnique(0) ->getPass(0);
-		pPass->setLightingEnabled(true);
-		pPass->setDiffuse(0.1f, 0.5f, 1.0f, 1.0f);
-		pPass->setAmbient(0.05f, 0.1f, 0.2f);
-		pPass->setSpecular(1.0f, 1.0f, 1.0f, 1.0f);
-		pPass->setShininess(80);
+		MaterialPtr pMat;
+		if (bCompact)
+			pMat = MaterialManager::getSingleton().getByName("OhTSM/CompactVertex");
+		else
+		{
+			pMat = MaterialManager::getSingleton().create("BaseMaterial", ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+			Pass * pPass = pMat->getTechnique(0) ->getPass(0);
+			pPass->setLightingEnabled(true);
+			pPass->setDiffuse(0.1f, 0.5f, 1.0f, 1.0f);
+			pPass->setAmbient(0.05f, 0.1f, 0.2f);
+			pPass->setSpecular(1.0f, 1.0f, 1.0f, 1.0f);
+			pPass->setShininess(80);
+		}
 
 		Camera * pCam = pScMgr->createCamera("Photographer");
 		pCam->setNearClipDistance(0.1f);
@@ -86,6 +106,7 @@ int WINAPI WinMain ( HINSTANCE hInst, HINSTANCE, LPSTR szCmdLine, int)
 		options.channels[TERRAIN_ENTITY_CHANNEL].maxGeoMipMapLevel = 6;
 		options.channels[TERRAIN_ENTITY_CHANNEL].maxPixelError = 10;
 		options.channels[TERRAIN_ENTITY_CHANNEL].qid = RENDER_QUEUE_1;
+		options.channels[TERRAIN_ENTITY_CHANNEL].compactVertices = bCompact;
 
 		pScMgr->setOptions(options);
 
@@ -100,7 +121,7 @@ int WINAPI WinMain ( HINSTANCE hInst, HINSTANCE, LPSTR szCmdLine, int)
 
 		ExamplePageProvider pp(pOhPgSect, pGrp->getResourceGroupName());
 		pGrp->setPageProvider(&pp);
-		ExampleController * pController = new ExampleController (pRendWindow, pCam, pScMgr);
+		ExampleController * pController = new ExampleController (pRendWindow, pCam, pScMgr, pGrp);
 		pRoot->addFrameListener(pController);
 	
 		pRoot->startRendering();
@@ -0,0 +1,167 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#ifndef __OHTBUILDCACHE_H__
+#define __OHTBUILDCACHE_H__
+
+#include "OverhangTerrainPrerequisites.h"
+#include "IsoSurfaceSharedTypes.h"
+#include "Neighbor.h"
+#include "Util.h"
+
+#include <vector>
+#include <list>
+#include <map>
+
+#include <OgreSharedPtr.h>
+#include <OgreStreamSerialiser.h>
+
+#include <boost/thread.hpp>
+
+namespace Ogre
+{
+	/** Bounded least-recently-used cache of finished surface builds keyed by the voxel content they were extracted from
+	@remarks Edits that cancel out, reloading pages and switching back and forth between levels of detail extract voxel content 
+		that was meshed before.  Each configuration of a batch whose triangles only reference vertices staged by that batch yields 
+		a self-contained payload, the vertices and indices staged in the layout of the hardware buffers together with the shadow meta 
+		data of the resolution, which is appended to the hardware buffers the next time the same content is built in the same configuration.  The cache is shared by 
+		all builders of a pool and is thread-safe. */
+	class _OverhangTerrainPluginExport BuildCache
+	{
+	public:
+		/// Identifies the result of a build
+		class Key
+		{
+		public:
+			/// Hash of the compressed voxel channels
+			unsigned long long content;
+			/// Ordinal of the channel the surface belongs to
+			uint16 channel;
+			/// Hash of the voxels of the neighbouring regions sampled beyond the sides of the cube, zero if none were sampled
+			unsigned long long halo;
+			/// The level of detail and the sides of the surface with transition cells respectively
+			unsigned lod;
+			Touch3DFlags stitches;
+			/// Flags determining what kind of vertex properties are generated
+			size_t surfaceFlags;
+			/// Size in bytes of a single vertex and a single index in the hardware buffers respectively
+			size_t vertexSize, indexSize;
+			/// Scale of vertex positions
+			Real scale;
+
+			bool operator < (const Key & other) const;
+
+			/// Serializes the key to the stream
+			StreamSerialiser & operator >> (StreamSerialiser & output) const;
+			/// Deserializes the key from the stream
+			StreamSerialiser & operator << (StreamSerialiser & input);
+		};
+
+		/// A finished build staged in the layout of the hardware buffers along with the shadow meta data of its resolution
+		class Entry
+		{
+		public:
+			/// Staged vertices and indices, the indices number the vertices of the entry from zero
+			std::vector< unsigned char > vertices, indices;
+			/// The iso-vertex of each staged vertex, vertices of iso-vertices already in the hardware buffer are not appended again
+			IsoVertexVector shipment;
+			/// Triangulation cases of the resolution
+			RegularTriangulationCaseList regCases;
+			/// Triangulation cases of each side of the resolution, empty for sides without transition cells
+			TransitionTriangulationCaseList transCases[CountOrthogonalNeighbors];
+			/// Iso-vertex properties of the transition cells of the resolution
+			BorderIsoVertexPropertiesVector borderIsoVertexProperties, middleIsoVertexProperties;
+			/// Whether the triangulation cases and iso-vertex properties of each side of the resolution were computed
+			bool stitched[CountOrthogonalNeighbors];
+
+			/// Retrieves the approximate number of bytes the entry occupies
+			size_t size () const;
+
+			/** Serializes the entry to the stream
+			@remarks Meta data records are written in their native layout, readers should compare their own layout with the one the entries were written with */
+			StreamSerialiser & operator >> (StreamSerialiser & output) const;
+			/// Deserializes the entry from the stream
+			StreamSerialiser & operator << (StreamSerialiser & input);
+
+			/// Retrieves a signature of the sizes of the meta data records an entry is serialized with
+			static uint32 getLayout ();
+		};
+		typedef SharedPtr< Entry > EntryPtr;
+		typedef std::vector< std::pair< Key, EntryPtr > > EntryVector;
+
+		/// @param nCapacity Greatest number of bytes of all entries together
+		BuildCache (const size_t nCapacity);
+
+		/** Looks-up the entry of the specified key and marks it as most recently used
+		@returns The entry or null if there is none, every call counts as either a hit or a miss */
+		EntryPtr find (const Key & key);
+		/** Adds or replaces the entry of the specified key, least recently used entries are evicted to make room
+		@remarks Entries larger than the capacity are not retained */
+		void insert (const Key & key, const EntryPtr & pEntry);
+		/** Gathers the entries of all configurations built from the specified voxel content of a channel
+		@remarks Neither the recency of the entries nor the hit and miss counters are affected, entries built with any neighbouring 
+			voxels are gathered and their keys are complete
+		@param content Hash of the compressed voxel channels
+		@param channel Ordinal of the channel the surfaces belong to
+		@param entries (out) Receives the keys and entries found
+		*/
+		void collect (const unsigned long long content, const uint16 channel, EntryVector & entries) const;
+
+		/** Retrieves the usage of the cache
+		@param nHits (out) Number of look-ups that found an entry since the counters were last reset
+		@param nMisses (out) Number of look-ups that found no entry since the counters were last reset
+		@param nEntries (out) Number of entries currently retained
+		@param nBytes (out) Number of bytes the entries currently retained occupy
+		*/
+		void getStatistics (size_t & nHits, size_t & nMisses, size_t & nEntries, size_t & nBytes) const;
+		/// Resets the hit and miss counters
+		void resetStatistics ();
+
+	private:
+		mutable boost::mutex _mutex;
+
+		typedef std::list< std::pair< Key, EntryPtr > > EntryList;
+		typedef std::map< Key, EntryList::iterator > EntryMap;
+
+		/// Entries from most to least recently used
+		EntryList _lEntries;
+		/// Locates the entry of each key in the list
+		EntryMap _mapEntries;
+
+		/// Greatest and current number of bytes of all entries together respectively
+		const size_t _nCapacity;
+		size_t _nBytes;
+		/// Look-up counters
+		size_t _nHits, _nMisses;
+
+		// Copying a cache is nonsensical
+		BuildCache (const BuildCache &);
+	};
+}
+
+#endif
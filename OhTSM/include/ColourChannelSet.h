@@ -33,6 +33,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include "OverhangTerrainPrerequisites.h"
 
 #include <OgreColourValue.h>
+#include <OgreException.h>
 
 #include <memory.h>
 
@@ -148,6 +149,7 @@ namespace Ogre
 			inline
 				const_Reference operator [] (const size_t index) const
 			{
+				OgreAssert(r != NULL, "Colour channels were not leased");
 				return const_Reference(&r[index], &g[index], &b[index], &a[index]);
 			}
 
@@ -155,6 +157,7 @@ namespace Ogre
 			inline
 				Reference operator [] (const size_t index)
 			{
+				OgreAssert(r != NULL, "Colour channels were not leased");
 				return Reference(&r[index], &g[index], &b[index], &a[index]);
 			}
 
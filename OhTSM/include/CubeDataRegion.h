@@ -48,6 +48,9 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include "RLE.h"
 #include "DataBase.h"
 
+#include <list>
+#include <vector>
+
 namespace Ogre
 {
 	namespace Voxel 
@@ -77,13 +80,78 @@ namespace Ogre
 				RLE::Channel u, v;
 			} * const texcoords;
 
+			/// Values are indexed for random access, the other channels are only ever decompressed entirely
 			RLE::Channel values;
 
+			/// Number of runs between entries of the skip index of the values channel
+			static const size_t ValuesIndexInterval = 16;
+
 			CompressedDataBase(const size_t nVRFlags);
 			~CompressedDataBase();
 
 			void operator << (const DataBase & database);
 			void operator >> (DataBase & database) const;
+
+			/// Compresses only the specified channels (DataBase::Channels) of the data-base, the others are left as they are
+			void commit (const DataBase & database, const size_t nChannels);
+			/// Decompresses only the specified channels (DataBase::Channels) into the data-base, the others are left undefined
+			void extract (DataBase & database, const size_t nChannels) const;
+
+			/// Computes a CRC value of all compressed channels, regions with equal voxels yield equal values
+			unsigned long long computeCRC () const;
+		};
+
+		/** Coarse summary of the signs of the voxels of a cubical region partitioned into macro cells of several grid-cells each,
+			used by the iso-surface builder to skip homogeneous portions of a region without scanning or even decompressing it */
+		class _OverhangTerrainPluginExport SignOccupancy
+		{
+		public:
+			/// Flags indicating the signs present in a set of voxels
+			enum Occupancy
+			{
+				Occ_Negative = 1,
+				Occ_Positive = 2,
+				Occ_Mixed = Occ_Negative | Occ_Positive
+			};
+
+			/// Maximum number of macro cells along each axis of a region
+			static const DimensionType MacroCount = 4;
+
+			SignOccupancy(const CubeDataRegionDescriptor & dgtmpl);
+
+			/// Recomputes the occupancy of every macro cell from the specified voxel values of a region
+			void update(const FieldStrength * values);
+			/// Forgets the signs of the region, the entire region is reported mixed until the next update
+			void invalidate();
+
+			/// Occupancy of the entire region
+			inline
+				Occupancy total() const { return _enTotal; }
+			/// Whether every voxel of the region has the same sign, in which case it has no surface
+			inline
+				bool homogeneous() const { return _enTotal != Occ_Mixed; }
+
+			/** Retrieves the combined occupancy of the macro cells containing the specified inclusive range of grid-points
+			@remarks The result is conservative, a homogeneous range may be reported as mixed but never the reverse */
+			Occupancy query(const DimensionType x0, const DimensionType y0, const DimensionType z0, const DimensionType x1, const DimensionType y1, const DimensionType z1) const;
+			/// Retrieves the combined occupancy of the macro cells containing the grid-points flush with the specified side(s)
+			Occupancy query(const Touch3DSide side) const;
+
+		private:
+			const CubeDataRegionDescriptor * _pDescriptor;
+			/// Number of grid-cells spanned by a macro cell and number of macro cells along each axis
+			DimensionType _nSpan, _nCount;
+			/// Occupancy of the entire region
+			Occupancy _enTotal;
+			/// Occupancy of each macro cell including the grid-points on all of its boundaries, indexed by z, y, and x
+			unsigned char _vMacroCells[MacroCount][MacroCount][MacroCount];
+
+			/// Index of the first and last macro cells along an axis containing an inclusive range of grid-points
+			inline
+				DimensionType firstMacroCell(const DimensionType p0) const { return std::min(DimensionType(p0 / _nSpan), DimensionType(_nCount - 1)); }
+			inline
+				DimensionType lastMacroCell(const DimensionType p0, const DimensionType p1) const 
+				{ return std::max(firstMacroCell(p0), std::min(DimensionType((p1 > 0 ? p1 - 1 : 0) / _nSpan), DimensionType(_nCount - 1))); }
 		};
 
 		template< typename HOOK, typename BUCKET, typename FIELDSTRENGTH, typename VOXELGRID, typename COLOURSET, typename GRADIENTFIELD >
@@ -112,9 +180,13 @@ namespace Ogre
 
 		protected:
 			const CubeDataRegionDescriptor & _dgtmpl;
+			/// The leased data-base
+			BUCKET * const _pBucket;
 
 		public:
 			const size_t count;
+			/// The combination of DataBase::Channels this lease exposes, the gradient and colour accessors of the others are null
+			const size_t channels;
 
 			typedef FIELDSTRENGTH FieldStrength;
 			typedef VOXELGRID VoxelGrid;
@@ -130,34 +202,51 @@ namespace Ogre
 				boost::recursive_mutex & mutex,
 				BUCKET * pBucket,
 				HOOK * pDataBaseHook,
-				const CubeDataRegionDescriptor & dgtmpl
+				const CubeDataRegionDescriptor & dgtmpl,
+				const size_t nChannels
 			)
 				:	_pResource(new AtomicResource(mutex, pBucket, pDataBaseHook)),
 					_dgtmpl(dgtmpl),
-					gradients(dgtmpl, pBucket->dx, pBucket->dy, pBucket->dz), 
-					colours(dgtmpl, pBucket->red, pBucket->green, pBucket->blue, pBucket->alpha), 
+					_pBucket(pBucket),
+					gradients(
+						dgtmpl, 
+						nChannels & DataBase::DBC_Gradient ? pBucket->dx : NULL, 
+						nChannels & DataBase::DBC_Gradient ? pBucket->dy : NULL, 
+						nChannels & DataBase::DBC_Gradient ? pBucket->dz : NULL
+					), 
+					colours(
+						dgtmpl, 
+						nChannels & DataBase::DBC_Colours ? pBucket->red : NULL, 
+						nChannels & DataBase::DBC_Colours ? pBucket->green : NULL, 
+						nChannels & DataBase::DBC_Colours ? pBucket->blue : NULL, 
+						nChannels & DataBase::DBC_Colours ? pBucket->alpha : NULL
+					), 
 					values(pBucket->values),
 					voxels(dgtmpl, pBucket->values),
-					count(dgtmpl.gpcount)
+					count(dgtmpl.gpcount),
+					channels(nChannels | DataBase::DBC_Values)
 			{
 			}
 
 			template_DataAccessor(template_DataAccessor && move)
 				:	_pResource(move._pResource),
 					_dgtmpl(move._dgtmpl), 
+					_pBucket(move._pBucket),
 					gradients(const_cast< Ogre::Voxel::GradientField && > (move.gradients)), 
 					colours(const_cast< Ogre::Voxel::ColourChannelSet && > (move.colours)),
 					values(move.values), 
 					voxels(const_cast< Ogre::Voxel::FieldAccessor && > (move.voxels)), 
-					count(move.count) 
+					count(move.count),
+					channels(move.channels)
 			{
 			}
 
 			template_DataAccessor(const template_DataAccessor & copy)
 				:	_pResource(copy._pResource),
 					_dgtmpl(copy._dgtmpl), 
+					_pBucket(copy._pBucket),
 					gradients(copy.gradients), colours(copy.colours),
-					values(copy.values), voxels(copy.voxels), count(copy.count) 
+					values(copy.values), voxels(copy.voxels), count(copy.count), channels(copy.channels) 
 			{
 			}
 		};
@@ -169,12 +258,30 @@ namespace Ogre
 				boost::recursive_mutex & mutex,
 				const DataBase * pBucket,
 				const IDataBaseHook * pDataBaseHook,
-				const CubeDataRegionDescriptor & dgtmpl
+				const CubeDataRegionDescriptor & dgtmpl,
+				const size_t nChannels = DataBase::DBC_All
 			);
 			const_DataAccessor( const const_DataAccessor & copy);
 			const_DataAccessor( const_DataAccessor && move);
 		};
 
+		/** Read-only access to the voxel values of a region alone
+		@remarks Only the values channel is decompressed, the other channels cannot be accessed through this class at all.  
+			Serves read paths that classify or interpolate voxels by their values such as ray queries. */
+		class _OverhangTerrainPluginExport const_ValuesAccessor : private const_DataAccessor
+		{
+		public:
+			typedef const_DataAccessor::FieldStrength FieldStrength;
+			typedef const_DataAccessor::VoxelGrid VoxelGrid;
+
+			using const_DataAccessor::count;
+			using const_DataAccessor::values;
+			using const_DataAccessor::voxels;
+
+			/// @param access A lease of a data-base populated with at least the values channel
+			explicit const_ValuesAccessor( const const_DataAccessor & access );
+		};
+
 		class _OverhangTerrainPluginExport DataAccessor : public template_DataAccessor< IDataBaseHook, DataBase, FieldStrength, FieldAccessor, ColourChannelSet, GradientField >
 		{
 		private:
@@ -202,11 +309,21 @@ namespace Ogre
 			inline void addValueAt (const int delta, FieldAccessor::iterator i)
 			{
 				addValueTo(delta, *i);
+				touch(DataBase::DBC_Values);
 			}
 
 			inline void addValueAt (const int delta, const int x, const int y, const int z)
 			{
 				addValueTo(delta, voxels(x, y, z));
+				touch(DataBase::DBC_Values);
+			}
+
+			/** Flags channels as modified so that they are compressed when the lease is released
+			@remarks The methods of this class flag the channels they write to, this is only necessary after writing through the public members directly
+			@param nChannels A combination of DataBase::Channels */
+			inline void touch (const size_t nChannels)
+			{
+				_pBucket->modified |= nChannels;
 			}
 
 			void updateGradient();
@@ -270,7 +387,13 @@ namespace Ogre
 		public:
 			const CubeDataRegionDescriptor & meta;
 
-			CubeDataRegion(const size_t nVRFlags, DataBasePool * pPool, const CubeDataRegionDescriptor & dgtmpl, const AxisAlignedBox & bbox = AxisAlignedBox::BOX_NULL );
+			/**
+			@param nVRFlags A combination of OverhangTerrainVoxelRegionFlags identifying what channels this region supports
+			@param pPool The pool data-bases are checked-out of when the region is leased
+			@param dgtmpl Describes the dimensions of the region
+			@param bbox Bounding-box of the region
+			@param pCache The cache keeping the voxels of recently leased regions decompressed, NULL to decompress on every lease */
+			CubeDataRegion(const size_t nVRFlags, DataBasePool * pPool, const CubeDataRegionDescriptor & dgtmpl, const AxisAlignedBox & bbox = AxisAlignedBox::BOX_NULL, DataBaseCache * pCache = NULL );
 			virtual ~CubeDataRegion();
 
 			inline 
@@ -315,7 +438,21 @@ namespace Ogre
 
 			mutable DataBasePool * _pPool;
 
+			/// The cache this region is resident in while it is leased frequently, NULL if there is none
+			DataBaseCache * const _pCache;
+			/// Decompressed voxels retained by the cache between leases, NULL while the region isn't resident
+			mutable DataBase * _pResident;
+			/// Channels (DataBase::Channels) of the resident voxels modified since they were last compressed
+			mutable size_t _nResidentDirty;
+			/// Number of outstanding leases of the resident voxels, a region is only evicted when there are none
+			mutable size_t _nResidentLeases;
+
 			CompressedDataBase * _compression;
+			/// Sign occupancy of the voxels last committed to the compressed data-base
+			SignOccupancy _occupancy;
+			/// Hash of the compressed data-base and whether it is current respectively
+			mutable unsigned long long _nContentHash;
+			mutable bool _bContentHash;
 
 			/// Bounding box of the grid.
 			AxisAlignedBox _bbox;
@@ -329,7 +466,30 @@ namespace Ogre
 			virtual void released(DataBase * pDataBucket);
 			virtual void released(const DataBase * pDataBucket) const;
 
-			void populate (DataBase * pDataBucket) const;
+			/// Decompresses the specified channels (DataBase::Channels) of this region's voxels into the data-base
+			void populate (DataBase * pDataBucket, const size_t nChannels = DataBase::DBC_All) const;
+
+			/// Retrieves the channels (DataBase::Channels) this region has
+			inline
+				size_t getChannels () const 
+				{ 
+					return DataBase::DBC_Values | 
+						(hasGradient() ? DataBase::DBC_Gradient : 0) | 
+						(hasColours() ? DataBase::DBC_Colours : 0) | 
+						(hasTexCoords() ? DataBase::DBC_TexCoords : 0); 
+				}
+
+			/** Checks-out a data-base populated with the specified channels of this region's voxels, the resident one if the region is cached
+			@remarks A region only becomes resident when all of its channels are leased */
+			DataBase * acquire (const size_t nChannels = DataBase::DBC_All) const;
+			/// Compresses the resident voxels if they were modified since they were last compressed, the region must be locked
+			void commit () const;
+			/** Compresses and discards the resident voxels unless the region is leased or locked by another thread
+			@remarks Called by the cache while it is locked itself, hence the region is never waited on
+			@returns True if the region is no longer resident */
+			bool evict () const;
+
+			friend class DataBaseCache;
 
 		public:
 			DataAccessor lease ();
@@ -337,8 +497,65 @@ namespace Ogre
 			DataAccessor * lease_p ();
 			const_DataAccessor * lease_p () const;
 
+			/** Leases only the specified channels of this region's voxels for reading
+			@remarks Reading paths pay for decompressing the channels they actually read only.  The values are always leased, 
+				the gradient and colour accessors of channels that were not requested are null and assert in debug builds when read.
+			@param nChannels A combination of DataBase::Channels */
+			const_DataAccessor lease (const size_t nChannels) const;
+			/// Leases only the values of this region's voxels for reading, the other channels cannot be accessed through the lease
+			const_ValuesAccessor leaseValues () const;
+
 			CompressedDataAccessor clease();
 			const_CompressedDataAccessor clease () const;
+
+			/** Copies the values of an inclusive box of grid-points of this region into a caller buffer without leasing the region
+			@remarks Only the runs overlapping the box are decompressed unless the region is resident, in which case the values are copied directly.  
+				Suits reads of a handful of voxels where decompressing the entire region would dominate.
+			@param x0 Minimal x-coordinate of the box
+			@param y0 Minimal y-coordinate of the box
+			@param z0 Minimal z-coordinate of the box
+			@param x1 Maximal x-coordinate of the box
+			@param y1 Maximal y-coordinate of the box
+			@param z1 Maximal z-coordinate of the box
+			@param pDest Receives the values ordered by z, then y, then x and must hold (x1-x0+1)*(y1-y0+1)*(z1-z0+1) values */
+			void extractValues (
+				const DimensionType x0, const DimensionType y0, const DimensionType z0, 
+				const DimensionType x1, const DimensionType y1, const DimensionType z1, 
+				FieldStrength * pDest
+			) const;
+			/// Retrieves the value of a single grid-point of this region without leasing the region
+			FieldStrength getValue (const DimensionType x, const DimensionType y, const DimensionType z) const;
+
+			/// Retrieves a snapshot of the sign occupancy of this region's voxels
+			SignOccupancy getOccupancy() const;
+
+			/** Retrieves a hash of this region's compressed voxels
+			@remarks Computed on demand and retained until the voxels are next committed or replaced, 
+				used to recognize voxel content that was meshed before */
+			unsigned long long getContentHash() const;
+		};
+
+		/** Retains copies of the values of the most recently queried regions
+		@remarks Consecutive read-only queries of the same regions, such as batched ray queries, share a single decompression 
+			of their voxels.  The values are copied out of a lease that is released right away, so no region stays locked between 
+			queries and writers are never held up by the cache.  A copy is a snapshot of the region as it was when first queried, 
+			the cache is meant to be short-lived and confined to one thread. */
+		class _OverhangTerrainPluginExport ValuesCache
+		{
+		public:
+			/// @param nCapacity Greatest number of regions whose values are retained at once
+			ValuesCache (const size_t nCapacity);
+
+			/// Retrieves the values of the specified region, copying them if they are not retained already
+			const FieldStrength * values (const CubeDataRegion * pRegion);
+
+		private:
+			typedef std::list< std::pair< const CubeDataRegion *, std::vector< FieldStrength > > > CopyList;
+
+			/// Copies from most to least recently used
+			CopyList _copies;
+			/// Greatest number of regions whose values are retained at once
+			const size_t _nCapacity;
 		};
 	}
 }// namespace Ogre
@@ -57,8 +57,10 @@ namespace Ogre
 
 			/// Height, width, and depth of the grid
 			const DimensionType dimensions;
-			/// Total voxels and cells per region, total voxels and cells on a side of a region
-			const DimensionType gpcount, cellcount, sidegpcount, sidecellcount;
+			/// Total voxels and cells per region, these outnumber a WORD for regions larger than 32^3 cells
+			const size_t gpcount, cellcount;
+			/// Total voxels and cells on a side of a region
+			const DimensionType sidegpcount, sidecellcount;
 			/// The scale of grid cells; this influences the position of grid vertices.
 			const Real scale;
 
@@ -229,17 +231,17 @@ namespace Ogre
 			inline 
 				void computeGridPoint(GridPointCoords & gpc, const VoxelIndex idx) const 
 			{ 
-				gpc.i = ((unsigned short)idx % coordsIndexTx.my) / coordsIndexTx.mx;
-				gpc.j = ((unsigned short)idx % coordsIndexTx.mz) / coordsIndexTx.my;
-				gpc.k = (unsigned short)idx / coordsIndexTx.mz;
+				gpc.i = (uint32(idx) % coordsIndexTx.my) / coordsIndexTx.mx;
+				gpc.j = (uint32(idx) % coordsIndexTx.mz) / coordsIndexTx.my;
+				gpc.k = uint32(idx) / coordsIndexTx.mz;
 			}
 			/// Returns the grid cell at the specified index
 			inline 
 				void computeGridCell(GridCellCoords & gcc, const CellIndex idx) const 
 			{ 
-				gcc.i = ((unsigned short)idx % cellIndexTx.my) / cellIndexTx.mx;
-				gcc.j = ((unsigned short)idx % cellIndexTx.mz) / cellIndexTx.my;
-				gcc.k = (unsigned short)idx / cellIndexTx.mz;
+				gcc.i = (uint32(idx) % cellIndexTx.my) / cellIndexTx.mx;
+				gcc.j = (uint32(idx) % cellIndexTx.mz) / cellIndexTx.my;
+				gcc.k = uint32(idx) / cellIndexTx.mz;
 			}
 
 			/// Returns the voxel coordinates at the specified index
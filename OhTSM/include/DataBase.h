@@ -5,6 +5,9 @@
 
 #include "IsoSurfaceSharedTypes.h"
 
+#include <list>
+#include <map>
+
 namespace Ogre
 {
 	namespace Voxel
@@ -16,14 +19,29 @@ namespace Ogre
 			DataBase (const DataBase &);
 
 		public:
+			/// Flags identifying the channels of a data-base
+			enum Channels
+			{
+				DBC_Values = 1 << 0,
+				DBC_Gradient = 1 << 1,
+				DBC_Colours = 1 << 2,
+				DBC_TexCoords = 1 << 3,
+				DBC_All = DBC_Values | DBC_Gradient | DBC_Colours | DBC_TexCoords
+			};
+
 			const size_t count;
 			FieldStrength * values;
 			signed char * dx, *dy, *dz;
 			unsigned char * red, * green, * blue, * alpha;
 			unsigned char * tx, *ty;
+			/// Combination of Channels written to since the data-base was last populated or released
+			size_t modified;
 
 			DataBase(const size_t nCount, const size_t nVRFlags);
 			virtual ~DataBase();
+
+			/// Retrieves the number of bytes occupied by the voxels of all channels
+			size_t size () const;
 		};
 
 		/** A memory pool pattern for DataBase instances to eliminate allocation/deallocation
@@ -82,6 +100,60 @@ namespace Ogre
 
 			~DataBasePool();
 		};
+
+		/** Bounded least-recently-used set of cube data regions whose voxels are kept decompressed between leases
+		@remarks A resident region leases the same decompressed data-base over and over instead of decompressing its channels each
+			time, and modifications are only compressed again when the region is evicted or its compressed form is needed.  Regions 
+			are evicted when the bytes of all resident data-bases exceed the capacity, regions that are currently leased are passed 
+			over.  The cache is shared by all regions of a factory and is thread-safe. */
+		class _OverhangTerrainPluginExport DataBaseCache
+		{
+		public:
+			/// @param nCapacity Greatest number of bytes of all resident data-bases together
+			DataBaseCache (const size_t nCapacity);
+
+			/** Marks the region as most recently used, admitting it if it isn't resident yet, and evicts least recently used regions to make room
+			@remarks Called by the region while it is locked, other regions are only ever try-locked for eviction so this cannot deadlock
+			@param pRegion The region that was leased
+			@param nBytes Size of the resident data-base of the region
+			@param bHit Whether the region was already resident, every call counts as either a hit or a miss */
+			void touch (const CubeDataRegion * pRegion, const size_t nBytes, const bool bHit);
+			/// Forgets the region without evicting it, called when the region is destroyed, all regions must be destroyed before the cache
+			void remove (const CubeDataRegion * pRegion);
+
+			/** Retrieves the usage of the cache
+			@param nHits (out) Number of leases of resident regions since the counters were last reset
+			@param nMisses (out) Number of leases that decompressed a region since the counters were last reset
+			@param nEvictions (out) Number of regions evicted since the counters were last reset
+			@param nResidents (out) Number of regions currently resident
+			@param nBytes (out) Number of bytes the data-bases of the resident regions currently occupy
+			*/
+			void getStatistics (size_t & nHits, size_t & nMisses, size_t & nEvictions, size_t & nResidents, size_t & nBytes) const;
+			/// Retrieves the fraction of leases since the counters were last reset that found their region resident
+			Real getHitRatio () const;
+			/// Resets the hit, miss and eviction counters
+			void resetStatistics ();
+
+		private:
+			mutable boost::mutex _mutex;
+
+			typedef std::list< std::pair< const CubeDataRegion *, size_t > > RegionList;
+			typedef std::map< const CubeDataRegion *, RegionList::iterator > RegionMap;
+
+			/// Resident regions and the size of their data-bases from most to least recently used
+			RegionList _lRegions;
+			/// Locates each resident region in the list
+			RegionMap _mapRegions;
+
+			/// Greatest and current number of bytes of all resident data-bases together respectively
+			const size_t _nCapacity;
+			size_t _nBytes;
+			/// Usage counters
+			size_t _nHits, _nMisses, _nEvictions;
+
+			// Copying a cache is nonsensical
+			DataBaseCache (const DataBaseCache &);
+		};
 	}
 }
 
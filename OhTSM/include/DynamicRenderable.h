@@ -53,6 +53,7 @@ namespace Ogre
 		@param bIndices Whether indices are used by triangle data generated for this renderable
 		@param nLODLevels The number of levels of detail used by this renderable for multi-resolution rendering
 		@param fPixelError The maximum number of pixels allowed on the screen in error before resolution switching occurs
+		@param enIndexType The width of indices in the hardware index buffer
 		@param sName Optional name for this renderable
 		*/
 		DynamicRenderable(
@@ -61,6 +62,7 @@ namespace Ogre
 			bool bIndices, 
 			const size_t nLODLevels, 
 			const Real fPixelError, 
+			const HardwareIndexBuffer::IndexType enIndexType,
 			const Ogre::String & sName = ""
 		);
 		virtual ~DynamicRenderable();
@@ -132,6 +134,8 @@ namespace Ogre
 			size_t _capacity, _count;
 			/// Resolution count
 			unsigned int _nResCount;
+			/// Width of indices in the hardware index buffer
+			HardwareIndexBuffer::IndexType _enIndexType;
 			/// Ensures the hardware index buffer meets the minimum size, if not then the buffer is resized resulting in a subsequent call to reset()
 			bool prepare (const size_t nIndexCount);
 			/// Tracks whether this object has endured a shallow copy
@@ -144,7 +148,7 @@ namespace Ogre
 			SurfaceIndexData (const SurfaceIndexData & copy);
 
 		public:
-			SurfaceIndexData (const unsigned nResolutionCount, VertexDeclaration * pVtxDecl);
+			SurfaceIndexData (const unsigned nResolutionCount, VertexDeclaration * pVtxDecl, const HardwareIndexBuffer::IndexType enIndexType);
 			SurfaceIndexData (SurfaceIndexData && move);
 			~SurfaceIndexData();
 
@@ -173,6 +177,9 @@ namespace Ogre
 			HardwareIndexBufferSharedPtr getIndexBuffer () { return _buffer; }
 			/// Retrieve the hardware index buffer
 			const HardwareIndexBufferSharedPtr getIndexBuffer () const { return _buffer; }
+
+			/// Width of indices in the hardware index buffer
+			HardwareIndexBuffer::IndexType getIndexType () const { return _enIndexType; }
 			/// Resets the software state for all these resolutions
 			virtual void reset ();
 			/// Destroys the index hardware buffer
@@ -182,6 +189,11 @@ namespace Ogre
 			@return True if there was room or the configuration already exists, false if the hardware buffer had to be resized */
 			bool prepare (const char lod, const size_t nStitchFlags, const size_t nIndexCount);
 
+			/* Ensures there is room in the hardware buffer for the specified number of indices without defining a slot/slice for them, 
+				several configurations prepared afterwards within this amount will not resize the hardware buffer in-between
+			@return True if there was room, false if the hardware buffer had to be resized */
+			bool reserve (const size_t nIndexCount);
+
 			void rebuildHWBuffer();
 
 		};
@@ -269,7 +281,7 @@ namespace Ogre
 			SurfaceVertexData vertices;
 			SurfaceIndexData indices;
 
-			Mesh(const unsigned nResolutionCount, VertexDeclaration * pVtxDecl);
+			Mesh(const unsigned nResolutionCount, VertexDeclaration * pVtxDecl, const HardwareIndexBuffer::IndexType enIndexType);
 
 			/// Clears both vertices and indices, the entire software state for the mesh
 			void clear();
@@ -302,6 +314,8 @@ namespace Ogre
 
 		/// Ensures minimum capacity (index count) of the hardware index buffer linked by the specified LOD and stitch configuration
 		virtual bool prepareIndexBuffer(const unsigned nLOD, const size_t nStitchFlags, const size_t indexCount);
+		/// Ensures the hardware index buffer has room for the specified index count of several configurations prepared subsequently
+		virtual bool reserveIndexBuffer(const size_t indexCount);
 		/** Ensures minimum capacity (vertex element count) of the hardware vertex buffer
 		@param nVtxCount The minimum capacity of the hardware vertex buffer even if it has to create a newer bigger buffer
 		@param bClearIndicesToo Force erasure of all hardware index buffers used by the specified LOD
@@ -137,10 +137,10 @@ namespace Ogre
 			public:
 				/// Expose read-only access to the component at the specified index in the field
 				inline
-					const_ComponentReference operator [] (const size_t index) const { return const_ComponentReference(&_channel[index]); }
+					const_ComponentReference operator [] (const size_t index) const { OgreAssert(_channel != NULL, "Gradient channel was not leased"); return const_ComponentReference(&_channel[index]); }
 				/// Expose read/write access to the component at the specified index in the field
 				inline
-					ComponentReference operator [] (const size_t index) { return ComponentReference(&_channel[index]); }
+					ComponentReference operator [] (const size_t index) { OgreAssert(_channel != NULL, "Gradient channel was not leased"); return ComponentReference(&_channel[index]); }
 
 			} dx, dy, dz;	/// Channel accessors for all 3 vector components in the field
 
@@ -220,12 +220,14 @@ namespace Ogre
 			inline
 				const_Reference operator [] (const size_t index) const
 			{
+				OgreAssert(_dx != NULL, "Gradient channels were not leased");
 				return const_Reference(&_dx[index], &_dy[index], &_dz[index]);
 			}
 			/// Retrieve a mutable recomposed vector-type accessor to the component values at the specified index into the field
 			inline
 				Reference operator [] (const size_t index)
 			{
+				OgreAssert(_dx != NULL, "Gradient channels were not leased");
 				return Reference(&_dx[index], &_dy[index], &_dz[index]);
 			}
 
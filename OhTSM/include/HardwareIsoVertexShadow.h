@@ -34,6 +34,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 
 #include "Neighbor.h"
 #include "IsoSurfaceSharedTypes.h"
+#include "Util.h"
 
 #include <OgreSharedPtr.h>
 #include <OgreVector2.h>
@@ -85,6 +86,10 @@ namespace Ogre
 				face of transition cells respectively */
 			BorderIsoVertexPropertiesVector borderIsoVertexProperties, middleIsoVertexProperties;
 
+			/** Voxels that changed since this LOD was last batched to the GPU, the triangulation cases and hardware vertices 
+				within this region are stale and must be patched by IsoSurfaceBuilder (null when there is nothing to patch) */
+			CellRegion dirty;
+
 			/// Define a configuration for the specified LOD
 			LOD(const unsigned nLOD);
 			~LOD();
@@ -96,7 +101,35 @@ namespace Ogre
 		public:
 			/// Maps logical isovertex indices to their hardware vertex index counterparts
 			IsoVertexVector revmapIVI2HWVI;
+			/** Voxels that changed since hardware vertices were last batched to the GPU, hardware vertices derived from this region 
+				are stale regardless of LOD and are evicted by the next batch (null when there is nothing to evict) */
+			CellRegion dirty;
+
+			/** Remaps hardware vertices that were patched or became stale, maps (appends) new isovertices and clears the dirty region
+			@param remaps Hardware vertices to remap to another isovertex or to unmap
+			@param beginRevMapIVI2HWVI Iterator pattern pointer to beginning of isovertex indices to map to hardware vertex buffer indices
+			@param endRevMapIVI2HWVI Iterator pattern pointer to end of isovertex indices to map to hardware vertex buffer indices */
+			void update(const IsoVertexRemapVector & remaps, const IsoVertexVector::const_iterator beginRevMapIVI2HWVI, const IsoVertexVector::const_iterator endRevMapIVI2HWVI);
+		};
+
+		/** Identifies a single configuration of a surface, the LOD and the sides stitched to adjacent higher resolution surfaces */
+		class Configuration
+		{
+		public:
+			/// The level of detail ordinal value (zero for highest resolution, >0 for lower resolutions)
+			unsigned lod;
+			/// The sides of the cube voxel region that have transition cells
+			Touch3DFlags stitches;
+
+			Configuration(const unsigned nLOD, const Touch3DFlags enStitches)
+				: lod(nLOD), stitches(enStitches) {}
+
+			inline bool operator == (const Configuration & other) const
+			{
+				return lod == other.lod && stitches == other.stitches;
+			}
 		};
+		typedef std::vector< Configuration > ConfigurationList;
 
 		/** Simply houses shadow information for the indices shared by all LODs and LOD configurations */
 		class Indices
@@ -152,6 +185,8 @@ namespace Ogre
 
 			/// Initializes the members
 			MeshOperation(LOD * pResolution, Vertices * pVertices, Indices * pIndices, IBufferManager * pBuffMan);
+			/// Initializes the members for another resolution and vertex state, the indices and buffer manager are those of the specified mesh operation
+			MeshOperation(const MeshOperation & other, LOD * pResolution, Vertices * pVertices);
 
 			/** Clears either the GPU, shadow, or both for vertex information
 			 * @param depth Indicates how deep to clear */
@@ -164,7 +199,7 @@ namespace Ogre
 			/// Returns the next hardware vertex buffer index for new vertices that would be appended to the buffer
 			size_t nextVertexIndex() const { return vertices->revmapIVI2HWVI.size(); }
 			/// Populates the specified map of isovertex indices to hardware vertex buffer indices from that stored in this object
-			void restoreHWIndices(HWVertexIndex * mapIVI2HWVI);
+			void restoreHWIndices(HWVertexIndexMap & mapIVI2HWVI);
 
 			inline bool operator == (const MeshOperation & other) const
 			{
@@ -172,31 +207,129 @@ namespace Ogre
 			}
 		};
 
+		/** Reusable storage for geometry batch data staged in the final layout of the hardware buffers
+		@remarks Owned by the shadow and shared by all of its batches, only one batch is pending at a time.  The storage retains its capacity 
+			between batches so that steady-state builds do not allocate, the main thread merely copies each staged range into the locked 
+			hardware buffer. */
+		class StagingArena
+		{
+		public:
+			/** Growable byte storage */
+			class Buffer
+			{
+			private:
+				/// The storage, its size is the capacity
+				std::vector< unsigned char > _vBytes;
+				/// Number of bytes in use
+				size_t _nSize;
+
+			public:
+				Buffer() : _nSize(0) {}
+
+				/// Discards the contents but keeps the capacity
+				inline void clear() { _nSize = 0; }
+				/// Appends uninitialized bytes, the address returned is valid until the next append
+				unsigned char * append(const size_t nBytes);
+
+				/// Retrieves the address of the byte at the specified offset
+				inline const unsigned char * data(const size_t nOffset = 0) const { return &_vBytes[nOffset]; }
+				/// Retrieves the number of bytes in use
+				inline size_t size() const { return _nSize; }
+				inline bool empty() const { return _nSize == 0; }
+			};
+
+			/// New vertices in the layout of the hardware vertex buffer
+			Buffer vertices;
+			/// Vertices that replace ones already in the hardware buffer in the layout of the hardware vertex buffer
+			Buffer patches;
+			/// Triangle indices of every configuration of the batch in the width of the hardware index buffer
+			Buffer indices;
+
+			/// Size in bytes of a single vertex in the hardware vertex buffer and of a single index in the hardware index buffer respectively
+			size_t vertexSize, indexSize;
+
+			StagingArena();
+
+			/// Discards the data staged for the previous batch but keeps the capacity
+			void clear();
+
+			/// Retrieves the number of new vertices staged
+			inline size_t vertexCount() const { return vertexSize > 0 ? vertices.size() / vertexSize : 0; }
+			/// Retrieves the number of indices staged
+			inline size_t indexCount() const { return indexSize > 0 ? indices.size() / indexSize : 0; }
+		};
+
 		/** An object that can be used to update a hardware vertex buffer */
 		class BuilderQueue
 		{
 		public:
-			typedef std::vector< HWVertexIndex > IndexList;
+			/** A range of indices staged in the index buffer of the staging arena that belong to a single configuration */
+			class IndexRange
+			{
+			public:
+				/// Offset and length of the range in indices
+				size_t offset, count;
+
+				IndexRange() : offset(0), count(0) {}
+			};
 
-			/** Contains necessary hardware vertex buffer information for a single vertex element */
-			class VertexElement
+			/** Contains necessary hardware vertex buffer information for a single vertex element in the compact quantized format
+			@remarks Positions are relative to the centre of the cube and normalized to the range of a signed short, the renderable scales
+				them back to the size of the cube by its world transform (see getPositionScale).  Normals are octahedral-encoded and must be decoded by the vertex program, texture coordinates
+				are signed fixed-point with TexCoordFracBits fractional bits, there is no half-float vertex element type to use instead. */
+			class CompactVertexElement
 			{
 			public:
-				/// Vertex position and normal
-				Vector3 position, normal;
+				/// Number of quantization steps from the centre of a cube to any of its faces for vertex positions
+				static const int16 PositionRange = 32767;
+				/// Number of fractional bits of texture coordinates
+				static const int TexCoordFracBits = 10;
+
+				/// Vertex position relative to the cube, the fourth component is always one
+				int16 position[4];
+				/// Octahedral-encoded vertex normal, both components normalized to the range of a signed short
+				int16 normal[2];
 				/// Vertex colour
 				uint32 colour;
-				/// Vertex texture coordinate
-				Vector2 texcoord;
-
-				VertexElement() {}
-				/// Initialize this object's members to these specified
-				VertexElement(const Vector3 & vPos, const Vector3 & vNorm, const ColourValue & cColour, const Vector2 & vTexCoord);
-
+				/// Vertex texture coordinate in fixed-point
+				int16 texcoord[2];
+
+				/** Set the position from the specified one relative to the centre of the cube
+				@param vPos Vertex position in units of the edge of the cube, each component ranges from -0.5 at the minimal face 
+					of the cube to +0.5 at the maximal face */
+				void setPosition(const Vector3 & vPos);
+				/** Set the position from the specified grid position, this is how builders and renderables encode iso-vertices
+				@param pt Vertex position in grid cells relative to the centre of the cube as generated by the builder
+				@param nDimensions Number of grid cells along an edge of the cube */
+				void setPosition(const IsoFixVec3 & pt, const DimensionType nDimensions);
+				/// Retrieves the quantized position in the units and range accepted by setPosition
+				Vector3 getPosition() const;
+				/** Computes the scale that restores quantized positions to the size of the cube
+				@param nDimensions Number of grid cells along an edge of the cube
+				@param fGridScale World-size of a single grid cell */
+				static Real getPositionScale(const DimensionType nDimensions, const Real fGridScale);
+				/// Set the normal by octahedral-encoding the specified unit vector
+				void setNormal(const Vector3 & vNorm);
 				/// Set the colour according to the specified ColourValue object
 				void setColour(const ColourValue & cColour);
+				/// Set the texture coordinate, it must be within the range of the fixed-point representation
+				void setTexCoord(const Real u, const Real v);
+			};
+
+			/** A further configuration produced together with the primary one of the batch, its new vertices are part of the batch's vertex queues */
+			class Sibling
+			{
+			public:
+				/// The LOD and meta data of the configuration
+				LOD * resolution;
+				/// Identifies which sides of the configuration transition cells apply
+				Touch3DFlags stitches;
+				/// Staged vertex indices of the configuration to be flushed to the appropriate hardware index buffer
+				IndexRange indices;
+
+				Sibling(LOD * pResolution, const Touch3DFlags enStitches);
 			};
-			typedef std::vector< VertexElement > VertexElementList;
+			typedef std::vector< Sibling > SiblingList;
 
 			/// Identifies which sides of the renderable transition cells apply
 			const Touch3DFlags stitches;
@@ -207,12 +340,16 @@ namespace Ogre
 			/// Flag indicating that the hardware index buffer must be reset, generated by the producer queue and consumed in the main thread
 			RoleSecureFlag::Flag * pResetIndexHWBuffer;
 
-			/// Vertex elements to be flushed to the appropriate hardware vertex buffer
-			VertexElementList vertexQueue;
-			/// Vertex indices to be flushed to the appropriate hardware index buffer
-			IndexList indexQueue;
+			/// Staged vertices and indices of the batch, the vertices replacing ones already in the hardware buffer follow the order of the patching entries of remapHWVI2IVIQueue, NULL for direct access
+			StagingArena * const staging;
+			/// Staged vertex indices of the primary configuration to be flushed to the appropriate hardware index buffer
+			IndexRange indexRange;
 			/// Identifies the new vertices to be appended to the hardware buffers, maps isovertex indices to their respective hardware vertex indices
 			IsoVertexVector revmapIVI2HWVIQueue;
+			/// Hardware vertices already in the buffer that are either patched in-place with a new isovertex or unmapped because they became stale
+			IsoVertexRemapVector remapHWVI2IVIQueue;
+			/// Further configurations batched along with the primary one (meshOp and stitches)
+			SiblingList siblings;
 
 			BuilderQueue(
 				LOD *					pResolution, 
@@ -221,9 +358,13 @@ namespace Ogre
 				IBufferManager *		pBuffMan, 
 				const Touch3DFlags		enStitches, 
 				RoleSecureFlag::Flag *	pResetVertexHWBuffer,
-				RoleSecureFlag::Flag *	pResetIndexHWBuffer
+				RoleSecureFlag::Flag *	pResetIndexHWBuffer,
+				StagingArena *			pStaging = NULL
 			);
 			~BuilderQueue();
+
+			/// @returns True if the specified configuration is either the primary one or one of the siblings of this batch
+			bool includes(const MeshOperation & other, const Touch3DFlags enStitches) const;
 		};
 
 		/** IsoSurfaceRenderable shadow meta data container, precomputed and cached frequently used data, synchronized with hardware buffers */
@@ -239,8 +380,9 @@ namespace Ogre
 				BuilderQueue *& _pBuilderQueue;
 
 				/** Sets the flags indicating that associated triangles have just been batched to the GPU
-				@remarks Sets the flags for both this object and the relevant stitch configuration objects that triangles have been batched.
-					Also maps (appends) the specified isovertex indices to hardware vertex buffer indices
+				@remarks Sets the flags for both this object and the relevant stitch configuration objects that triangles have been batched,
+					sibling configurations included.  Also remaps hardware vertices that were patched or became stale, maps (appends) the 
+					specified isovertex indices to hardware vertex buffer indices and clears the dirty regions of the resolutions
 				@param beginRevMapIVI2HWVI Iterator pattern pointer to beginning of isovertex indices to map to hardware vertex buffer indices
 				@param endRevMapIVI2HWVI Iterator pattern pointer to end of isovertex indices to map to hardware vertex buffer indices */
 				void updateHardwareState(const IsoVertexVector::const_iterator beginRevMapIVI2HWVI, const IsoVertexVector::const_iterator endRevMapIVI2HWVI);
@@ -253,6 +395,8 @@ namespace Ogre
 
 				/// Maps new isovertices to hardware vertex indices corresponding to the batch operation pending
 				IsoVertexVector & revmapIVI2HWVIQueue;
+				/// Remaps hardware vertices already in the buffer to patched isovertices (or unmaps them) for the batch operation pending
+				IsoVertexRemapVector & remapHWVI2IVIQueue;
 
 				StateAccess(BuilderQueue *& pBuilderQueue);
 				StateAccess(StateAccess && move);
@@ -262,10 +406,12 @@ namespace Ogre
 			class ConcurrentProducerConsumerQueueBase : public StateAccess
 			{
 			public:
-				/// Buffer of vertex elements to batch
-				BuilderQueue::VertexElementList & vertexQueue;
-				/// Buffer of the triangle index list to batch
-				BuilderQueue::IndexList & indexQueue;
+				/// Vertices and triangle indices of the batch staged in the layout of the hardware buffers
+				StagingArena & staging;
+				/// Range of the staged triangle indices of the primary configuration
+				BuilderQueue::IndexRange & indexRange;
+				/// Further configurations of the batch and their triangle index lists
+				BuilderQueue::SiblingList & siblings;
 
 				ConcurrentProducerConsumerQueueBase(BuilderQueue *& pBuilderQueue);
 				ConcurrentProducerConsumerQueueBase(ConcurrentProducerConsumerQueueBase && move);
@@ -295,7 +441,7 @@ namespace Ogre
 				/// Access to clear (consume) the reset index buffer flag
 				RoleSecureFlag::IClearFlag * _pClearResetIndexBufferFlag;
 
-				/// Determines if the shared lock was acquired and the hardware buffer batch data container is the right one according to LOD and stitch information
+				/// Determines if the shared lock was acquired and the hardware buffer batch data container includes the right configuration according to LOD and stitch information
 				inline
 				bool isValid () const
 				{
@@ -303,8 +449,7 @@ namespace Ogre
 						_pBuilderQueue != NULL &&
 						_pClearResetVertexBufferFlag != NULL &&
 						_pClearResetIndexBufferFlag != NULL && 
-						_pBuilderQueue->meshOp == _meshOp &&
-						_pBuilderQueue->stitches == _enStitches; 
+						_pBuilderQueue->includes(_meshOp, _enStitches); 
 				}
 
 			public:
@@ -352,23 +497,27 @@ namespace Ogre
 
 					/// Returns the number of required vertices to store in the hardware vertex buffer for the batch operation pending including vertices already present in the hardware buffer
 					inline
-					size_t requiredVertexCount() const { return meshOp.nextVertexIndex() + vertexQueue.size(); }
+					size_t requiredVertexCount() const { return meshOp.nextVertexIndex() + staging.vertexCount(); }
 
 					/// Returns the actual number of vertices required for storage in the hardware buffer accounting for buffer-resize and hence reset
 					inline
-					size_t actualVertexCount() const { return (!resetVertexBuffer ? meshOp.nextVertexIndex() : 0) + vertexQueue.size(); }
+					size_t actualVertexCount() const { return (!resetVertexBuffer ? meshOp.nextVertexIndex() : 0) + staging.vertexCount(); }
 
 					/// Returns the offset into the vertex buffer to begin populating vertex data at, will be zero if the vertex buffer was recently resized
 					inline
 					size_t vertexBufferOffset () const { return !resetVertexBuffer ? meshOp.nextVertexIndex() : 0; }
 
+					/// Returns the number of indices of all configurations of the batch operation pending
+					inline
+					size_t batchIndexCount() const { return staging.indexCount(); }
+
 					/// Returns the number of required indices to store in the hardware index buffer for the LOD configuration pending including configurations already present in the hardware buffer
 					inline
-					size_t requiredIndexCount() const { return meshOp.indices->allocated + indexQueue.size(); }
+					size_t requiredIndexCount() const { return meshOp.indices->allocated + indexRange.count; }
 
 					/// Returns the actual number of indices required for storage in the hardware buffer accounting for buffer-resize and hence reset
 					inline
-					size_t actualIndexCount() const { return (!resetIndexBuffer ? meshOp.indices->allocated : 0) + indexQueue.size(); }
+					size_t actualIndexCount() const { return (!resetIndexBuffer ? meshOp.indices->allocated : 0) + indexRange.count; }
 
 					/// Returns the offset into the index buffer to begin populating index data at, will be zero if the index buffer was recently resized
 					inline
@@ -402,7 +551,8 @@ namespace Ogre
 					IBufferManager *					pBuffMan, 
 					const Touch3DFlags					enStitches, 
 					RoleSecureFlag::Flag *				pResetVertexBufferFlag, 
-					RoleSecureFlag::Flag *				pResetIndexBufferFlag
+					RoleSecureFlag::Flag *				pResetIndexBufferFlag,
+					StagingArena *						pStaging
 				);
 
 			public:
@@ -424,6 +574,7 @@ namespace Ogre
 				@param pResetVertexBufferFlag The opaque reset hardware vertex buffer flag
 				@param pSetResetIndexBufferFlag Access to a flag to set the hardware index buffer flag
 				@param pResetIndexBufferFlag The opaque reset hardware index buffer flag
+				@param pStaging The staging arena of the shadow, cleared for the new batch
 				*/
 				ProducerQueueAccess(
 					boost::unique_lock< boost::shared_mutex > &&	lock, 
@@ -436,7 +587,8 @@ namespace Ogre
 					RoleSecureFlag::ISetFlag *						pSetResetVertexBufferFlag, 
 					RoleSecureFlag::Flag *							pResetVertexBufferFlag,
 					RoleSecureFlag::ISetFlag *						pSetResetIndexBufferFlag, 
-					RoleSecureFlag::Flag *							pResetIndexBufferFlag
+					RoleSecureFlag::Flag *							pResetIndexBufferFlag,
+					StagingArena *									pStaging
 				);
 				ProducerQueueAccess(ProducerQueueAccess && move);
 			};
@@ -521,6 +673,11 @@ namespace Ogre
  			 * @param depth Indicates how deep to clear */
 			void clearBuffers (const BufferDepth depth = IBufferManager::BD_GPU);
 
+			/** Flags a region of voxels as changed for all resolutions so that their shadow data is patched rather than discarded
+			@remarks Any pending geometry batch is discarded since it was produced from stale voxels.
+			@param region The voxels that changed in cube region grid cell coordinates */
+			void invalidateRegion (const CellRegion & region);
+
 		private:
 			class ResetIndexBufferFlag : public RoleSecureFlag::Flag
 			{
@@ -551,6 +708,8 @@ namespace Ogre
 			Vertices * _pVertices;
 			/// Indices meta
 			Indices * _pIndices;
+			/// Storage for the staged data of pending batches, re-used by every batch
+			StagingArena _staging;
 
 			/// Implemented from IBufferManager, this implicitly clears vertex-specific data
 			void clearVertices( const BufferDepth depth);
@@ -40,6 +40,11 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include "Util.h"
 #include "TransvoxelTables.h"
 #include "DebugTools.h"
+#include "VertexCacheOptimizer.h"
+#include "SurfaceNets.h"
+#include "MeshDecimator.h"
+#include "BuildCache.h"
+#include "SlabWorkers.h"
 
 #include <stack>
 #include <vector>
@@ -50,6 +55,9 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include <OgreHardwareVertexBuffer.h>
 #include <OgreHardwareIndexBuffer.h>
 #include <OgreWorkQueue.h>
+#include <OgreTimer.h>
+
+#include <boost/thread.hpp>
 
 #ifdef _OHT_ISB_TRACE
 	#define OHT_ISB_DBGTRACE(x) OHT_DBGTRACE(x)
@@ -88,6 +96,19 @@ namespace Ogre
 			bool flipNormals;
 			/// The method used for normal generation on surfaces of this channel
 			NormalsType normalsType;
+			/// Whether extracted triangle lists are reordered for the post-transform vertex cache
+			bool optimizeVertexCache;
+			/// Range [surfaceNetsLODBegin, surfaceNetsLODEnd) of levels of detail extracted with Surface Nets instead of Transvoxel
+			unsigned short surfaceNetsLODBegin, surfaceNetsLODEnd;
+			/// The first level of detail whose triangle lists are decimated, NoDecimation if none are
+			unsigned short decimationLOD;
+			/// Greatest error of an edge collapse when decimating
+			Real decimationMaxError;
+			/// Whether the hardware index buffers of this channel have 32-bit indices
+			bool wideIndices;
+
+			/// Value of decimationLOD disabling decimation
+			static const unsigned short NoDecimation = 0xFFFF;
 
 			/**
 			@param fTCWidthRatio The ratio width of a normal cell that makes-up the width of a transition cell
@@ -96,6 +117,12 @@ namespace Ogre
 			@param fMaxPixelError Maximum error in pixels for renderables of this channel
 			@param bFlipNormals Flip normals of these surfaces
 			@param enNormalType The method used for normal generation on surfaces of this channel
+			@param bOptimizeVertexCache Whether extracted triangle lists are reordered for the post-transform vertex cache
+			@param nSurfaceNetsLODBegin First level of detail extracted with Surface Nets instead of Transvoxel
+			@param nSurfaceNetsLODEnd Level of detail past the last one extracted with Surface Nets, equal to the first to disable Surface Nets
+			@param nDecimationLOD The first level of detail whose triangle lists are decimated, NoDecimation to disable decimation
+			@param fDecimationMaxError Greatest error of an edge collapse when decimating, the sum of squared distances in voxels
+			@param bWideIndices Whether the hardware index buffers of this channel have 32-bit indices
 			*/
 			ChannelParameters(
 				const Real fTCWidthRatio = 0.5f,
@@ -103,14 +130,61 @@ namespace Ogre
 				const unsigned short nLODCount = 5,
 				const Real fMaxPixelError = 8,
 				const bool bFlipNormals = false,
-				const NormalsType enNormalType = NT_None
+				const NormalsType enNormalType = NT_None,
+				const bool bOptimizeVertexCache = false,
+				const unsigned short nSurfaceNetsLODBegin = 0,
+				const unsigned short nSurfaceNetsLODEnd = 0,
+				const unsigned short nDecimationLOD = NoDecimation,
+				const Real fDecimationMaxError = 0,
+				const bool bWideIndices = false
 			);
 			~ChannelParameters();
 
+			/// @returns True if surfaces of this channel are extracted with Surface Nets at the specified level of detail
+			inline bool surfaceNets (const unsigned nLOD) const { return nLOD >= surfaceNetsLODBegin && nLOD < surfaceNetsLODEnd; }
+			/// @returns True if normals of this channel are averaged from the faces of the surrounding triangles
+			inline bool averagedNormals () const { return normalsType == NT_WeightedAverage || normalsType == NT_Average; }
+			/// @returns True if triangle lists of this channel are decimated at the specified level of detail
+			inline bool decimation (const unsigned nLOD) const { return nLOD >= decimationLOD; }
+
 		private:
 			static TransitionCellTranslators * createTransitionCellTranslators(const unsigned short nLODCount, const Real fTCWidthRatio);
 		};
 
+		/// The stages of extracting a surface that are timed separately
+		enum Stage
+		{
+			/// Classifying regular and transition cells by their case codes
+			Stage_CaseCodes = 0,
+			/// Computing the regular and transition refinements
+			Stage_Refinements,
+			/// Configuring and marshaling iso-vertices for the hardware buffer
+			Stage_Marshal,
+			/// Assembling, decimating and reordering triangles
+			Stage_Triangulate,
+			/// Staging vertices and indices in the layout of the hardware buffers
+			Stage_QueueFill,
+
+			CountStages
+		};
+
+		/// Extraction measurements accumulated by a builder
+		struct ExtractionStatistics
+		{
+			/// Number of surfaces built
+			size_t builds;
+			/// Number of builds replayed from the build cache rather than extracted
+			size_t replays;
+			/// Number of cells at the resolutions of the surfaces built
+			size_t cells;
+			/// Number of iso-vertices shipped to the hardware buffer and triangles extracted respectively
+			size_t vertices, triangles;
+			/// Cumulative time in microseconds spent in each stage
+			uint64 stages[CountStages];
+
+			ExtractionStatistics () : builds(0), replays(0), cells(0), vertices(0), triangles(0) { std::fill(stages, stages + CountStages, uint64(0)); }
+		};
+
 #if defined(_DEBUG) || defined(_OHT_LOG_TRACE)
 		class DebugInfo
 		{
@@ -125,10 +199,16 @@ namespace Ogre
 		/**
 		@param cubemeta The meta-information singleton that describes all cubical voxel regions in a scene
 		@param chanopts The channel options index describing surfaces in all channels
+		@param nSlabs The number of Z slabs a cube is split into for extracting a single surface on several threads, one extracts serially
+		@param pBuildCache Cache of finished builds shared with other builders, NULL to always extract
+		@param pSlabWorkers Threads shared with other builders that run the slabs, NULL to run the slabs in order on the calling thread
 		*/
 		IsoSurfaceBuilder(
 			const Voxel::CubeDataRegionDescriptor & cubemeta, 
-			const Channel::Index< ChannelParameters > & chanparams
+			const Channel::Index< ChannelParameters > & chanparams,
+			const size_t nSlabs = 1,
+			BuildCache * pBuildCache = NULL,
+			SlabWorkers * pSlabWorkers = NULL
 		);
 
 		virtual ~IsoSurfaceBuilder();
@@ -139,6 +219,36 @@ namespace Ogre
 		*/
 		static size_t genSurfaceFlags( const OverhangTerrainOptions::ChannelOptions & chanopts );
 
+		/** Determines the voxel channels read when building surfaces of a channel
+		@param channel The channel the surfaces belong to
+		@param nSurfaceFlags Flags determining what kind of vertex properties are generated
+		@returns A combination of Voxel::DataBase::Channels, texture coordinates are never read */
+		size_t getLeaseChannels( const Channel::Ident channel, const size_t nSurfaceFlags ) const;
+
+		/** Retrieves the vertex cache measurements accumulated by this builder since the last call and resets them
+		@remarks Only triangles of channels that optimize the vertex cache are measured, misses are counted with a simulated FIFO cache
+		@param nTriangles (out) Number of triangles reordered
+		@param nMissesBefore (out) Number of vertex cache misses of the triangles in the order they were extracted
+		@param nMissesAfter (out) Number of vertex cache misses of the triangles in optimized order
+		*/
+		void takeVertexCacheStatistics (size_t & nTriangles, size_t & nMissesBefore, size_t & nMissesAfter);
+
+		/** Retrieves the decimation measurements accumulated by this builder since the last call and resets them
+		@remarks Only triangle lists of levels of detail that are decimated are measured
+		@param nTrianglesBefore (out) Number of triangles extracted before decimation
+		@param nTrianglesAfter (out) Number of triangles remaining after decimation
+		@param nCollapses (out) Number of edges collapsed
+		@param fMaxError (out) Greatest error of a single edge collapse
+		@param fTotalError (out) Summed error of all edge collapses
+		*/
+		void takeDecimationStatistics (size_t & nTrianglesBefore, size_t & nTrianglesAfter, size_t & nCollapses, Real & fMaxError, Real & fTotalError);
+
+		/** Retrieves the extraction measurements accumulated by this builder since the last call and resets them
+		@remarks Stages are timed with a high-resolution timer, rendering is not involved so builders can be measured headless
+		@param stats (out) Receives the number of cells, iso-vertices and triangles extracted and the time spent in each stage
+		*/
+		void takeExtractionStatistics (ExtractionStatistics & stats);
+
 		/** Performs a ray query on the specified surface in the specified channel
 		@remarks Performs a ray query on the surface represented by pShadow and stores the result in walker
 		@param limit Limit of the ray query relative to the beginning of the isosurface
@@ -160,6 +270,29 @@ namespace Ogre
 			const Touch3DFlags enTouchFlags
 		);
 
+		/** Performs a ray query directly on the voxel field of the specified surface
+		@remarks Marches the ray cell by cell at the resolution of the level of detail, cells whose eight corners share the same sign 
+			are rejected outright and otherwise the first root of the trilinear interpolation of the corners along the segment of the 
+			ray within the cell is sought.  The interpolation agrees with the rendered surface along the edges of the cell, inside 
+			the cell and within transition cells the two deviate by less than the cell.  Neither triangles nor the hardware shadow 
+			are involved, so this does not need a builder and may be called from any thread.
+		@param limit Limit of the ray query relative to the beginning of the isosurface
+		@param pDataGrid The cube voxel region that occupies the space of the surface
+		@param ray Ray in voxel cube space relative to the voxel cube's position
+		@param nLOD The LOD to test the surface, affects the size of the cells interrogated
+		@param fTolerance Greatest error in voxels along the ray of the intersection found relative to the interpolated field
+		@param pValues The voxel values of pDataGrid already leased or copied by the caller or NULL to lease them for the duration of the query
+		@returns True and the distance from the ray origin that intersected if there was an intersection, false otherwise
+		*/
+		static std::pair< bool, Real > rayQueryField (
+			const Real limit,
+			const Voxel::CubeDataRegion * pDataGrid, 
+			const Ray & ray, 
+			const unsigned nLOD, 
+			const Real fTolerance,
+			const FieldStrength * pValues = NULL
+		);
+
 		/** Builds an isosurface
 		@remarks Extracts an isosurface from a voxel cube region and updates the specified surface when finished
 		@param pCube The voxel cube data to extract the surface from
@@ -188,8 +321,31 @@ namespace Ogre
 			const size_t nVertexBufferCapacity 
 		);
 
+		/** Builds several configurations of an isosurface at once and queues the data for later propagation to GPU
+		@remarks Extracts every configuration from a single lease of the voxel cube region and queues all of them in the same batch,
+			the first configuration is the primary one of the batch and the others are its siblings.  Configurations that no longer
+			fit the current capacity of the GPU vertex buffer after the ones before them are left for a later request.  Regular 
+			triangulation cases are classified once per LOD, configurations of the same LOD that differ only in stitching share them, 
+			and the cells of every LOD are classified from case codes computed once at LOD 0 for the whole batch.  Each configuration is replayed from or 
+			retained in the build cache on its own.  It is the caller's responsibility to manually propagate the data from 
+			the queue to the GPU hardware.  This may only be called by the OverhangTerrainGroup.
+		@param pMF The meta-fragment that contains the voxel cube data to extract the surface from, its life-cycle must persist for the concurrent extraction workflow here.
+		@param pShadow The hardware shadow of the corresponding renderable, hosts the queue for data that will be propagated to the GPU in the main thread
+		@param channel The channel of the surface
+		@param configs The LOD and stitch configurations to build, there must be at least one
+		@param nSurfaceFlags Flags determining what kind of vertex properties are supported by the hardware buffer for this channel
+		@param nVertexBufferCapacity The current capacity of the GPU vertex buffer, used to determine if it must be resized post-surface-generation */
+		void queueBuild( 
+			const MetaFragment::Container * pMF, 
+			SharedPtr< HardwareShadow::HardwareIsoVertexShadow > pShadow, 
+			const Channel::Ident channel, 
+			const HardwareShadow::ConfigurationList & configs, 
+			const size_t nSurfaceFlags, 
+			const size_t nVertexBufferCapacity 
+		);
+
 	protected:
-		/// The algorithm for extracting isosurfaces
+		/// The algorithm for extracting isosurfaces, the voxels are leased unless pData already provides access to them
 		void buildImpl(
 #if defined(_DEBUG) || defined(_OHT_LOG_TRACE)
 			const DebugInfo & debugs,
@@ -200,14 +356,84 @@ namespace Ogre
 			SharedPtr< HardwareShadow::HardwareIsoVertexShadow > & pShadow, 
 			const size_t nSurfaceFlags,
 			const Touch3DFlags enStitches, 
-			const size_t nVertexBufferCapacity
+			const size_t nVertexBufferCapacity,
+			Voxel::const_DataAccessor * pData = NULL
 		);
 
 	private:
 		OGRE_MUTEX(mMutex);
 
-		/// Populate the queue with information stored in this object
-		void fillShadowQueues( HardwareShadow::HardwareIsoVertexShadow::ProducerQueueAccess & queue, const Real fVertScale );
+		/** Stage the vertices and triangles stored in this object in the layout of the hardware buffers
+		@remarks New vertices are appended to the vertices of the arena, rewritten ones to its patches in the order of the remaps
+		@param staging The arena to append to, its vertex and index sizes describe the layout of the hardware buffers
+		@param indexRange Receives the range of staged triangle indices
+		@param pFactory The factory of the channel, describes the layout of the hardware vertex buffer
+		@param fVertScale Scale of vertex positions */
+		void stageBuffers( 
+			HardwareShadow::StagingArena & staging, 
+			HardwareShadow::BuilderQueue::IndexRange & indexRange, 
+			const Voxel::MetaVoxelFactory * pFactory, 
+			const Real fVertScale 
+		);
+
+		/** Stage the information stored in this object in the layout of the hardware buffers and append it to the queue
+		@param queue The batch to append vertex information to
+		@param indexRange Receives the range of staged triangle indices of the configuration just built, either that of the batch or of one of its siblings
+		@param pFactory The factory of the channel, describes the layout of the hardware vertex buffer
+		@param fVertScale Scale of vertex positions */
+		void fillShadowQueues( 
+			HardwareShadow::HardwareIsoVertexShadow::ProducerQueueAccess & queue, 
+			HardwareShadow::BuilderQueue::IndexRange & indexRange, 
+			const Voxel::MetaVoxelFactory * pFactory, 
+			const Real fVertScale 
+		);
+
+		/** Stages a cached configuration in the queue in lieu of extracting it and restores the shadow meta data of its resolution
+		@remarks The vertices of the entry are appended to those already in the hardware vertex buffer, an iso-vertex that is already
+			mapped to a hardware vertex is not appended again.  When the entry does not fit the rest of the vertex buffer the primary
+			configuration starts both hardware buffers over whereas a sibling is left for a later request.
+		@param queue The batch to stage the configuration in
+		@param vertices The vertices of the batch so far, updated with the vertices appended
+		@param pResolution The resolution of the configuration
+		@param enStitches The sides of the configuration with transition cells
+		@param entry The cached configuration
+		@param bPrimary Whether the configuration is the primary one of the batch
+		@param nVertexBufferCapacity The total number of vertices the hardware vertex buffer can hold
+		@returns False if the configuration was not staged because it does not fit */
+		bool replayBuild( 
+			HardwareShadow::HardwareIsoVertexShadow::ProducerQueueAccess & queue, 
+			HardwareShadow::Vertices & vertices, 
+			HardwareShadow::LOD * pResolution, 
+			const Touch3DFlags enStitches, 
+			const BuildCache::Entry & entry, 
+			const bool bPrimary, 
+			const size_t nVertexBufferCapacity 
+		);
+		/** Retains a configuration just staged in the queue in the cache
+		@remarks The vertices referenced by the configuration are copied and renumbered from zero in the order they are first 
+			referenced, a configuration referencing vertices that were batched to the GPU before is not retained.
+		@param key Identifies the voxel content and configuration the build was extracted from
+		@param queue The batch of the configuration, it must not patch any vertices already in the hardware buffer
+		@param pResolution The resolution of the configuration
+		@param indices The range of staged triangle indices of the configuration
+		@param nBatchBase Index of the hardware vertex of the first vertex staged in the batch */
+		void retainBuild( 
+			const BuildCache::Key & key, 
+			const HardwareShadow::HardwareIsoVertexShadow::ProducerQueueAccess & queue, 
+			const HardwareShadow::LOD * pResolution, 
+			const HardwareShadow::BuilderQueue::IndexRange & indices, 
+			const size_t nBatchBase 
+		);
+		/** Samples the voxels of the neighbouring regions one layer beyond each side of the cube
+		@remarks Only sampled when the channel computes normals from central differences, so that both cubes sharing a side 
+			compute identical differences at the voxels of that side and the shading is seamless.  Forgets the samples of the last build.
+			A fragment whose sampled voxels change marks the sides of its neighbours dirty so that they are patched, see 
+			MetaFragment::Core::invalidateNeighborHalos.
+		@param pMF The meta-fragment about to be built
+		@param channel The channel of the meta-fragment
+		@param nSurfaceFlags Flags determining what kind of vertex properties are generated
+		@returns A hash of the samples that is zero if none were taken, builds with the same voxels but different neighbours differ */
+		unsigned long long sampleHalo( const MetaFragment::Container * pMF, const Channel::Ident channel, const size_t nSurfaceFlags );
 
 		/// The index of per-channel parameters
 		Channel::Index< ChannelParameters > _chanparams;
@@ -301,8 +527,8 @@ namespace Ogre
 			/// Changes the location of this grid cell to the one at the specified index
 			inline void operator = (const CellIndex idx)
 			{
-				// TODO: Profile, this may not be as efficient as placing it at class member-level
-				static GridCellCoords gcc(0);	// DEPS: Single-threaded
+				// Stack-local, builders run concurrently on multiple worker threads
+				GridCellCoords gcc(0);
 				
 				_cubemeta.computeGridCell(gcc, idx);
 				operator = (gcc);
@@ -413,6 +639,64 @@ namespace Ogre
 			}
 		};
 
+		/** Computes the case codes for an entire row of grid-cells along the x-axis in one pass
+		@remarks The sign-bits of the four rows of voxels bounding the row of cells are combined for many cells at once
+			using SSE2 (or AVX2) where available and scalar code otherwise.  Rows sampled at a LOD greater than zero are first
+			gathered so that their samples are contiguous, hence the same kernel applies to every LOD. */
+		class RegularCaseRowCompiler
+		{
+		private:
+			/// The meta-information singleton describing all cubical voxel regions in the scene
+			const Voxel::CubeDataRegionDescriptor & _cdrd;
+			/// Contiguous copies of the four rows of voxels bounding a row of cells, used for LOD > 0
+			FieldStrength _vSamples[4][Voxel::MAX_DIM + 1];
+
+			/** Computes the case codes for a row of cells from four contiguous rows of voxels
+			@param r00 Voxels at (y, z) of the row of cells
+			@param r10 Voxels at (y + 1, z) of the row of cells
+			@param r01 Voxels at (y, z + 1) of the row of cells
+			@param r11 Voxels at (y + 1, z + 1) of the row of cells
+			@param nCells The number of cells in the row, each row of voxels must have one more element than this
+			@param vCaseCodes (out) Receives the case code of every cell in the row
+			@param vNonTrivials (out) Receives the ordinals of the cells in the row that have a nontrivial case code
+			@returns The number of cells in the row that have a nontrivial case code */
+			static size_t compile (
+				const FieldStrength * r00, 
+				const FieldStrength * r10, 
+				const FieldStrength * r01, 
+				const FieldStrength * r11, 
+				const size_t nCells, 
+				NonTrivialRegularCase::CodeType * vCaseCodes, 
+				DimensionType * vNonTrivials
+			);
+
+		public:
+			/// Case codes of every cell in the most recently compiled row
+			NonTrivialRegularCase::CodeType casecodes[Voxel::MAX_DIM];
+			/// Ordinals of the cells in the most recently compiled row that have a nontrivial case code
+			DimensionType nontrivials[Voxel::MAX_DIM];
+
+			RegularCaseRowCompiler(const Voxel::CubeDataRegionDescriptor & cdrd);
+
+			/** Computes the case codes for the row of cells at the specified coordinates
+			@param values The voxel values of the cube region
+			@param y The y-coordinate of the row of cells
+			@param z The z-coordinate of the row of cells
+			@param nLOD The LOD determining the size of the cells
+			@returns The number of cells in the row that have a nontrivial case code, each of these is listed in 'nontrivials' */
+			size_t compile (const FieldStrength * values, const DimensionType y, const DimensionType z, const unsigned short nLOD);
+
+			/** Derives the case codes for the row of cells at the specified coordinates from the case codes of the finest cells
+			@remarks Each corner of a coarse cell is also the like corner of the finest cell sharing it, so the sign bits are 
+				gathered from those cells without sampling the voxels again
+			@param vCaseCodes0 Case codes of every cell of the cube region at LOD 0 ordered by X, then Y, then Z
+			@param y The y-coordinate of the row of cells
+			@param z The z-coordinate of the row of cells
+			@param nLOD The LOD determining the size of the cells
+			@returns The number of cells in the row that have a nontrivial case code, each of these is listed in 'nontrivials' */
+			size_t derive (const NonTrivialRegularCase::CodeType * vCaseCodes0, const DimensionType y, const DimensionType z, const unsigned short nLOD);
+		};
+
 		/** Iterates through all cells and voxel points of each cell throughout a 3D voxel grid by iterating through
 			all corners of each grid-cell and then iterating to the next grid-cell until all grid-cells have been visited
 			in the voxel-grid */
@@ -716,8 +1000,8 @@ namespace Ogre
 			/// Updates this transition cell's position with the specified cell index
 			inline void operator = (const CellIndex idx)
 			{
-				x = (unsigned short)idx % _cubemeta.dimensions;
-				y = (unsigned short)idx / _cubemeta.dimensions;
+				x = uint32(idx) % _cubemeta.dimensions;
+				y = uint32(idx) / _cubemeta.dimensions;
 			}
 
 			struct CaseCodeResult
@@ -731,9 +1015,10 @@ namespace Ogre
 			friend Ogre::Log::Stream & operator << (Ogre::Log::Stream &, const TransitionCell &);
 		};
 
-		/** Provides the correct-order for triangle vertices of a given transition cell case.
-		@remarks Once a transition cell case has been queried using the '<<' operator overload,
-			the '[]' operator overload is used to determine the vertex at an index [0,3).
+		/** Provides the correct-order for triangle vertices of transition cells on a given side.
+		@remarks The '[]' operator overload is used to determine the vertex at an index [0,3).
+			Winding of cases whose inverse state maps to the equivalence class is already reversed
+			in the Transvoxel case records, so the order is a function of the side alone.
 			This class is used by TransitionTriangleBuilder.
 		*/
 		class TriangleWinder
@@ -743,8 +1028,6 @@ namespace Ogre
 			OrthogonalNeighbor _on;
 			/// Flags, function of the side
 			signed char _onwn;
-			/// Flags, function of the side and transition cell case
-			signed int _rwoo;
 
 		public:
 			/** 
@@ -752,54 +1035,51 @@ namespace Ogre
 			*/
 			TriangleWinder(const OrthogonalNeighbor on);
 
-			/// Queries a particular transition cell case
-			inline
-			void operator << (const NonTrivialTransitionCase & caze)
-			{
-				const signed char cTranCellClass = transitionCellClass[caze.casecode];
-				_rwoo = ((((cTranCellClass | (cTranCellClass >> 1)) >> 6)) & 3) ^ _onwn;	// Reverses winding-order if transition cell-class id has high-bit set
-			}
-
-			/** After a query for a particular transition cell case 
+			/** 
 			@param nIndex Triangle vertex number, allowed range [0,3)
 			*/
 			inline
 			size_t operator [] (const size_t nIndex) const
 			{
-				return (nIndex ^ _rwoo) - (_rwoo & 1);
+				return (nIndex ^ _onwn) - (_onwn & 1);
 			}
 		};
 
+		/// Retrieves the Transvoxel case record for the given regular case
+		static inline
+		const RegularCaseData & getCaseData(const NonTrivialRegularCase & caze)
+		{
+			return regularCaseData[caze.casecode];
+		}
+		/// Retrieves the Transvoxel case record for the given transition case
+		static inline
+		const TransitionCaseData & getCaseData(const NonTrivialTransitionCase & caze)
+		{
+			return transitionCaseData[caze.casecode];
+		}
 		/// Retrieves the Transvoxel regular vertex data for the given regular case
 		static inline 
 		const unsigned short * getVertexData(const NonTrivialRegularCase & caze)
 		{
-			return regularVertexData[caze.casecode];
+			return getCaseData(caze).vertexData;
 		}
 		/// Retrieves the Transvoxel transition vertex data for the given transition case
 		static inline 
 		const unsigned short * getVertexData(const NonTrivialTransitionCase & caze)
 		{
-			return transitionVertexData[caze.casecode];
+			return getCaseData(caze).vertexData;
 		}
 		/// Retrieves the number of vertices for the given regular case
 		static inline
 		const unsigned int getVertexCount(const NonTrivialRegularCase & caze)
 		{
-			const RegularCellData & oCase = regularCellData[regularCellClass[caze.casecode]];
-			const long nVertCount = oCase.GetVertexCount();
-
-			return nVertCount;
+			return getCaseData(caze).GetVertexCount();
 		}
 		/// Retrieves the number of vertices for the given transition case
 		static inline
 		const unsigned int getVertexCount(const NonTrivialTransitionCase & caze)
 		{
-			const signed char cTranCellClass = transitionCellClass[caze.casecode];
-			const TransitionCellData & oCase = transitionCellData[cTranCellClass & 0x7F];	// High-bit must be cleared
-			const long nVertCount = oCase.GetVertexCount();
-
-			return nVertCount;
+			return getCaseData(caze).GetVertexCount();
 		}
 
 		/// Represents the state of the hardware buffer of the currently associated surface
@@ -830,12 +1110,81 @@ namespace Ogre
 		/// The LOD of the data represented in here
 		size_t _nLOD;
 
+		/// Sign occupancy of the region being built, used to skip homogeneous blocks of cells
+		Voxel::SignOccupancy _occupancy;
+
+		/// Voxels that changed since the current resolution was last built grown by one to account for gradients, null unless patching
+		CellRegion _dirtyVoxels;
+
+		/// Cells of the current resolution that share a grid point with the dirty voxels, these are re-triangulated when patching
+		CellRegion _dirtyCells;
+
+		/// Voxels that changed since hardware vertices were last batched grown by one to account for gradients, null unless stale vertices must be evicted
+		CellRegion _staleVoxels;
+
+		/// Non-trivial regular triangulation cases of the dirty cells in cell index order
+		RegularTriangulationCaseList _vDirtyRegCases;
+
+		/// Hardware vertices whose iso-vertices were evicted when patching, they are reoccupied by new iso-vertices before any are appended
+		std::vector< HWVertexIndex > _vFreeHWVertices;
+
 		/// Whether the hardware vertex state must be reset before applying new vertices
 		bool _bResetVertexBuffer;
 
 		/// Whether the hardware index state must be reset before applying new vertices
 		bool _bResetIndexBuffer;
 
+		/// Staging storage of synchronous builds, retains its capacity between builds
+		HardwareShadow::StagingArena _staging;
+
+		/// Reorders triangle lists for the post-transform vertex cache
+		VertexCacheOptimizer _vco;
+		/// Scratch space for optimizing triangle order, the hardware indices of the triangles and their optimized order respectively
+		std::vector< HWVertexIndex > _vCacheIndices;
+		std::vector< size_t > _vTriangleOrder;
+		/// Scratch space receiving the reordered triangles
+		IsoTriangleVector _vReorderedTriangles;
+		/// Vertex cache measurements accumulated since they were last taken
+		size_t _nCacheTriangles, _nCacheMissesBefore, _nCacheMissesAfter;
+
+		/// Addresses cells and enumerates quads for levels of detail extracted with Surface Nets
+		SurfaceNets _nets;
+
+		/// Simplifies triangle lists of levels of detail that are decimated
+		MeshDecimator _decimator;
+		/// Scratch space for decimation, the distinct iso-vertices of the triangles in ascending order and their positions and locks respectively
+		IsoVertexVector _vDecimationVertices;
+		std::vector< Vector3 > _vDecimationPositions;
+		std::vector< bool > _vDecimationLocked;
+		/// Scratch space for decimation, the triangles as ordinals of the distinct iso-vertices
+		std::vector< size_t > _vDecimationIndices;
+		/// Decimation measurements accumulated since they were last taken
+		size_t _nDecimationTrianglesBefore, _nDecimationTrianglesAfter, _nDecimationCollapses;
+		Real _fDecimationMaxError, _fDecimationTotalError;
+
+		/// Times the extraction stages
+		Timer _timer;
+		/// Extraction measurements accumulated since they were last taken
+		ExtractionStatistics _extractstats;
+
+		/// Finished builds shared by all builders of the pool, NULL if builds are not cached
+		BuildCache * const _pBuildCache;
+
+		/// Adds the time elapsed during its lifetime to the accumulated time of an extraction stage
+		class StageTimer
+		{
+		private:
+			Timer & _timer;
+			uint64 & _nAccum;
+			const unsigned long _nStart;
+
+			StageTimer & operator = (const StageTimer &);
+
+		public:
+			StageTimer (Timer & timer, uint64 & nAccum) : _timer(timer), _nAccum(nAccum), _nStart(timer.getMicroseconds()) {}
+			~StageTimer () { _nAccum += _timer.getMicroseconds() - _nStart; }
+		};
+
 		/// Reference-counted shared pointer to the data grid associated with this isosurface.
 		const Voxel::CubeDataRegionDescriptor & _cubemeta;
 
@@ -1093,9 +1442,49 @@ namespace Ogre
 		IsoVertexIndexRefiner< GridCell::CornerLocator, GridPointCoords >
 			_rgrefiner;
 
+		/// Computes case codes for whole rows of regular cells at once
+		RegularCaseRowCompiler _rowccc;
+
+		/// Case codes of every cell of the cube region at LOD 0, shared by all levels of detail of a batch
+		std::vector< NonTrivialRegularCase::CodeType > _vCaseCodes0;
+		/// Whether the levels of detail of the current batch share case codes computed at LOD 0
+		bool _bShareCaseCodes;
+		/// Whether '_vCaseCodes0' reflects the voxels of the current batch
+		bool _bCaseCodes0;
+
+		/** A portion of a cube bounded along the Z-axis whose regular cells are processed on their own thread during intra-cube parallel 
+			extraction, each slab owns the scratch state that the builder would otherwise use for the whole cube */
+		class Slab
+		{
+		public:
+			/// Grid-cell Z-coordinates bounding the slab, lower inclusive and upper exclusive
+			DimensionType z0, zN;
+			/// Non-trivial regular cases attained for the slab in the same order as the serial path
+			RegularTriangulationCaseList cases;
+			/// The slab's portion of the regular cases of the current resolution
+			RegularTriangulationCaseList::const_iterator begin, end;
+
+			/// Per-slab counterparts of the builder's row compiler and regular refiner
+			RegularCaseRowCompiler rowccc;
+			IsoVertexIndexRefiner< GridCell::CornerLocator, GridPointCoords > rgrefiner;
+
+			Slab(const Voxel::CubeDataRegionDescriptor & cdrd)
+				: z0(0), zN(0), rowccc(cdrd) {}
+		};
+
+		/// Slabs available for intra-cube parallel extraction, empty if disabled
+		std::vector< Slab * > _vpSlabs;
+		/// Number of slabs partitioning the cube at the current LOD, serial extraction unless greater than one
+		size_t _nSlabs;
+		/// Threads shared by all builders of the pool that run the slabs, NULL if slabs run in order on the calling thread
+		SlabWorkers * const _pSlabWorkers;
+		/// Fewest cells of the current LOD a slab should have, coarser levels of detail are split into fewer slabs or not at all
+		static const size_t MinSlabCells = 2048;
+
 		/** Computes the accurate iso-vertex index between two corner indices by continually sub-dividing the corner indices along a path defined
 			by the value of the mid-point between two corner indices until the distance between the two indices is highest resolution.  The two
 			corner indices and iso-vertex index is then based on this.
+		@param refiner The refiner to use, the builder's own or that of a slab
 		@param gc The current grid cell to refine from
 		@param data The voxel-grid for discretely sampling voxel values aiding refinement
 		@param vrecacc The Transvoxel vertex code of the pair, see figure 3.8b
@@ -1107,6 +1496,7 @@ namespace Ogre
 		@param gpc Receives the resultant most significant refined voxel grid coordinates
 		*/
 		void computeRefinedRegularIsoVertex (
+			IsoVertexIndexRefiner< GridCell::CornerLocator, GridPointCoords > & refiner,
 			const GridCell & gc, 
 			Voxel::const_DataAccessor & data, 
 			const VRECaCC & vrecacc, 
@@ -1168,6 +1558,8 @@ namespace Ogre
 				// Elements #9 and #10 have sub-array of CountOrthogonalNeighbors+CountMoore3DEdges
 				TransitionVertexGroupOffset * transition[10];
 				IsoVertexIndex regular[4];
+				// One isovertex per cell of every level of detail for Surface Nets, ~0 if no channel uses Surface Nets
+				IsoVertexIndex nets;
 			} _offsets;
 
 			// Regular edge-index for iso-vertex index multipliers
@@ -1221,8 +1613,10 @@ namespace Ogre
 			/// The meta-information singleton describing all voxel cube regions in the scene
 			const Voxel::CubeDataRegionDescriptor & _cubemeta;
 
-			/// Computes the total number of isovertex indices required by a voxel cube region
-			size_t computeTotalElements( const Voxel::CubeDataRegionDescriptor & dgtmpl );
+			/** Computes the total number of isovertex indices required by a voxel cube region
+			@param dgtmpl The meta-information singleton describing all voxel cube regions in the scene
+			@param bSurfaceNets Whether to include the Surface Nets cell vertices of every level of detail */
+			size_t computeTotalElements( const Voxel::CubeDataRegionDescriptor & dgtmpl, const bool bSurfaceNets );
 
 			/** Given a transition cell and vertex code, computes the 2D side coordinates
 			@remarks Applies to either full or half resolution isovertices
@@ -1321,18 +1715,19 @@ namespace Ogre
 
 		public:
 			/// Tracks collection of the transition vertex properties
-			BitSet trackFullOutsides;
+			GenerationalArray< bool > trackFullOutsides;
 
 			/** The following three LUTs are used to optionally map isovertices to other isovertices, which is relevant
 			during refinement and multi-resolution stitching.  They are in order described as:
 			- Regular-only isovertex index mappings to other isovertices
 			- Transition-only isovertex index mappings to other isovertices
 			- Isovertex refinements
+			@remarks Unmapped isovertices read as ~0, clearing them is constant-time
 			*/
-			IsoVertexIndex 
-				* const remappings,
-				* const trmappings,
-				* const refinements;
+			GenerationalArray< IsoVertexIndex >
+				remappings,
+				trmappings,
+				refinements;
 			
 			/// LUT for isovertex index to the voxel index pair that wraps the isovertex on either side of its axis
 			struct CellIndexPair
@@ -1342,8 +1737,10 @@ namespace Ogre
 
 			/** 
 			@param cubemeta The meta-information singleton describing all voxel cube regions in the scene
+			@param bWideIndices Whether any channel has 32-bit hardware indices
+			@param bSurfaceNets Whether any channel extracts some level of detail with Surface Nets
 			*/
-			MainVertexElements(const Voxel::CubeDataRegionDescriptor & cubemeta);
+			MainVertexElements(const Voxel::CubeDataRegionDescriptor & cubemeta, const bool bWideIndices, const bool bSurfaceNets);
 			~MainVertexElements();
 
 			void rollback();
@@ -1403,6 +1800,24 @@ namespace Ogre
 				);
 			}
 
+			/** Converts the ordinal of a Surface Nets cell vertex to an iso-vertex index
+			@param ordinal The ordinal of the cell vertex as determined by SurfaceNets::index
+			@returns The isovertex index of the cell vertex
+			*/
+			inline
+			IsoVertexIndex getNetVertexIndex( const size_t ordinal ) const
+			{
+				OgreAssert(_offsets.nets != IsoVertexIndex(~0), "No channel uses Surface Nets");
+				return _offsets.nets + IsoVertexIndex(ordinal);
+			}
+
+			/// @returns True if the iso-vertex is a Surface Nets cell vertex, its pair of corners then spans the diagonal of the box of its cell
+			inline
+			bool isNetVertex( const IsoVertexIndex ivi ) const
+			{
+				return _offsets.nets != IsoVertexIndex(~0) && ivi >= _offsets.nets;
+			}
+
 			/** Given a transition cell and transition vertex edge code, returns the isovertex index at that location
 			@remarks This determines the isovertex index by summing offset information through LUTs for the information
 				in the transition vertex code and by adding offsets from the location of the specified transition cell.
@@ -1666,7 +2081,8 @@ namespace Ogre
 			@param t The percentage distance between the two corner voxels where the vertex position shall be
 			@param corner0 Index of the first data grid value associated with the iso vertex
 			@param corner1 Index of the second data grid value associated with the iso vertex
-			@param dv Added to the position of the vertex */
+			@param dv Added to the position of the vertex
+			@param pGradients Central differences at corner0 and corner1 respectively if already computed, only applies to NT_CentralDifference */
 		void configureIsoVertex( 
 			IsoVertexElements * pVtxElems, 
 			const Voxel::CubeDataRegion * pDataGrid, 
@@ -1674,7 +2090,44 @@ namespace Ogre
 			const IsoVertexIndex nIsoVertexIdx, 
 			const IsoFixVec3::PrecisionType t, 
 			const VoxelIndex corner0, const VoxelIndex corner1, 
-			const IsoFixVec3 & dv = IsoFixVec3(signed short(0),signed short(0),signed short(0)) 
+			const IsoFixVec3 & dv = IsoFixVec3(signed short(0),signed short(0),signed short(0)),
+			const Vector3 * pGradients = NULL
+		);
+
+		/// Number of iso-vertices whose central differences are computed together when configuring regular iso-vertices
+		static const size_t CentralDifferenceBatch = 16;
+
+		/** Computes the central differences of the voxel values at a batch of voxels
+		@remarks Scaled like the gradients stored in the data grid (VRF_Gradient), along axes where a voxel is flush with a side of the 
+			cube the neighbouring region is sampled (see sampleHalo) or, at the edge of the world, the one-sided difference is doubled 
+			instead.  The voxels are sampled one at a time, the differences are computed several at a time with SIMD if available.
+		@param pValues The voxel values to sample
+		@param pCorners Indices of the voxels to compute the central differences at
+		@param nCount Number of voxels in the batch
+		@param pGradients (out) Receives the central differences at each voxel of the batch
+		*/
+		void computeCentralDifferences( const FieldStrength * pValues, const VoxelIndex * pCorners, const size_t nCount, Vector3 * pGradients ) const;
+
+		/// Voxels of the neighbouring regions one layer beyond each side of the cube (OrthogonalNeighbor), a square of grid points per side
+		std::vector< FieldStrength > _vHalo[CountOrthogonalNeighbors];
+		/// Whether the voxels beyond each side of the cube were sampled for the current build
+		bool _bHalo[CountOrthogonalNeighbors];
+		/// Sides of the cube (OrthogonalNeighbor) at the low and high end of each axis respectively
+		static const OrthogonalNeighbor AxisSides[3][2];
+
+		/** Configures the vertex of a Surface Nets cell in preparation for batching
+			@remarks Averages the attributes of the points where the surface crosses the edges of the cell, 
+				the position and any gradient normal, colour and texture coordinates alike.  Cells used only by seams may not be crossed
+				on their edges, the crossings of the edges half as long on their surface are averaged instead
+			@param pDataGrid Used to provide access to a vector basis for vertex positioning
+			@param data Access to the voxel grid for discrete voxel sampling
+			@param nIsoVertexIdx The isovertex index identifying the vertex element to configure
+			@param box Grid-point bounds of the cell */
+		void configureNetVertex( 
+			const Voxel::CubeDataRegion * pDataGrid, 
+			Voxel::const_DataAccessor & data, 
+			const IsoVertexIndex nIsoVertexIdx, 
+			const SurfaceNets::Box & box
 		);
 
 		/** Computes the percentage distance between two voxels that an isovertex should occur based on the two voxel values
@@ -1771,6 +2224,14 @@ namespace Ogre
 		*/
 		void computeRegularRefinements (Voxel::const_DataAccessor & data);
 
+		/** Populates the coarse/refined iso-vertex index LUT for the regular iso-vertices of a slab
+		@remarks Edges flush with the bottom of the slab are left to the slab beneath, so that no two slabs write the same element 
+			and every iso-vertex is refined from the same cell as in the serial path
+		@param data Voxel grid used for discrete sampling of voxels during refinement
+		@param slab The slab whose portion of the regular cases are refined
+		*/
+		void computeRegularRefinements (Voxel::const_DataAccessor & data, Slab & slab);
+
 		/** Populates the coarse/refined iso-vertex index LUT for regular iso-vertices
 		@remarks Computes the refined isovertex index for all isovertices in a regular grid cell
 		@param data Voxel grid used for discrete sampling of voxels during refinement
@@ -1818,9 +2279,103 @@ namespace Ogre
 		/// Configures and loads vertices into a shipping container
 		void marshalRegularVertexElements( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data );
 
+		/// Extracts the surface of a region that is not homogeneous, everything between setting-up and committing state in buildImpl
+		void extractSurface( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data, const size_t nVertexBufferCapacity );
+
+		/** Extracts the surface of a region that is not homogeneous with Surface Nets instead of Transvoxel
+		@remarks Cheaper for coarse levels of detail, no transition cells are inserted, stitched sides are spanned by seams instead
+		*/
+		void extractSurfaceNets( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data, const size_t nVertexBufferCapacity );
+
+		/** Builds the iso surface with Surface Nets from the linear array of regular cases previously attained, configuring cell vertices as they are first used
+		@remarks On stitched sides the quads of the edges in the side are replaced by seams across the edges of the next finer level of 
+			detail in the side.  A neighbour extracted with Surface Nets meets the seam at its virtual cells collapsed onto the side, a 
+			neighbour extracted with Transvoxel meets it at the refined regular iso-vertices of those edges joined as its regular cells 
+			join them.
+		*/
+		void triangulateNets( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data );
+
 		/// Loops through all the grid cells collecting non-trivial triangulation cases into a linear array
 		void attainRegularTriangulationCases( Voxel::const_DataAccessor & data );
 
+		/** Computes the case code of every cell of the cube region at LOD 0 once for all levels of detail of a batch
+		@remarks Rows within macro cells of uniform sign are filled with the trivial case code of that sign without being sampled
+		@param data Voxel grid used for discretely sampling voxels
+		*/
+		void classifyCells( Voxel::const_DataAccessor & data );
+
+		/** Collects non-trivial triangulation cases of all grid cells within a range of Z-coordinates
+		@param data Voxel grid used for discretely sampling voxels
+		@param z0 Z-coordinate of the first layer of cells
+		@param zN Z-coordinate just past the last layer of cells
+		@param rowccc Row compiler to use, the builder's own or that of a slab
+		@param cases Receives the non-trivial triangulation cases in cell index order
+		*/
+		void attainRegularTriangulationCases( 
+			Voxel::const_DataAccessor & data, 
+			const DimensionType z0, const DimensionType zN, 
+			RegularCaseRowCompiler & rowccc, 
+			RegularTriangulationCaseList & cases 
+		);
+
+		/// Splits the cube into Z slabs of whole cells at the current LOD, determines how many slabs are used by this build
+		void partitionSlabs();
+
+		/** Determines the dirty voxels and cells of the current resolution from the voxels that changed since it was last built
+		@param voxels The voxels that changed, null if the resolution is not being patched
+		@param stale The voxels that changed since hardware vertices were last batched, null if there are no stale vertices to evict
+		*/
+		void computeDirtyRegion( const CellRegion & voxels, const CellRegion & stale );
+
+		/// Replaces the cached non-trivial regular triangulation cases of the dirty cells with those of the current voxels
+		void reattainRegularTriangulationCases( Voxel::const_DataAccessor & data );
+
+		/// Unmaps hardware vertices of iso-vertices whose voxels are stale so they are configured again, freeing their hardware vertices and any holes for reuse
+		void evictIsoVertices();
+
+		/// Whether the hardware vertices left unoccupied after patching exceed a quarter of the hardware vertex buffer, which is then rebuilt compactly
+		inline bool fragmented () const { return _vFreeHWVertices.size() * 4 > _nVertexBufPos; }
+
+		/** Configures and loads the iso-vertices of the dirty cells into a shipping container, iso-vertices already in the hardware buffer are
+			rewritten in-place if their attributes depend on the surrounding triangles */
+		void marshalDirtyRegularVertexElements( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data );
+
+		/** Assigns a hardware vertex to an iso-vertex, reoccupying an evicted hardware vertex if there is one or otherwise appending to the shipment
+		@param ivi The iso-vertex, it must not already have a hardware vertex
+		@returns True if the iso-vertex was appended to the vertex shipment, false if it reoccupies an evicted hardware vertex
+		*/
+		bool shipIsoVertex( const IsoVertexIndex ivi );
+
+		/// Unmaps evicted hardware vertices that were not reoccupied, they become holes in the hardware vertex buffer
+		void releaseFreeHWVertices();
+
+		/// Reorders the triangles of the current configuration for locality in the post-transform vertex cache
+		void optimizeTriangleOrder();
+
+		/** Simplifies the triangles of the current configuration by quadric error edge collapse
+		@remarks Only the triangle list changes, iso-vertices that are collapsed keep their hardware vertices but are no longer referenced.
+			Iso-vertices flush with a side of the cube are locked, these include all iso-vertices of transition cells and those shared 
+			with neighbouring cubes, so that stitching remains crack-free.
+		@param pDataGrid The voxel region providing vertex positions of iso-vertices not configured by this build, Surface Nets cell 
+			vertices among them are configured now since their position is not that of a single edge crossing
+		@param data Voxel grid used for discretely sampling voxels
+		*/
+		void decimateTriangles( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data );
+
+		/** Runs a function for every slab of the current build concurrently on the shared slab workers, the first slab runs on the calling thread
+		@param fn Callback lambda function passing the slab ordinal as a formal parameter
+		*/
+		template< typename Fn >
+		void forEachSlab (Fn fn);
+
+		/** Configures regular iso-vertices already assigned hardware indices on separate threads
+		@remarks Attributes of an iso-vertex depend on nothing but its index, so the result is the same as configuring them in order
+		@param pDataGrid The voxel region providing vertex positions
+		@param data Voxel grid used for discretely sampling voxels
+		@param nFirst The first element of the vertex shipment to configure, all elements from here on are configured
+		*/
+		void configureRegularIsoVertices( const Voxel::CubeDataRegion * pDataGrid, Voxel::const_DataAccessor & data, const size_t nFirst );
+
 		/// Loops through all relevant (stitched) transition cells collecting non-trivial triangulation cases into a linear array
 		void attainTransitionTriangulationCases (Voxel::const_DataAccessor & data, OrthogonalNeighbor on);
 
@@ -1871,6 +2426,20 @@ namespace Ogre
 		@returns True if the ray intersected the triangle at some point, false if the ray does not intersect the triangle
 		*/
 		bool rayCollidesTriangle(Real * pDist, const Ray & ray, const IsoVertexIndex a, const IsoVertexIndex b, const IsoVertexIndex c) const;
+
+		/** Finds the first root of the trilinear interpolation of the corners of a cell along a line segment
+		@remarks Along a line the interpolation is a cubic polynomial, it is split into monotonic pieces at the roots of its derivative 
+			and the first piece whose ends differ in sign is bisected until the bracket is narrower than the resolution.
+		@param afCorners Values of the eight corners of the cell in the order of the regular cell corner indices
+		@param u0 Beginning of the segment in coordinates local to the cell ranging from zero to one
+		@param u1 End of the segment in coordinates local to the cell ranging from zero to one
+		@param fResolution Greatest width of the final bracket relative to the length of the segment
+		@param fRoot (out) Receives the position of the root along the segment ranging from zero to one
+		@returns True if the sign of the interpolation changes somewhere along the segment
+		*/
+		static bool findTrilinearRoot (const Real afCorners[8], const Vector3 & u0, const Vector3 & u1, const Real fResolution, Real & fRoot);
+		/// Computes the trilinear interpolation of the corners of a cell at the specified coordinates local to the cell
+		static inline Real interpolateTrilinear (const Real afCorners[8], const Vector3 & u);
 		
 // Temporary for debugging until this stitching thing works
 #if defined(_DEBUG) || defined(_OHT_LOG_TRACE)
@@ -1973,7 +2542,7 @@ namespace Ogre
 				c0, c1, 
 				_pMainVtxElems->getTouch3DSide(tc.side, rside, ei)
 			);
-			_pMainVtxElems->trackFullOutsides[coarse] = 1;
+			_pMainVtxElems->trackFullOutsides.set(coarse, true);
 		}
 	}
 
@@ -2089,11 +2658,11 @@ namespace Ogre
 		{
 			IsoVertexIndex ivi;
 			computeRefinedRegularIsoVertex(
-				gc, data, vrecacc, ei, c0, c1, _nLOD, 
+				_rgrefiner, gc, data, vrecacc, ei, c0, c1, _nLOD, 
 				ivi, 
 				gpc
 			);
-			_pMainVtxElems->refinements[coarse] = ivi;
+			_pMainVtxElems->refinements.set(coarse, ivi);
 			fn(coarse, ivi, c0, c1, _nLOD);
 		}
 	}
@@ -2139,7 +2708,7 @@ namespace Ogre
 				csc
 			);
 			OHT_ISB_DBGTRACE("Transition Refinement: " << coarse << " -> " << ivi << ", vertex pair={" << c0 << '/' << getWorldPos(_cubemeta.getVertices()[c0]) << 'x' << c1 << '/' << getWorldPos(_cubemeta.getVertices()[c1]) << "}");
-			_pMainVtxElems->refinements[coarse] = ivi;
+			_pMainVtxElems->refinements.set(coarse, ivi);
 			fn(coarse, ivi, vrecacc.getType(), c0, c1, _pMainVtxElems->getTouch3DSide(tc.side, rside, ei));
 		}
 	}
@@ -2160,6 +2729,20 @@ namespace Ogre
 		);
 	}
 
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	template< typename Fn >
+	void IsoSurfaceBuilder::forEachSlab( Fn fn )
+	{
+		if (_pSlabWorkers == NULL)
+		{
+			for (size_t s = 0; s < _nSlabs; ++s)
+				fn(s);
+		} else
+			_pSlabWorkers->run(_nSlabs, [&fn] (const size_t s) { fn(s); });
+	}
+
 #ifdef _DEBUG
 	#pragma optimize("gtpy", on)
 #endif
@@ -2175,5 +2758,21 @@ namespace Ogre
 		return t;
 	}
 
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	inline Real IsoSurfaceBuilder::interpolateTrilinear( const Real afCorners[8], const Vector3 & u )
+	{
+		const Real
+			x00 = afCorners[0] + (afCorners[1] - afCorners[0]) * u.x,
+			x10 = afCorners[2] + (afCorners[3] - afCorners[2]) * u.x,
+			x01 = afCorners[4] + (afCorners[5] - afCorners[4]) * u.x,
+			x11 = afCorners[6] + (afCorners[7] - afCorners[6]) * u.x,
+			y0 = x00 + (x10 - x00) * u.y,
+			y1 = x01 + (x11 - x01) * u.y;
+
+		return y0 + (y1 - y0) * u.z;
+	}
+
 }/// namespace Ogre
 #endif //_ISO_SURFACE_BUILDER_H_
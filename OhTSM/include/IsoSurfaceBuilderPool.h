@@ -0,0 +1,196 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#ifndef __OHTISOSURFACEBUILDERPOOL_H__
+#define __OHTISOSURFACEBUILDERPOOL_H__
+
+#include "OverhangTerrainPrerequisites.h"
+#include "OverhangTerrainOptions.h"
+
+#include <vector>
+#include <ostream>
+
+#include <boost/thread.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+namespace Ogre
+{
+	/** A fixed-size pool of isosurface builders, one for each thread that may extract surfaces concurrently.
+	@remarks Each builder owns its own scratch space (vertex elements, refinements, mappings) so independent 
+		meta-fragments can be extracted in parallel on separate worker threads.  All builders are allocated 
+		up-front in the main thread, when the pool is exhausted a lease blocks until another thread retires one. */
+	class _OverhangTerrainPluginExport IsoSurfaceBuilderPool
+	{
+	public:
+		/** Snapshot of pool usage for measuring extraction throughput */
+		class _OverhangTerrainPluginExport Statistics
+		{
+		public:
+			/// The number of builders managed by the pool
+			size_t capacity;
+			/// The maximum number of builders that were simultaneously checked-out of the pool
+			size_t peak;
+			/// The number of leases retired since the statistics were last reset that extracted surfaces
+			size_t builds;
+			/// The number of leases retired since the statistics were last reset that only replayed builds from the build cache
+			size_t replays;
+			/// Cumulative time in microseconds that builders spent checked-out of the pool
+			uint64 busy;
+			/// Time in microseconds elapsed since the statistics were last reset
+			uint64 elapsed;
+			/// Number of triangles reordered for the post-transform vertex cache
+			size_t cacheTriangles;
+			/// Simulated vertex cache misses of the reordered triangles before and after optimization respectively
+			size_t cacheMissesBefore, cacheMissesAfter;
+			/// Number of triangles of decimated levels of detail before and after decimation respectively
+			size_t decimationTrianglesBefore, decimationTrianglesAfter;
+			/// Number of edges collapsed by decimation
+			size_t collapses;
+			/// Greatest and summed error of the edges collapsed respectively
+			Real collapseMaxError, collapseTotalError;
+			/// Number of surfaces extracted and number of cells at their resolutions respectively
+			size_t surfaces, cells;
+			/// Number of iso-vertices shipped to hardware buffers and triangles extracted respectively
+			size_t vertices, triangles;
+			/// Cumulative time in microseconds spent classifying cells, computing refinements, marshaling iso-vertices, 
+			/// triangulating and staging for the hardware buffers respectively
+			uint64 caseCodesTime, refinementsTime, marshalTime, triangulateTime, queueFillTime;
+			/// Number of builds replayed from the build cache and number of cacheable builds that were extracted respectively
+			size_t buildCacheHits, buildCacheMisses;
+			/// Number of builds and bytes the build cache currently retains respectively
+			size_t buildCacheEntries, buildCacheBytes;
+
+			/// Retrieves the number of builds, extracted or replayed, completed per second of wall-clock time
+			Real getThroughput () const { return elapsed > 0 ? Real(builds + replays) * Real(1000000) / Real(elapsed) : 0; }
+			/// Retrieves the average number of builders that were busy at any moment in time
+			Real getConcurrency () const { return elapsed > 0 ? Real(busy) / Real(elapsed) : 0; }
+			/// Retrieves the average time in microseconds a single build, extracted or replayed, takes
+			Real getLatency () const { return builds + replays > 0 ? Real(busy) / Real(builds + replays) : 0; }
+			/// Retrieves the average cache miss ratio (ACMR) of reordered triangles in the order they were extracted
+			Real getACMRBefore () const { return cacheTriangles > 0 ? Real(cacheMissesBefore) / Real(cacheTriangles) : 0; }
+			/// Retrieves the average cache miss ratio (ACMR) of reordered triangles in optimized order
+			Real getACMRAfter () const { return cacheTriangles > 0 ? Real(cacheMissesAfter) / Real(cacheTriangles) : 0; }
+			/// Retrieves the fraction of triangles of decimated levels of detail that remain after decimation
+			Real getDecimationRatio () const { return decimationTrianglesBefore > 0 ? Real(decimationTrianglesAfter) / Real(decimationTrianglesBefore) : 1; }
+			/// Retrieves the average error of an edge collapse
+			Real getMeanCollapseError () const { return collapses > 0 ? collapseTotalError / Real(collapses) : 0; }
+			/// Retrieves the number of cells extracted per second of builder time
+			Real getCellRate () const { return busy > 0 ? Real(cells) * Real(1000000) / Real(busy) : 0; }
+			/// Retrieves the number of iso-vertices shipped per second of builder time
+			Real getVertexRate () const { return busy > 0 ? Real(vertices) * Real(1000000) / Real(busy) : 0; }
+			/// Retrieves the number of triangles extracted per second of builder time
+			Real getTriangleRate () const { return busy > 0 ? Real(triangles) * Real(1000000) / Real(busy) : 0; }
+			/// Retrieves the number of triangles emitted per second spent triangulating, the throughput of the triangle builders alone
+			Real getTriangulationRate () const { return triangulateTime > 0 ? Real(triangles) * Real(1000000) / Real(triangulateTime) : 0; }
+			/// Retrieves the fraction of cacheable builds that were replayed from the build cache
+			Real getBuildCacheHitRatio () const { return buildCacheHits + buildCacheMisses > 0 ? Real(buildCacheHits) / Real(buildCacheHits + buildCacheMisses) : 0; }
+
+			/** Writes these statistics as a single JSON object
+			@remarks Intended for tracking extraction performance across releases, the keys are stable and times are in microseconds
+			@param os The stream to write to
+			*/
+			void writeJSON (std::ostream & os) const;
+		};
+
+		/** Scoped check-out of a single builder, the builder is retired to the pool when this object goes out of scope */
+		class _OverhangTerrainPluginExport Lease
+		{
+		private:
+			/// The pool that the builder is retired to
+			IsoSurfaceBuilderPool * _pPool;
+			/// The builder checked-out of the pool
+			IsoSurfaceBuilder * _pBuilder;
+			/// When the builder was checked-out
+			boost::posix_time::ptime _tmStart;
+
+			/// Copying a lease is nonsensical
+			Lease (const Lease &);
+
+		public:
+			Lease (IsoSurfaceBuilderPool * pPool, IsoSurfaceBuilder * pBuilder);
+			Lease (Lease && move);
+			~Lease();
+
+			inline IsoSurfaceBuilder * operator -> () const { return _pBuilder; }
+			inline IsoSurfaceBuilder & operator * () const { return *_pBuilder; }
+		};
+
+		/**
+		@param cubemeta The meta-information singleton that describes all cubical voxel regions in a scene
+		@param opts The main top-level options from which the per-channel builder parameters are derived
+		@param nCount The number of builders to allocate, this should be the number of threads that may build surfaces concurrently
+		@remarks When extraction slabs are enabled the builders share one set of slab workers that together with the builders 
+			themselves never extract on more threads than the hardware provides
+		*/
+		IsoSurfaceBuilderPool (const Voxel::CubeDataRegionDescriptor & cubemeta, const OverhangTerrainOptions & opts, const size_t nCount);
+		~IsoSurfaceBuilderPool();
+
+		/// Check-out a builder, blocks until one is available
+		Lease lease ();
+
+		/// Retrieves the number of builders managed by the pool
+		inline size_t getCount () const { return _vpBuilders.size(); }
+		/// Retrieves the finished builds shared by all builders, NULL if the build cache is disabled
+		inline BuildCache * getBuildCache () const { return _pBuildCache; }
+
+		/// Retrieves a snapshot of pool usage since the statistics were last reset
+		Statistics getStatistics () const;
+		/// Resets the pool usage statistics
+		void resetStatistics ();
+
+	private:
+		mutable boost::mutex _mutex;
+		/// Signalled whenever a builder is retired to the pool
+		boost::condition_variable _cvRetired;
+
+		/// All builders managed by the pool and those currently available for check-out respectively
+		std::vector< IsoSurfaceBuilder * > _vpBuilders, _vpAvailable;
+		/// Finished builds shared by all builders, NULL if the build cache is disabled
+		BuildCache * _pBuildCache;
+		/// Threads shared by all builders that run the slabs of intra-cube parallel extraction, NULL if disabled
+		SlabWorkers * _pSlabWorkers;
+
+		/// Usage statistics
+		size_t _nPeak, _nBuilds, _nReplays;
+		uint64 _nBusy;
+		size_t _nCacheTriangles, _nCacheMissesBefore, _nCacheMissesAfter;
+		size_t _nDecimationTrianglesBefore, _nDecimationTrianglesAfter, _nCollapses;
+		Real _fCollapseMaxError, _fCollapseTotalError;
+		size_t _nSurfaces, _nCells, _nVertices, _nTriangles;
+		uint64 _nCaseCodesTime, _nRefinementsTime, _nMarshalTime, _nTriangulateTime, _nQueueFillTime;
+		boost::posix_time::ptime _tmReset;
+
+		/// Check-in a builder that was checked-out at the specified time
+		void retire (IsoSurfaceBuilder * pBuilder, const boost::posix_time::ptime & tmStart);
+
+		// Copying a pool is nonsensical
+		IsoSurfaceBuilderPool (const IsoSurfaceBuilderPool &);
+	};
+}
+
+#endif
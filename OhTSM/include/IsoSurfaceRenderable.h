@@ -50,6 +50,7 @@ namespace Ogre
 		@param pMWF The meta-fragment that houses this renderable (one-to-one relationship)
 		@param nLODLevels The maximum quantity of detail levels supported for multi-resolution rendering
 		@param fPixelError Number of pixels in error permitted before resolution switches between levels
+		@param enIndexType Width of indices in the hardware index buffer
 		@param sName Optional OGRE name for the renderable
 		*/
 		IsoSurfaceRenderable(
@@ -58,6 +59,7 @@ namespace Ogre
 			MetaFragment::Container * pMWF, 
 			const size_t nLODLevels, 
 			const Real fPixelError, 
+			const HardwareIndexBuffer::IndexType enIndexType,
 			const Ogre::String & sName = ""
 		);
 		virtual ~IsoSurfaceRenderable();
@@ -97,21 +99,23 @@ namespace Ogre
 		void populateBuffers( HardwareShadow::HardwareIsoVertexShadow::ConsumerLock::QueueAccess & queue );
 		/** Populate the hardware buffers synchronously from a recently completed IsoSurfaceBuilder execution
 		@param pVtxElems The buffer containing vertex information supplied by the IsoSurfaceBuilder
+		@param staging The vertices and triangle indices of the build staged in the layout of the hardware buffers
 		@param direct Direct access to the shadow data
 		@param bResetVertexBuffer Whether the hardware vertex buffer should be reset prior to populating (index buffer will reset as well)
-		@param bResetIndexBuffer Whether the hardware index buffer should be reset prior to populating
-		@param nNewVertexCount Number of new vertices to be appended to the vertex buffer
-		@param nIndexCount Total number of triangle vertex indices to be flushed */
+		@param bResetIndexBuffer Whether the hardware index buffer should be reset prior to populating */
 		void populateBuffers( 
 			IsoVertexElements *											pVtxElems, 
+			const HardwareShadow::StagingArena &						staging,
 			HardwareShadow::HardwareIsoVertexShadow::DirectAccess &		direct, 
 			const bool													bResetVertexBuffer, 
-			const bool													bResetIndexBuffer, 
-			const size_t												nNewVertexCount, 
-			const size_t												nIndexCount 
+			const bool													bResetIndexBuffer 
 		);
 		/// Deletes all hardware buffers and the shadow object
 		void deleteGeometry();
+		/** Discards the geometry of all configurations derived from a region of voxels that changed, the next build of each resolution
+			patches the affected vertices and triangles rather than extracting the whole surface again
+		@param region The voxels that changed in cube region grid cell coordinates */
+		void invalidateRegion( const CellRegion & region );
 
 	protected:
 		virtual bool prepareVertexBuffer( const size_t vertexCount, bool bClearIndicesToo );
@@ -125,6 +129,13 @@ namespace Ogre
 		virtual void wipeBuffers ();
 
 	private:
+		/** Copies staged vertices into the hardware vertex buffer
+		@param staging New vertices and patches in the layout of the hardware vertex buffer
+		@param nFirstVertex Hardware vertex of the first new vertex
+		@param remaps Hardware vertices rewritten in-place, the patches follow its entries that remap an iso-vertex
+		@param bReset Whether the vertex buffer was reset, no vertex can be patched then */
+		void copyStagedVertices( const HardwareShadow::StagingArena & staging, const size_t nFirstVertex, const IsoVertexRemapVector & remaps, const bool bReset );
+
 		/// The name of this thing
 		static String TYPE;
 		/// The render manager for synchronizing iso-surface rendering
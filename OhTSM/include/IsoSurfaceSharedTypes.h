@@ -30,6 +30,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 #define __ISOSURFACESHAREDTYPES_H__
 
 #include <vector>
+#include <algorithm>
 
 #include <boost/thread.hpp>
 
@@ -42,12 +43,74 @@ http://www.gnu.org/copyleft/lesser.txt.
 namespace Ogre
 {
 	typedef unsigned long IsoVertexIndex;
-	// Use of unsigned short potentially results in overflow for 32x32x32 cube data regions, but only if half the isovertices are used, which is probably impossible
-	typedef unsigned short HWVertexIndex;
+	// Hardware vertex indices are 32-bit in software, the hardware index buffer narrows them to 16-bit unless the channel opts for 32-bit indices
+	typedef uint32 HWVertexIndex;
+	/// Number of hardware vertices addressable by 16-bit indices, the last index is reserved to mark unmapped iso-vertices
+	static const size_t MaxHWVertices16 = 0xFFFF;
 
 	typedef std::vector< IsoVertexIndex > IsoVertexVector;
 
-	typedef unsigned short DimensionType;	// As a stipulation, dimension-type shall not exceed 32
+	/** Maps iso-vertices to the hardware vertices they occupy, the map is only as wide as the widest hardware index buffer it serves
+	@remarks Unmapped iso-vertices read as HWVertexIndex(~0) at either width */
+	class HWVertexIndexMap
+	{
+	private:
+		GenerationalArray< uint16 > * const _pNarrow;
+		GenerationalArray< HWVertexIndex > * const _pWide;
+
+		HWVertexIndexMap (const HWVertexIndexMap &);
+
+	public:
+		/// The total number of elements
+		const size_t count;
+
+		/**
+		@param nCount The number of iso-vertices
+		@param bWide Whether hardware vertices past the range of 16-bit indices are mapped
+		*/
+		HWVertexIndexMap (const size_t nCount, const bool bWide)
+			:	_pNarrow(bWide ? NULL : new GenerationalArray< uint16 > (nCount, uint16(~0))),
+				_pWide(bWide ? new GenerationalArray< HWVertexIndex > (nCount, HWVertexIndex(~0)) : NULL),
+				count(nCount) {}
+		~HWVertexIndexMap()
+		{
+			delete _pNarrow;
+			delete _pWide;
+		}
+
+		/// Unmaps all iso-vertices
+		inline void clear ()
+		{
+			if (_pWide != NULL)
+				_pWide->clear();
+			else
+				_pNarrow->clear();
+		}
+
+		/// @returns The hardware vertex of the iso-vertex or HWVertexIndex(~0) if it is unmapped
+		inline HWVertexIndex operator [] (const size_t ivi) const
+		{
+			if (_pWide != NULL)
+				return (*_pWide)[ivi];
+
+			const uint16 hwvi = (*_pNarrow)[ivi];
+			return hwvi == uint16(~0) ? HWVertexIndex(~0) : HWVertexIndex(hwvi);
+		}
+
+		/// Maps the iso-vertex to the hardware vertex, HWVertexIndex(~0) unmaps it
+		inline void set (const size_t ivi, const HWVertexIndex hwvi)
+		{
+			if (_pWide != NULL)
+				_pWide->set(ivi, hwvi);
+			else
+			{
+				OgreAssert(hwvi < MaxHWVertices16 || hwvi == HWVertexIndex(~0), "Hardware vertex is beyond the range of 16-bit indices");
+				_pNarrow->set(ivi, uint16(hwvi));
+			}
+		}
+	};
+
+	typedef unsigned short DimensionType;	// As a stipulation, dimension-type shall not exceed Voxel::MAX_DIM
 	typedef signed char FieldStrength;
 
 	/** A special data-type that by nature is ordinal but the source benefits from strict compile-time 
@@ -59,20 +122,21 @@ namespace Ogre
 	class VoxelGridIndexTemplate
 	{
 	private:
-		unsigned short _index;
+		/// 32-bit since the grid-points of a cube region larger than 32^3 cells outnumber a WORD
+		uint32 _index;
 
 	public:
 		VoxelGridIndexTemplate () {}
-		VoxelGridIndexTemplate(const unsigned short nIndex)
+		VoxelGridIndexTemplate(const uint32 nIndex)
 			: _index(nIndex) {}
 		VoxelGridIndexTemplate(VoxelGridIndexTemplate && move)
 			: _index(move._index) {}
 
 		inline
-		operator unsigned short () const { return _index; }
+		operator uint32 () const { return _index; }
 
 		inline
-		Subclass & operator = (const unsigned short nIndex)
+		Subclass & operator = (const uint32 nIndex)
 		{
 			_index = nIndex;
 			return *static_cast< Subclass * > (this);
@@ -91,7 +155,7 @@ namespace Ogre
 	{
 	public:
 		CellIndex () : VoxelGridIndexTemplate() {}
-		CellIndex(const unsigned short nIndex)
+		CellIndex(const uint32 nIndex)
 			: VoxelGridIndexTemplate(nIndex) {}
 		CellIndex(CellIndex && move)
 			: VoxelGridIndexTemplate(move) {}
@@ -102,7 +166,7 @@ namespace Ogre
 	{
 	public:
 		VoxelIndex () : VoxelGridIndexTemplate() {}
-		VoxelIndex(const unsigned short nIndex)
+		VoxelIndex(const uint32 nIndex)
 			: VoxelGridIndexTemplate(nIndex) {}
 		VoxelIndex(VoxelIndex && move)
 			: VoxelGridIndexTemplate(move) {}
@@ -126,8 +190,10 @@ namespace Ogre
 				+
 				1
 			);
-		/// Maximum dimension size of a voxel grid or voxel cube region
-		static const DimensionType MAX_DIM = 32;
+		/// Maximum dimension size of a voxel grid or voxel cube region, sizes the per-row buffers of the builders
+		static const DimensionType MAX_DIM = 64;
+
+		static_assert((MAX_DIM + 1) * (MAX_DIM + 1) * (MAX_DIM + 1) - 1 <= 0xFFFFFFFF, "Grid-points of the largest voxel cube region must be addressable by a voxel index");
 	}
 
 	struct Matrix3x21
@@ -333,6 +399,73 @@ namespace Ogre
 	inline std::ostream & operator << (std::ostream & outs, const WorldCellCoords & wcc)
 		{ return wcc.write(outs); }
 
+	/** Axis-aligned box of grid points in the same units as grid cell coordinates of a 3D voxel grid / cube region
+	@remarks Both bounds are inclusive, they may exceed the cube by one in either direction to account for the apron of
+	voxels surrounding it.  A region whose maximum is less than its minimum along any axis is null (empty).
+	*/
+	class CellRegion
+	{
+	public:
+		signed int x0, y0, z0, xN, yN, zN;
+
+		/// Initializes a null region
+		CellRegion ()
+			: x0(1), y0(1), z0(1), xN(0), yN(0), zN(0) {}
+		CellRegion (const signed int x0, const signed int y0, const signed int z0, const signed int xN, const signed int yN, const signed int zN)
+			: x0(x0), y0(y0), z0(z0), xN(xN), yN(yN), zN(zN) {}
+
+		/// @returns True if the region is empty
+		inline bool isNull () const { return xN < x0 || yN < y0 || zN < z0; }
+		/// Empties the region
+		inline void setNull () { x0 = y0 = z0 = 1; xN = yN = zN = 0; }
+
+		/// Expands this region so that it also bounds the specified one
+		void merge (const CellRegion & other)
+		{
+			if (other.isNull())
+				return;
+
+			if (isNull())
+				*this = other;
+			else
+			{
+				x0 = std::min(x0, other.x0); y0 = std::min(y0, other.y0); z0 = std::min(z0, other.z0);
+				xN = std::max(xN, other.xN); yN = std::max(yN, other.yN); zN = std::max(zN, other.zN);
+			}
+		}
+
+		/// @returns True if the specified grid point lies within the region
+		inline bool contains (const signed int x, const signed int y, const signed int z) const
+			{ return x >= x0 && x <= xN && y >= y0 && y <= yN && z >= z0 && z <= zN; }
+
+		/// @returns True if the two regions share at least one grid point
+		inline bool intersects (const CellRegion & other) const
+		{
+			return
+				other.x0 <= xN && other.xN >= x0 &&
+				other.y0 <= yN && other.yN >= y0 &&
+				other.z0 <= zN && other.zN >= z0;
+		}
+	};
+
+	inline Ogre::Log::Stream & operator << (Ogre::Log::Stream & outs, const CellRegion & region)
+		{ return outs << "<" << region.x0 << "," << region.y0 << "," << region.z0 << "><" << region.xN << "," << region.yN << "," << region.zN << ">"; }
+
+	/// Associates an isovertex with a vertex already in the hardware buffer, either to rewrite it in-place or to unmap it
+	struct IsoVertexRemap
+	{
+		/// Index of the vertex in the hardware buffer
+		HWVertexIndex index;
+		/// The isovertex now occupying the hardware vertex, or ~0 if the hardware vertex became stale and is no longer occupied
+		IsoVertexIndex ivi;
+
+		IsoVertexRemap () {}
+		IsoVertexRemap (const HWVertexIndex index, const IsoVertexIndex ivi)
+			: index(index), ivi(ivi) {}
+	};
+
+	typedef std::vector< IsoVertexRemap > IsoVertexRemapVector;
+
 	/// Represents the case code of a marching cube configuration
 	template< typename T >
 	struct BaseNonTrivialCase
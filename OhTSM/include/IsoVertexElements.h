@@ -66,33 +66,74 @@ namespace Ogre
 			GEN_VERTEX_COLOURS = 0x02,
 			/// Generate texture coordinates.
 			GEN_TEX_COORDS = 0x04,
+			/// Encode vertices in the compact quantized format.
+			GEN_COMPACT = 0x08,
 		};
 
+		/// The attributes of a single iso vertex
+		struct Attributes
+		{
+			IsoFixVec3 position;
+			Vector3 normal;
+			ColourValue colour;
+			TexCoords texcoord;
+		};
+
+		/** Indexes one attribute of all iso vertices as if it were a read-only array
+			@remarks
+				Attributes are allocated the first time an iso vertex is touched since the last clear, so
+				attributes of untouched iso vertices do not exist.  Reading never allocates, attributes are 
+				modified through IsoVertexElements::touch or IsoVertexElements::attributes. */
+		template< typename T, T Attributes::* Member >
+		class AttributeArray
+		{
+		private:
+			const IsoVertexElements & _elems;
+
+		public:
+			AttributeArray(const IsoVertexElements & elems) : _elems(elems) {}
+
+			inline const T & operator [] (const IsoVertexIndex ivi) const { return _elems.attributes(ivi).*Member; }
+		};
+
+	private:
+		/// Number of attributes per page of attribute storage expressed as a power of two
+		static const size_t AttributePageShift = 10;
+
+		/** Maps iso vertices touched since the last clear to slots in the attribute pages, 
+			slots are allocated densely in the order iso vertices are touched */
+		GenerationalArray< unsigned int > _slots;
+		/// Attribute storage, pages are never moved so references to attributes remain valid while others are allocated
+		std::vector< Attributes * > _vpAttributePages;
+		/// Number of attribute slots allocated since the last clear
+		size_t _nAttributes;
+
+	public:
 		/** Hardware vertex buffer indices for all iso vertices.
 			@remarks
-				A value of 0xFFFF means that the iso vertex is not used. During iso surface generation all
+				A value of HWVertexIndex(~0) means that the iso vertex is not used. During iso surface generation all
 				indices are reset to this value. On the first use of an iso vertex, its parameters are
 				calculated, and it is assigned the next index in the hardware vertex buffer. */
-		HWVertexIndex* const indices;
+		HWVertexIndexMap indices;
 		/** Positions of all iso vertices.
 			@remarks
 				Positions are valid only for used iso vertices. */
-		IsoFixVec3* const positions;
+		const AttributeArray< IsoFixVec3, &Attributes::position > positions;
 		/** Normals for all iso vertices.
 			@remarks
-				This array is only allocated if GEN_NORMALS is set in IsoSurface::mSurfaceFlags,
-				and normals are valid only for used iso vertices. */
-		Vector3* const normals;
+				Normals are only generated if GEN_NORMALS is set in IsoSurface::mSurfaceFlags,
+				and normals are valid only for used iso vertices, they are zero when first touched. */
+		const AttributeArray< Vector3, &Attributes::normal > normals;
 		/** Vertex colours for all iso vertices.
 			@remarks
-				This array is only allocated if GEN_VERTEX_COLOURS is set in IsoSurface::mSurfaceFlags,
+				Colours are only generated if GEN_VERTEX_COLOURS is set in IsoSurface::mSurfaceFlags,
 				and colours are valid only for used iso vertices. */
-		ColourValue* const colours;
+		const AttributeArray< ColourValue, &Attributes::colour > colours;
 		/** Texture coordinates for all iso vertices.
 			@remarks
-				This array is only allocated if GEN_TEX_COORDS is set in IsoSurface::mSurfaceFlags,
+				Texture coordinates are only generated if GEN_TEX_COORDS is set in IsoSurface::mSurfaceFlags,
 				and texture coordinates are valid only for used iso vertices. */
-		TexCoords* const texcoords;
+		const AttributeArray< TexCoords, &Attributes::texcoord > texcoords;
 
 		/// Total number of elements
 		const size_t count;
@@ -100,6 +141,9 @@ namespace Ogre
 		// Maps hardware buffer indices to iso-vertex indices
 		IsoVertexVector vertexShipment;
 
+		// Hardware buffer vertices already shipped that are rewritten with a new iso-vertex or unmapped because they became stale
+		IsoVertexRemapVector vertexRemaps;
+
 		/** Vector to which all generated iso triangles are added.
 		@remarks
 			This vector is iterated when filling the hardware index buffer. */
@@ -108,15 +152,60 @@ namespace Ogre
 		/** Creates the iso vertex arrays.
 		@remarks
 			The function calls the abstract function getNumIsoVertices() to get the length
-			of the arrays to be created. */
-		IsoVertexElements(const size_t nNumElements);
+			of the arrays to be created.
+		@param nNumElements The number of iso vertices
+		@param bWideIndices Whether hardware vertices past the range of 16-bit indices are mapped */
+		IsoVertexElements(const size_t nNumElements, const bool bWideIndices);
 		~IsoVertexElements();
 
-		/// Clears the indices member and clears the vertex shipment and triangle queues
+		/// Clears the indices member, forgets all attributes, and clears the vertex shipment and triangle queues, the cost does not depend on the number of elements
 		virtual void clear();
 
+		/** Retrieves the attributes of an iso vertex, allocating them if the iso vertex has not been touched since the last clear
+			@remarks
+				Allocation is not thread-safe, touching an iso vertex that already has attributes writes nothing and so 
+				iso vertices touched first on a single thread may be touched concurrently afterwards */
+		inline Attributes & touch (const IsoVertexIndex ivi)
+		{
+			unsigned int & slot = _slots.touch(ivi);
+
+			if (slot == ~0U)
+				slot = allocateAttributes();
+
+			return slot2attributes(slot);
+		}
+
+		/// Retrieves the attributes of an iso vertex that was touched since the last clear, nothing is allocated
+		inline Attributes & attributes (const IsoVertexIndex ivi)
+		{
+			OgreAssert(touched(ivi), "Iso vertex has no attributes");
+			return slot2attributes(_slots[ivi]);
+		}
+		/// Retrieves the attributes of an iso vertex that was touched since the last clear, nothing is allocated
+		inline const Attributes & attributes (const IsoVertexIndex ivi) const
+		{
+			OgreAssert(touched(ivi), "Iso vertex has no attributes");
+			return slot2attributes(_slots[ivi]);
+		}
+
+		/// @returns True if the iso vertex was touched since the last clear and hence has attributes
+		inline bool touched (const IsoVertexIndex ivi) const { return _slots[ivi] != ~0U; }
+
+		/// Number of iso vertices with attributes since the last clear
+		inline size_t attributeCount () const { return _nAttributes; }
+
 		/// Counts the number of triangles from the "triangles" member and multiplies it by three
 		virtual size_t indexCount() const;
+
+	private:
+		/// Allocates the next slot of attribute storage with a zero normal and returns it
+		unsigned int allocateAttributes ();
+
+		/// Resolves an allocated slot to its attributes
+		inline Attributes & slot2attributes (const unsigned int slot) const
+		{
+			return _vpAttributePages[slot >> AttributePageShift][slot & ((1 << AttributePageShift) - 1)];
+		}
 	};
 }
 
@@ -0,0 +1,122 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#ifndef __OHTMESHDECIMATOR_H__
+#define __OHTMESHDECIMATOR_H__
+
+#include "OverhangTerrainPrerequisites.h"
+
+#include <vector>
+#include <utility>
+
+namespace Ogre
+{
+	/** Simplifies triangle lists by quadric error edge collapse
+	@remarks Implements Garland and Heckbert's "Surface Simplification Using Quadric Error Metrics" restricted to half-edge
+		collapses, a vertex is only ever collapsed onto one of its neighbours so no vertex is created or moved.  The error of a
+		vertex is the sum of squared distances to the planes of the triangles it was collapsed from.  Vertices that are locked
+		or lie on the border of the mesh are never collapsed, which keeps the outline of the mesh intact.  Collapses that fold a
+		triangle over or make the mesh non-manifold are rejected.  The scratch space is retained between calls, an instance
+		should be re-used by a single thread. */
+	class _OverhangTerrainPluginExport MeshDecimator
+	{
+	public:
+		/// Measurements of a single decimation
+		struct Result
+		{
+			/// Number of edges collapsed
+			size_t collapses;
+			/// Greatest and summed error of the edges collapsed respectively
+			Real maxError, totalError;
+		};
+
+		/** Collapses the edges of a triangle list in order of increasing error until the error exceeds a threshold
+		@param pPositions Position of every vertex referenced by the triangle list
+		@param vLocked Whether each vertex must be retained, locked vertices may still have others collapsed onto them
+		@param vIndices (in/out) The triangle list, three vertex indices per triangle, collapsed triangles are removed
+		@param fMaxError The greatest error of an edge collapse, the sum of squared distances to the original surface
+		@returns Measurements of the collapses performed */
+		Result decimate (const Vector3 * pPositions, const std::vector< bool > & vLocked, std::vector< size_t > & vIndices, const Real fMaxError);
+
+	private:
+		/// Symmetric 4x4 matrix of the error quadric of a vertex, upper triangle in row-major order
+		struct Quadric
+		{
+			double m[10];
+
+			/// Accumulates the quadric of the plane ax + by + cz + d = 0
+			void add (const double a, const double b, const double c, const double d);
+			/// Accumulates another quadric
+			void add (const Quadric & other);
+			/// Evaluates the error of a position
+			double evaluate (const Vector3 & v) const;
+		};
+
+		/// Candidate collapse of vertex "from" onto vertex "to"
+		struct Collapse
+		{
+			double error;
+			size_t from, to;
+			/// Versions of either vertex when the candidate was evaluated
+			unsigned vfrom, vto;
+
+			inline bool operator < (const Collapse & other) const { return error > other.error; }
+		};
+
+		/// Error quadric of each vertex
+		std::vector< Quadric > _vQuadrics;
+		/// Triangles referencing each vertex, possibly including removed triangles
+		std::vector< std::vector< size_t > > _vTriangles;
+		/// Incremented each time the neighbourhood of a vertex changes, invalidates candidates evaluated earlier
+		std::vector< unsigned > _vVersions;
+		/// Whether each vertex may be collapsed, false for locked, border and collapsed vertices
+		std::vector< bool > _vMovable;
+		/// Whether each triangle was removed by a collapse
+		std::vector< bool > _vRemoved;
+		/// Candidate collapses ordered as a heap of increasing error
+		std::vector< Collapse > _vHeap;
+		/// Neighbours of a vertex each paired with the number of triangles it shares with the vertex
+		typedef std::vector< std::pair< size_t, unsigned > > NeighbourVector;
+		/// Scratch space for the neighbours of either vertex of an edge respectively
+		NeighbourVector _vNeighbours, _vLink;
+
+		/** Collects the neighbours of a vertex along with the number of triangles each shares with it
+		@param vIndices The triangle list
+		@param v The vertex whose neighbours are collected
+		@param vNeighbours (out) Receives the neighbours of the vertex */
+		void collectNeighbours (const std::vector< size_t > & vIndices, const size_t v, NeighbourVector & vNeighbours);
+
+		/// Evaluates and enqueues the candidate collapses of all edges around a vertex
+		void enqueue (const Vector3 * pPositions, const std::vector< size_t > & vIndices, const size_t v);
+
+		/// Determines whether collapsing a vertex onto another keeps the mesh manifold and no triangle folds over
+		bool isValid (const Vector3 * pPositions, const std::vector< size_t > & vIndices, const size_t from, const size_t to);
+	};
+}
+
+#endif
@@ -38,6 +38,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include "Types.h"
 #include "OverhangTerrainOptions.h"
 #include "DataBase.h"
+#include "IsoSurfaceBuilderPool.h"
 
 namespace Ogre
 {
@@ -75,14 +76,18 @@ namespace Ogre
 		@remarks Initializes the cube data region with a factory for creating database objects
 		@param nVRFlags A combination of OverhangTerrainVoxelRegionFlags identifying what channels this region supports
 		@param pPool The database pool factory for checking-out database objects for manipulating the cube data region with uncompressed data
-		@param bbox Bounding-box in world-space coordinates relative to page for the cube data region */
+		@param bbox Bounding-box in world-space coordinates relative to page for the cube data region 
+		@remarks The region is resident in the factory's voxel cache if there is one */
 		Voxel::CubeDataRegion * createCubeDataRegion (const size_t nVRFlags, Voxel::DataBasePool * pPool, const AxisAlignedBox & bbox = AxisAlignedBox::BOX_NULL);
 
 		/// Leverages the manual resource loader to load a named material
 		MaterialPtr acquireMaterial (const std::string & sName, const std::string & sRsrcGroup) const;
 
-		/// Retrieves the isosurface builder singleton
-		inline IsoSurfaceBuilder * getIsoSurfaceBuilder () const { return _pISB; }
+		/// Retrieves the pool of isosurface builders, one is leased by each thread that builds surfaces
+		inline IsoSurfaceBuilderPool * getIsoSurfaceBuilderPool () const { return _pISBPool; }
+
+		/// Retrieves the cache of decompressed voxels shared by all cube data regions or NULL if voxels are decompressed on every lease
+		inline Voxel::DataBaseCache * getDataBaseCache () const { return _pDBCache; }
 
 		/// Retrieves a voxel factory for the specified channel
 		const Voxel::MetaVoxelFactory * getVoxelFactory(const Channel::Ident channel) const;
@@ -99,8 +104,10 @@ namespace Ogre
 		Voxel::CubeDataRegionDescriptor * _pCubeMeta;
 		/// The main top-level configuration options
 		OverhangTerrainOptions _options;
-		/// The isosurface builder singleton
-		IsoSurfaceBuilder * _pISB;
+		/// The pool of isosurface builders
+		IsoSurfaceBuilderPool * _pISBPool;
+		/// Cache of decompressed voxels of recently leased cube data regions or NULL if disabled
+		Voxel::DataBaseCache * _pDBCache;
 
 		/// Index of channel-specific voxel factories
 		Channel::Index< Voxel::MetaVoxelFactory, Channel::FauxFactory< Voxel::MetaVoxelFactory > > * _pVoxelFacts;
@@ -181,6 +188,12 @@ namespace Ogre
 			/// Returns the vertex declaration elements describing element offsets into the hardware buffers used by renderables of this channel
 			const VertexDeclarationElements * getVertexDeclarationElements() const { return _pVtxDeclElems; }
 
+			/// Returns the width of indices in the hardware index buffers used by renderables of this channel
+			HardwareIndexBuffer::IndexType getIndexType() const { return _chanopts.indexType; }
+
+			/// Returns whether normals of renderables of this channel are central differences, which sample the voxels of neighbouring regions
+			bool samplesNeighbors() const;
+
 		private:
 			/// Top-level configuration options
 			const OverhangTerrainOptions _options;
@@ -55,6 +55,7 @@ MetaFragments for visibility culling (TODO).
 #include "Types.h"
 #include "CubeDataRegion.h" // TODO: Remove once migrated Voxel::DataAccessor::EmptySet
 #include "IsoSurfaceSharedTypes.h"
+#include "HardwareIsoVertexShadow.h"
 #include "MetaObject.h"
 #include "Neighbor.h"
 #include "MetaFactory.h"
@@ -90,14 +91,39 @@ namespace Ogre
 			RenderManager * _pRendMan;
 			/// Flag to indicate whether the hardware buffers should be reset (cleared and repopulated) whenever the main thread gets around to it
 			bool _bResetting;
+			/// Voxels affected by meta-objects added or removed since the isosurface was last reset, null if unknown (i.e. reset entirely)
+			CellRegion _dirty;
+			/// Voxels along the sides whose central differences changed because neighbours beyond those sides changed, null if none did
+			CellRegion _dirtyHalo;
 			/// OGRE scene node to which the isosurface is bound
 			SceneNode * _pSceneNode;
 			/// List of meta-objects that makes-up this fragment's discrete sample voxel grid
 			MetaObjsList _vMetaObjects;
+			/// Bounds of each meta-object when the voxel grid was last sampled, meta-objects moved or resized since then invalidate both bounds
+			std::map< const MetaObject *, AxisAlignedBox > _sampled;
 
 			/// Surrounding meta fragment neighbors in the scene
 			Core * _vpNeighbors[CountOrthogonalNeighbors];
 
+			/// Accumulates the voxels the specified meta-object affects now and affected when last sampled into the dirty region
+			void invalidateMetaObject( const MetaObject * const mo );
+			/// Accumulates the voxels within the specified world bounds into the dirty region
+			void invalidateBox( const AxisAlignedBox & bbox );
+			/// Discards the isosurface geometry, only that of the dirty region if known otherwise all of it
+			void resetSurface();
+			/// Discards the isosurface geometry along the sides whose neighbours changed since the isosurface was last reset
+			void resetHalo();
+			/** Marks the voxels of the neighbours at the sides they share with this fragment dirty where their central differences
+				sample the specified voxels of this fragment
+			@param voxels The voxels of this fragment that changed */
+			void invalidateNeighborHalos( const CellRegion & voxels );
+			/** Determines the configurations to build along with the specified one when the isosurface has none yet, a camera sweep
+				soon requests those of the adjacent levels of detail as well
+			@param nLOD The LOD of the configuration requested
+			@param enStitches The stitch flags of the configuration requested
+			@returns The configuration requested followed by those of the adjacent levels of detail */
+			HardwareShadow::ConfigurationList batchConfigurations( const unsigned nLOD, const Touch3DFlags enStitches ) const;
+
 			/// Material of the isosurface renderable stored as strings name and group
 			struct MaterialInfo
 			{
@@ -109,10 +135,8 @@ namespace Ogre
 
 			/// Previous WorkQueue request ID (if any) for updating the isosurface
 			WorkQueue::RequestID _ridBuilderLast;
-			/// LOD of the previous request
-			unsigned char _nLOD_Requested0;
-			/// Stitch flags of the previous request
-			Touch3DFlags _enStitches_Requested0;
+			/// LOD and stitch flags of the configurations of the previous request pending
+			HardwareShadow::ConfigurationList _vRequested0;
 
 		public:
 			/// Factory singleton for creating new objects of the associated channel
@@ -168,8 +192,10 @@ namespace Ogre
 			/** Perform a ray query on this meta fragment
 			@param ray The ray we're conducting the query for
 			@param limit The maximum distance away from the ray origin to query
+			@param mode Method of intersecting the surface with the ray
+			@param tolerance Greatest error in voxels along the ray of the intersection when intersecting the voxel field (RQM_Field)
 			*/
-			std::pair< bool, Real > rayQuery(const Ray & ray, const Real limit);
+			std::pair< bool, Real > rayQuery(const Ray & ray, const Real limit, const RayQueryMode mode = RQM_Triangles, const Real tolerance = 0);
 
 			/** Rebuild the isosurface renderable
 			@remarks This does not actually do any heavy-lifting, it just sets flags in preparation for rebuilding the isosurface which is done elsewhere
@@ -400,7 +426,7 @@ namespace Ogre
 
 				/// @see Core::rayQuery(...)
 				inline
-				std::pair< bool, Real > rayQuery(const Ray & ray, const Real limit) { return _core->rayQuery(ray, limit); }
+				std::pair< bool, Real > rayQuery(const Ray & ray, const Real limit, const RayQueryMode mode = RQM_Triangles, const Real tolerance = 0) { return _core->rayQuery(ray, limit, mode, tolerance); }
 				
 				/// @see Core::updateSurface()
 				inline
@@ -107,6 +107,14 @@ namespace Ogre
 		@returns The request ID for the queued background request */
 		WorkQueue::RequestID generateSurfaceConfiguration( MetaFragment::Container * pMF, const IsoSurfaceRenderable * pISR, const unsigned nLOD, const Touch3DFlags enStitches );
 
+		/** Generates several iso-surface configurations at once
+		@remarks All configurations are extracted by the same background request from a single lease of the voxels and are
+			batched to the GPU together when any one of them is consumed.
+		@param pMF The meta-fragment whose iso-surface to generate configurations from
+		@param configs The levels of detail and boundary multi-resolution stitch configurations to generate, the first one is the primary configuration
+		@returns The request ID for the queued background request */
+		WorkQueue::RequestID generateSurfaceConfigurations( MetaFragment::Container * pMF, const IsoSurfaceRenderable * pISR, const HardwareShadow::ConfigurationList & configs );
+
 		/** Cancels a previously issued task 
 		@param rid The request ID of the task to cancel */
 		void cancelRequest(const WorkQueue::RequestID rid);
@@ -133,6 +141,15 @@ namespace Ogre
 		 @remarks This must be called from the main thread */
 		RayResult rayIntersects(Ray ray, const OverhangTerrainManager::RayQueryParams & params) const;
 
+		/** Test for intersection of several rays with any terrain in the group at once on background threads.
+		 @remarks The rays are partitioned by the pages they traverse and a background request is queued for each page
+			which queries its segments of the rays ordered by the terrain tile they enter first.
+		 @param rays The rays to test for intersection
+		 @param params Parameters influencing the query of every ray of the batch
+		 @param pListener Receives the results in the main thread once every request of the batch responded
+		 @remarks This must be called from the main thread */
+		void rayIntersects(const RayList & rays, const OverhangTerrainManager::RayQueryParams & params, IRayQueryListener * pListener);
+
 		/** Queues a background request for unloading terrain at the specified coordinates
 		@remarks Attempts to unload the terrain page at the specified slot if it is permitted to.
 			Nothing happens if the terrain slot is currently busy.
@@ -183,6 +200,11 @@ namespace Ogre
 
 		inline String getResourceGroupName() const { return _sResourceGroup; }
 
+		/// Retrieves isosurface extraction throughput statistics accumulated since they were last reset
+		inline IsoSurfaceBuilderPool::Statistics getBuilderStatistics() const { return _factory.getIsoSurfaceBuilderPool()->getStatistics(); }
+		/// Resets the isosurface extraction throughput statistics
+		inline void resetBuilderStatistics() { _factory.getIsoSurfaceBuilderPool()->resetStatistics(); }
+
 	protected:
 		/// Request type indicators for background tasks
 		enum RequestType
@@ -198,7 +220,11 @@ namespace Ogre
 			/// Destroy and clear the scene of all terrains task
 			DestroyAll = 5,
 			/// Build an iso-surface of a particular configuration
-			BuildSurface = 6
+			BuildSurface = 6,
+			/// Build several configurations of an iso-surface at once
+			BuildSurfaces = 7,
+			/// Query the segments of a batch of rays that traverse a page
+			QueryRays = 8
 		};
 
 		/// The main factory singleton for creating top-level objects
@@ -276,6 +302,75 @@ namespace Ogre
 			{ return o; }
 		};
 
+		/// Special request type for building several configurations of an iso-surface from a single lease of its voxels
+		struct SurfaceBatchGenRequest : public WorkRequest
+		{
+			const MetaFragment::Container * mf;
+			SharedPtr< HardwareShadow::HardwareIsoVertexShadow > shadow;
+			Channel::Ident channel;
+			/// The configurations to build, the first one is the primary configuration of the batch
+			HardwareShadow::ConfigurationList configs;
+			size_t surfaceFlags;
+			size_t vertexBufferCapacity;
+
+			_OverhangTerrainPluginExport friend std::ostream & operator << (std::ostream & o, const SurfaceBatchGenRequest & r)
+			{ return o; }
+		};
+
+		/// A batch of ray queries shared by all requests querying the pages its rays traverse
+		struct RayBatch
+		{
+			RayList rays;
+			OverhangTerrainManager::RayQueryParams params;
+			IRayQueryListener * listener;
+			/// The result of each ray of the batch
+			RayResultList results;
+			/// Ordinal of the page along each ray that the result was obtained from, hits nearer to the ray origin take precedence
+			std::vector< size_t > steps;
+			/// Number of requests of the batch that have yet to respond
+			size_t pending;
+
+			RayBatch(const RayList & rays, const OverhangTerrainManager::RayQueryParams & params, IRayQueryListener * pListener);
+		};
+
+		/// The part of a ray of a batch that traverses a particular page
+		struct RaySegment
+		{
+			/// Index of the ray in the batch
+			size_t ray;
+			/// Ordinal of the page along the ray
+			size_t step;
+			/// Ordinal of the terrain tile of the page that the segment enters first
+			size_t tile;
+			/// The ray relative to the page position
+			Ray local;
+			/// Distance traversed along the ray before entering the page
+			Real distance;
+
+			/// Orders segments by the tile they enter first so that consecutive queries share the same voxel leases
+			inline bool operator < (const RaySegment & other) const { return tile < other.tile; }
+		};
+
+		/// Special request type for querying the segments of a batch of rays that traverse a page
+		struct RayBatchRequest : public WorkRequest
+		{
+			SharedPtr< RayBatch > batch;
+			std::vector< RaySegment > segments;
+
+			_OverhangTerrainPluginExport friend std::ostream & operator << (std::ostream & o, const RayBatchRequest & r)
+			{ return o; }
+		};
+
+		/// Response data of querying the segments of a batch of rays
+		struct RayBatchResponseData
+		{
+			/// The result of each segment of the request in the same order, must be disposed of at the end of the request
+			RayResultList * results;
+
+			_OverhangTerrainPluginExport friend std::ostream & operator << (std::ostream & o, const RayBatchResponseData & r)
+			{ return o; }
+		};
+
 		/// Special request type for adding metaballs to the scene
 		struct MetaBallWorkRequest : public WorkRequestBase
 		{
@@ -365,6 +460,11 @@ namespace Ogre
 		/// Dipose operations for defining / loading a terrain, called after response or when aborted
 		void defineTerrain_dispose( OverhangTerrainSlot* slot );
 
+		/// Worker tasks for querying the segments of a batch of rays that traverse a particular terrain slot
+		void rayIntersects_worker( const RayBatchRequest & reqdata, RayBatchResponseData & respdata );
+		/// Final steps in querying a batch of rays, merges the results of a request into the batch and notifies the listener when it was the last one, results is NULL if the request failed or was aborted
+		void rayIntersects_response( const RayBatchRequest & reqdata, const RayResultList * results );
+
 		/// Worker tasks for unloading a terrain slot
 		void unloadTerrain_worker( OverhangTerrainSlot * slot, UnloadPageResponseData & respdata );
 		/// Final steps in unloading a terrain slot
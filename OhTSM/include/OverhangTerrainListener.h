@@ -101,7 +101,7 @@ namespace Ogre
 		/// Retrieves the size of the cube along one axis in cells
 		size_t getDimensions () const;
 		
-		/// Retrieve the colour channe for reading or writing
+		/// Retrieve the colour channel for reading or writing, the colours are flagged as modified and compressed when the cube is released
 		Voxel::ColourChannelSet & getColours ();
 		/// Retrieve the colour channel for reading
 		const Voxel::ColourChannelSet & getColours () const;
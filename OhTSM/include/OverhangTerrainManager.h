@@ -33,6 +33,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include <OgreAxisAlignedBox.h>
 
 #include <list>
+#include <vector>
 
 #include "OverhangTerrainPrerequisites.h"
 #include "Util.h"
@@ -79,6 +80,10 @@ namespace Ogre
 		public:
 			/// Distance limit in world units to terminate ray searching
 			Real limit;
+			/// Method of intersecting surfaces with the ray, defaults to RQM_Triangles
+			RayQueryMode mode;
+			/// Greatest error in world units along the ray of intersections found with RQM_Field
+			Real tolerance;
 
 			/** Describes channels factored into the ray query */
 			class _OverhangTerrainPluginExport Channels
@@ -94,6 +99,8 @@ namespace Ogre
 				@param channels A collection of channels (identifiers) used to factor-into the query, other channels will be ignored in the query
 				*/
 				Channels(const std::list< Channel::Ident > & channels);
+				/// Copies the list of channels so that parameters can be handed to other threads
+				Channels(const Channels & copy);
 				~Channels();
 
 				class _OverhangTerrainPluginExport AbstractIterator : public std::iterator< std::input_iterator_tag, Channel::Ident >
@@ -245,6 +252,19 @@ namespace Ogre
 				: hit(hit), position(pos), mwf(NULL) {}
 		};
 
+		typedef std::vector< Ray > RayList;
+		typedef std::vector< RayResult > RayResultList;
+
+		/** Receives the results of a batch of ray queries */
+		class _OverhangTerrainPluginExport IRayQueryListener
+		{
+		public:
+			/** Called from the main thread once every ray of a batch was queried
+			@param rays The rays of the batch
+			@param results The result of each ray of the batch in the same order as the rays */
+			virtual void rayQueriesFinished (const RayList & rays, const RayResultList & results) = 0;
+		};
+
 		/** Add a metaball to the scene.
 		@param position The absolute world position of the metaball
 		@param radius The radius of the metaball sphere in world units
@@ -257,6 +277,14 @@ namespace Ogre
 		 @param params Parameters influencing the ray query including the distance from the ray origin at which we will stop looking or zero for no limit
 		 @return A result structure which contains whether the ray hit a terrain and if so, where. */
 		virtual RayResult rayIntersects(Ray ray, const OverhangTerrainManager::RayQueryParams & params) const = 0;
+		/** Test for intersection of several rays with any terrain in the group at once on background threads.
+		 @remarks The rays are partitioned by the pages they traverse and each page is queried by a separate background request.  
+			Surfaces are only share-locked and their voxel fields are intersected at full resolution (RQM_Field) regardless of the 
+			mode of the parameters, the rays of a page share the decompressed voxels of the meta-fragments they traverse.
+		 @param rays The rays to test for intersection
+		 @param params Parameters influencing the query of every ray of the batch
+		 @param pListener Receives the results in the main thread once every ray of the batch was queried */
+		virtual void rayIntersects(const RayList & rays, const OverhangTerrainManager::RayQueryParams & params, IRayQueryListener * pListener) = 0;
 		/// Sets the material used on all terrain
 		virtual void setMaterial (const Channel::Ident channel, const MaterialPtr & m) = 0;
 
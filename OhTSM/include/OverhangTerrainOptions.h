@@ -35,6 +35,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 
 #include <OgreStreamSerialiser.h>
 #include <OgreMaterial.h>
+#include <OgreHardwareIndexBuffer.h>
 
 namespace Ogre
 {
@@ -72,10 +73,25 @@ namespace Ogre
 		/// Normals are calculated as an average of face normals.
 		NT_Average,
 		/// Normals are calculated by interpolating the gradient in the data grid.
-		NT_Gradient
+		NT_Gradient,
+		/** Normals are calculated by interpolating central differences of the voxel values sampled as vertices are configured, 
+			the data grid need not store gradients (VRF_Gradient). */
+		NT_CentralDifference
 	};
 
-	/** Main top-level and base configuration for OhTSM */
+	/// Method of intersecting surfaces with a ray during a ray query
+	enum RayQueryMode
+	{
+		/// Surfaces are triangulated cell by cell along the ray and the triangles are intersected with the ray
+		RQM_Triangles,
+		/** The ray is marched through the voxel field, cells are rejected by the signs of their corners and otherwise the field 
+			interpolated along the ray is solved for its first root, the intersection may deviate from the rendered surface by less than a cell */
+		RQM_Field
+	};
+
+	/** Main top-level and base configuration for OhTSM
+	@remarks Only the options present in the original format are serialized, those added since keep their defaults when 
+		restored and the application must configure them again every time */
 	class _OverhangTerrainPluginExport OverhangTerrainOptions
 	{
 	public:
@@ -102,6 +118,26 @@ namespace Ogre
 			/// Flags describing what channels of a CubeDataRegion are relevant
 			size_t voxelRegionFlags;
 
+			/// Whether extracted triangle lists are reordered for the post-transform vertex cache of the GPU
+			bool optimizeVertexCache;
+			/** Whether vertices are stored in the compact quantized format (16-bit positions relative to the cube, octahedral-encoded
+				16-bit normals and 16-bit fixed-point texture coordinates)
+			@remarks The material's vertex program must decode normals and texture coordinates, fixed-function lighting cannot.  
+				Example/media/OhTSM/CompactVertex.material provides such a program, run the example with "-compact" to see it in use. */
+			bool compactVertices;
+			/// Width of hardware indices of surfaces in this channel, 32-bit indices lift the cap of 65,535 vertices per surface
+			HardwareIndexBuffer::IndexType indexType;
+			/** Range [surfaceNetsLODBegin, surfaceNetsLODEnd) of levels of detail extracted with Surface Nets instead of Transvoxel, 
+				cheaper for coarse levels of detail, sides facing finer neighbours are spanned by seams instead of transition cells, an empty range disables it */
+			unsigned short surfaceNetsLODBegin, surfaceNetsLODEnd;
+			/** Whether triangle lists of levels of detail from decimationLOD onwards are simplified by quadric error edge collapse, 
+				vertices flush with the sides of the cube are never collapsed so that stitching with neighbours remains crack-free */
+			bool decimate;
+			/// The first level of detail that is decimated
+			unsigned short decimationLOD;
+			/// Greatest error of an edge collapse, the sum of squared distances in voxels from the planes of the original triangles
+			Real decimationMaxError;
+
 			ChannelOptions();
 		};
 
@@ -127,6 +163,16 @@ namespace Ogre
 		bool materialPerTile;
 		/// Whether to automatically save dirty pages upon unloading
 		bool autoSave;
+		/// Number of Z slabs a cube is split into so that a single surface is extracted on several threads at once, one disables this
+		size_t extractionSlabs;
+		/// Greatest number of bytes of finished builds retained for when the same voxels are built again, zero disables the build cache
+		size_t buildCacheSize;
+		/** Whether finished builds retained by the build cache are saved with pages and replayed instead of extracted when the pages are loaded again
+		@remarks Replayed builds are matched by their voxels, level of detail and vertex format but not by the Surface Nets range 
+			or the decimation options of the channel, these must be the same when pages are loaded as when they were saved */
+		bool persistMeshes;
+		/// Greatest number of bytes of decompressed voxels kept between leases of recently used regions, zero decompresses on every lease
+		size_t voxelCacheSize;
 
 		/// The area of the terrain page, in vertices
 		inline const ulong getTotalPageSize() const { return pageSize * pageSize; }
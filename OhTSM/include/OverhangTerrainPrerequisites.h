@@ -65,8 +65,11 @@ namespace Ogre
 		class CubeDataRegion;
 		class DataAccessor;
 		class const_DataAccessor;
+		class const_ValuesAccessor;
 		class CompressedDataAccessor;
 		class const_CompressedDataAccessor;
+		class ValuesCache;
+		class DataBaseCache;
 		class ColourChannelSet;
 		class FieldAccessor;
 		class GradientField;
@@ -96,6 +99,8 @@ namespace Ogre
 		class Container;
 	}
 
+	class BuildCache;
+	class SlabWorkers;
 	class DynamicRenderable;
 	class IsoSurfaceBuilder;
 	class IsoSurfaceRenderable;
@@ -126,5 +131,19 @@ namespace Ogre
 #   define _OverhangTerrainPluginExport
 #endif
 
+//-----------------------------------------------------------------------
+// SIMD Settings
+//-----------------------------------------------------------------------
+
+// Define OHT_NO_SIMD to force the portable scalar code paths
+#if !defined(OHT_NO_SIMD)
+#	if defined(__AVX2__)
+#		define OHT_SIMD_AVX2
+#		define OHT_SIMD_SSE2
+#	elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#		define OHT_SIMD_SSE2
+#	endif
+#endif
+
 #endif
 
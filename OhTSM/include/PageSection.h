@@ -258,17 +258,19 @@ namespace Ogre {
 		void detachFromScene();
 
 		/** Queries the page's isosurfaces for intersection with the specified ray
-		@remarks This method is restricted to the main thread
+		@remarks This method is restricted to the main thread unless the query is part of a batch
 		@param result Receives the isosurface triangle intersection result
 		@param rayPageLocalWorldSpace Ray in world-space coordinates relative to this page's position
 		@param params Query parameters relevant to the current query
 		@param distance The current distance traversed so far in the current query (used to compare with the maximum limit in the params parameter)
+		@param pCopies Copies of voxel values shared by the rays of a batch queried in a background thread, NULL for a single query in the main thread
 		@returns True when an intersection with an isosurface and triangle was found somewhere within this page */
 		bool rayIntersects(
 			OverhangTerrainManager::RayResult & result,
 			const Ray& rayPageLocalWorldSpace,
 			const OverhangTerrainManager::RayQueryParams & params,
-			const Real distance
+			const Real distance,
+			Voxel::ValuesCache * pCopies = NULL
 		) const;
 
 		/// Retrieves an iterator for all meta-fragments in the specified channel of this page
@@ -312,6 +314,9 @@ namespace Ogre {
 		/// Used for serialization
 		static const uint32 CHUNK_ID;
 		static const uint16 VERSION;
+		/// Used for serialization of the optional finished builds of the page
+		static const uint32 MESH_CHUNK_ID;
+		static const uint16 MESH_VERSION;
 
 		/// Unlinks the neighbor at the specified side, result is dual so it does not need to also be called for the neighbor too
 		void unlinkPageNeighbor (const VonNeumannNeighbor ennNeighbor);
@@ -57,6 +57,21 @@ namespace Ogre
 			size_t _zsize;
 			unsigned char * _buffer;
 
+			/// Locates the start of a run in both the decompressed and the compressed data
+			struct IndexEntry
+			{
+				uint32 decompressed, compressed;
+
+				IndexEntry(const uint32 nDecompressed, const uint32 nCompressed)
+					: decompressed(nDecompressed), compressed(nCompressed) {}
+			};
+			typedef std::vector< IndexEntry > Index;
+
+			/// Number of runs between index entries or zero if the channel isn't indexed
+			const size_t _nIndexInterval;
+			/// Skip index of every so many runs in order of their offsets
+			Index _index;
+
 			const static int PRECISION = 7;
 
 			enum Flags
@@ -92,8 +107,47 @@ namespace Ogre
 
 			void flushCounter( unsigned int & i, size_t & d, const Flags enfInverse );
 
+			/** Decodes the header of the run at the specified position
+			@param pB Position of the run header in the compressed data
+			@param nLength (out) Number of decompressed bytes of the run
+			@param fHeterogenous (out) Non-zero if the run is followed by a verbatim copy of its bytes rather than a single byte repeated
+			@returns Position of the payload of the run */
+			inline static
+			const unsigned char * readRun (const unsigned char * pB, unsigned int & nLength, unsigned int & fHeterogenous)
+			{
+				unsigned int j = *pB++, fb;
+
+				fHeterogenous = j & Flag_Heterogenous;
+				fb = j & Flag_Bigger;
+				nLength = j ^ fb;
+
+				if (fb != 0)
+				{
+					j = *pB++;
+					fb = j & Flag_Bigger;
+					nLength |= (j ^ fb) << PRECISION;
+
+					if (fb != 0)
+					{
+						j = *pB++;
+						fb = j & Flag_Bigger;
+						nLength |= (j ^ fb) << PRECISION * 2;
+
+						if (fb != 0)
+							nLength |= static_cast< unsigned int > (*pB++) << PRECISION * 3;
+					}
+				}
+
+				nLength >>= 1;
+				return pB;
+			}
+
+			/// Rebuilds the skip index from the compressed data
+			void buildIndex ();
+
 		public:
-			Channel();
+			/// @param nIndexInterval Number of runs between entries of a skip index that accelerates partial decompression, zero for no index
+			Channel(const size_t nIndexInterval = 0);
 
 			/** Compress a block of data
 			@remarks Stores a compressed representation of the specified block in this object that can be accessed later
@@ -109,6 +163,25 @@ namespace Ogre
 			*/
 			void decompress (const size_t nDecompSize, unsigned char * pDest) const;
 
+			/** Decompress a range of the previously compressed data from this object
+			@remarks Starts from the nearest indexed run before the range if the channel is indexed, from the beginning otherwise, 
+				and stops at the end of the range.  Either way the rest of the data is never expanded.
+			@param nDecompSize byte size of the data when uncompressed
+			@param nFirst Offset of the first byte of the range in the decompressed data
+			@param nCount Number of bytes in the range
+			@param pDest The destination buffer for the range, receives nCount bytes
+			*/
+			void decompress (const size_t nDecompSize, const size_t nFirst, const size_t nCount, unsigned char * pDest) const;
+
+			/// Retrieves a single byte of the decompressed data
+			inline
+			unsigned char at (const size_t nDecompSize, const size_t nIndex) const
+			{
+				unsigned char c = 0;
+				decompress(nDecompSize, nIndex, 1, &c);
+				return c;
+			}
+
 			/// Writes the compressed channel to the stream
 			StreamSerialiser & operator >> (StreamSerialiser & outs) const;
 			/// Reads the compressed channel from the stream
@@ -117,6 +190,12 @@ namespace Ogre
 			/// Retrieves the total byte size of the compressed data
 			inline
 			size_t getCompressedSize() const { return _zsize; }
+			/// Retrieves the compressed data, NULL if nothing was compressed yet
+			inline
+			const unsigned char * getCompressedData() const { return _buffer; }
+
+			/// Computes a CRC value of the compressed data, equal channels yield equal values
+			unsigned long long computeCRC () const;
 
 			~Channel();
 		};
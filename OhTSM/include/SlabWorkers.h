@@ -0,0 +1,112 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#ifndef __OHTSLABWORKERS_H__
+#define __OHTSLABWORKERS_H__
+
+#include "OverhangTerrainPrerequisites.h"
+
+#include <vector>
+#include <list>
+
+#include <boost/thread.hpp>
+#include <boost/function.hpp>
+
+namespace Ogre
+{
+	/** Persistent threads shared by all builders of a pool that run the slabs of intra-cube parallel extraction
+	@remarks The threads are started once with the pool and wait for slabs in between builds.  A builder offers all of its slabs,
+		runs the first on its own thread and then keeps running any of its slabs that no worker has claimed yet, so a build 
+		never waits on a worker that is busy elsewhere.  Builders report when they start and finish a build so that workers 
+		only claim a slab while fewer threads than the concurrency limit are extracting, this way builders and workers together 
+		never oversubscribe the processor. */
+	class _OverhangTerrainPluginExport SlabWorkers
+	{
+	public:
+		/// Callback invoked with the slab ordinal
+		typedef boost::function< void (const size_t) > SlabFunction;
+
+		/**
+		@param nThreads The number of worker threads to start
+		@param nConcurrency The maximum number of builders and workers extracting at any moment
+		*/
+		SlabWorkers (const size_t nThreads, const size_t nConcurrency);
+		~SlabWorkers();
+
+		/** Runs a function for every slab and returns when all of them have finished, the first slab runs on the calling thread
+		@param nSlabs The number of slabs to run
+		@param fn Callback passing the slab ordinal as a formal parameter
+		*/
+		void run (const size_t nSlabs, const SlabFunction & fn);
+
+		/// Called by a builder's thread before it starts extracting
+		void occupy ();
+		/// Called by a builder's thread after it has finished extracting
+		void vacate ();
+
+	private:
+		/// Slabs of a single build offered to the workers
+		class Job
+		{
+		public:
+			const SlabFunction & fn;
+			/// Total number of slabs, the next slab to be claimed and the number of slabs that have finished respectively
+			size_t count, next, done;
+			/// Signalled when the last slab finishes
+			boost::condition_variable cvDone;
+
+			Job (const SlabFunction & fn, const size_t nCount)
+				: fn(fn), count(nCount), next(0), done(0) {}
+		};
+
+		boost::mutex _mutex;
+		/// Signalled when a job is offered, when a thread stops extracting or when the workers should exit
+		boost::condition_variable _cvWork;
+		/// Jobs that still have slabs no thread has claimed yet
+		std::list< Job * > _jobs;
+		/// The worker threads
+		boost::thread_group _threads;
+		/// Number of builders and workers currently extracting and the limit thereof respectively
+		size_t _nBusy, _nConcurrency;
+		/// Set when the workers should exit
+		bool _bStop;
+
+		/// Claims the next slab of a job with the mutex held, the job is withdrawn once its last slab is claimed, returns false if none remain
+		bool claim (Job * pJob, size_t & s);
+		/// Counts a finished slab of a job with the mutex held
+		void finish (Job * pJob);
+
+		/// Entry point of the worker threads
+		void work ();
+
+		// Copying a thread set is nonsensical
+		SlabWorkers (const SlabWorkers &);
+	};
+}
+
+#endif
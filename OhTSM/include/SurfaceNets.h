@@ -0,0 +1,272 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#ifndef __OHTSURFACENETS_H__
+#define __OHTSURFACENETS_H__
+
+#include "OverhangTerrainPrerequisites.h"
+#include "IsoSurfaceSharedTypes.h"
+#include "CubeDataRegionDescriptor.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace Ogre
+{
+	/** Naive Surface Nets, a cheaper alternative to Transvoxel for extracting iso-surfaces at coarse levels of detail
+	@remarks One vertex is placed in every cell that the surface passes through, at the average of the points where the surface
+		crosses the edges of the cell, and every edge crossed by the surface is spanned by a quad joining the vertices of the four
+		cells around it.  Cells beyond the sides of the cube are virtual, they are collapsed onto the side so that their vertices depend
+		only on the voxels flush with the side, which the neighbouring cube shares.  The surfaces of neighbouring cubes hence meet at 
+		identical vertices provided that both are extracted with Surface Nets at the same level of detail.  Sides facing a neighbour
+		of the next finer level of detail are instead spanned by seams across the edges of the finer level of detail in the side, 
+		see seam.  This class only addresses cells and determines the crossings and the topology, IsoSurfaceBuilder configures the 
+		vertices. */
+	class _OverhangTerrainPluginExport SurfaceNets
+	{
+	public:
+		/// Coordinates of a cell at some level of detail, -1 and the number of cells along the axis denote virtual cells beyond the sides
+		struct Cell
+		{
+			signed short x, y, z;
+		};
+
+		/// Grid-point bounds of a cell, collapsed onto the side along the axes that the cell is virtual on
+		struct Box
+		{
+			DimensionType x0, y0, z0, x1, y1, z1;
+		};
+
+		/// @param cubemeta The meta-information singleton describing every voxel cube region in the scene
+		SurfaceNets (const Voxel::CubeDataRegionDescriptor & cubemeta);
+
+		/// @returns The number of vertices of all levels of detail, one for every cell including the virtual ones
+		static size_t computeTotalElements (const Voxel::CubeDataRegionDescriptor & cubemeta);
+
+		/// @returns The number of levels of detail addressed, the coarsest one has a single cell
+		inline unsigned lodCount () const { return unsigned(_vOffsets.size() - 1); }
+
+		/// @returns The number of cells along each axis at the level of detail including the virtual ones
+		inline size_t span (const unsigned nLOD) const { return (_cubemeta.dimensions >> nLOD) + 2; }
+
+		/// @returns The ordinal of the vertex of the cell, unique amongst all levels of detail
+		inline size_t index (const unsigned nLOD, const Cell & cell) const
+		{
+			const size_t n = span(nLOD);
+
+			OgreAssert(nLOD < lodCount(), "Level of detail out of bounds");
+			return _vOffsets[nLOD] + (size_t(cell.z + 1) * n + size_t(cell.y + 1)) * n + size_t(cell.x + 1);
+		}
+
+		/// Computes the grid-point bounds of the cell at the level of detail
+		Box box (const unsigned nLOD, const Cell & cell) const;
+
+		/// @returns The cell of the next coarser level of detail containing the cell, virtual cells map to virtual cells
+		Cell coarsen (const unsigned nLOD, const Cell & cell) const;
+
+		/** Enumerates the edges of the box that the surface crosses
+		@param pValues The voxel values of the cube
+		@param box Bounds of the cell, edges of zero length along collapsed axes are skipped
+		@param fn Callback lambda function passed the voxel indices at either end of each edge crossed
+		@param nStep Length of the edges enumerated, zero for the edges of the box itself, otherwise every edge of this length 
+			in the lattice over the surface of the box is enumerated */
+		template< typename Fn >
+		void crossings (const FieldStrength * pValues, const Box & box, Fn fn, const DimensionType nStep = 0) const
+		{
+			const DimensionType 
+				lo[3] = { box.x0, box.y0, box.z0 },
+				hi[3] = { box.x1, box.y1, box.z1 };
+			DimensionType p[3];
+
+			for (unsigned a = 0; a < 3; ++a)
+			{
+				if (lo[a] == hi[a])
+					continue;
+
+				const unsigned b = (a + 1) % 3, c = (a + 2) % 3;
+				const DimensionType
+					sa = nStep > 0 ? nStep : DimensionType(hi[a] - lo[a]),
+					sb = std::max(nStep > 0 ? nStep : DimensionType(hi[b] - lo[b]), DimensionType(1)),
+					sc = std::max(nStep > 0 ? nStep : DimensionType(hi[c] - lo[c]), DimensionType(1));
+
+				// A collapsed axis yields its only coordinate once
+				for (DimensionType pb = lo[b]; pb <= hi[b]; pb += sb)
+					for (DimensionType pc = lo[c]; pc <= hi[c]; pc += sc)
+					{
+						// Lines through the interior of the box are not on its surface
+						if (lo[b] != hi[b] && lo[c] != hi[c] && pb != lo[b] && pb != hi[b] && pc != lo[c] && pc != hi[c])
+							continue;
+
+						for (DimensionType pa = lo[a]; pa < hi[a]; pa += sa)
+						{
+							p[a] = pa;
+							p[b] = pb;
+							p[c] = pc;
+							const VoxelIndex c0 = _cubemeta.getGridPointIndex(p[0], p[1], p[2]);
+
+							p[a] = pa + sa;
+							const VoxelIndex c1 = _cubemeta.getGridPointIndex(p[0], p[1], p[2]);
+
+							if ((pValues[c0] < 0) != (pValues[c1] < 0))
+								fn(c0, c1);
+						}
+					}
+			}
+		}
+
+		/** Enumerates the quads spanning the edges of a cell crossed by the surface
+		@remarks Every edge is visited by exactly one cell, the one with the greatest coordinates amongst those of the cube around it,
+			so that visiting every non-trivial cell of the cube yields every quad once.
+		@param pValues The voxel values of the cube
+		@param nLOD The level of detail, affects the size of the cells
+		@param x The grid-point x-coordinate of the origin of the cell
+		@param y The grid-point y-coordinate of the origin of the cell
+		@param z The grid-point z-coordinate of the origin of the cell
+		@param fn Callback lambda function passed an array of the four cells of each quad, counter-clockwise seen from the empty side */
+		template< typename Fn >
+		void quads (const FieldStrength * pValues, const unsigned nLOD, const DimensionType x, const DimensionType y, const DimensionType z, Fn fn) const
+		{
+			const DimensionType 
+				d = _cubemeta.dimensions,
+				s = DimensionType(1 << nLOD),
+				origin[3] = { x, y, z };
+			DimensionType p[3];
+			Cell cells[4];
+
+			for (unsigned a = 0; a < 3; ++a)
+			{
+				const unsigned b = (a + 1) % 3, c = (a + 2) % 3;
+
+				// Edges on the far sides of the cube belong to the last cells, they are not the origin of any cell
+				const DimensionType
+					nbN = origin[b] + s == d ? 2 : 1,
+					ncN = origin[c] + s == d ? 2 : 1;
+
+				for (DimensionType nb = 0; nb < nbN; ++nb)
+					for (DimensionType nc = 0; nc < ncN; ++nc)
+					{
+						p[a] = origin[a];
+						p[b] = origin[b] + nb*s;
+						p[c] = origin[c] + nc*s;
+						const bool bInside0 = pValues[_cubemeta.getGridPointIndex(p[0], p[1], p[2])] < 0;
+
+						p[a] = origin[a] + s;
+						const bool bInside1 = pValues[_cubemeta.getGridPointIndex(p[0], p[1], p[2])] < 0;
+
+						if (bInside0 == bInside1)
+							continue;
+
+						p[a] = origin[a];
+						surround(nLOD, p, a, bInside0, cells);
+						fn(cells);
+					}
+			}
+		}
+
+		/** Enumerates the quads spanning the edges in a side of the cube that the surface crosses at a level of detail
+		@remarks Used for stitching the side to a neighbour of that level of detail, the next finer one.  The edges along the
+			rim of the side are included.  Two of the cells of each quad are virtual cells beyond the side, the other two are 
+			inside the cube unless they lie beyond another side.
+		@param pValues The voxel values of the cube
+		@param nLOD The level of detail of the edges and cells, that of the neighbour
+		@param a The axis perpendicular to the side
+		@param bFar Whether the side lies at the far end of the axis rather than at the origin
+		@param fn Callback lambda function passed an array of the four cells of each quad, counter-clockwise seen from the empty side,
+			the grid-point coordinates of the near end of the edge, the axis of the edge, and whether the near end is inside */
+		template< typename Fn >
+		void seam (const FieldStrength * pValues, const unsigned nLOD, const unsigned a, const bool bFar, Fn fn) const
+		{
+			const DimensionType 
+				d = _cubemeta.dimensions,
+				s = DimensionType(1 << nLOD);
+			DimensionType p[3];
+			Cell cells[4];
+
+			p[a] = bFar ? d : 0;
+			for (unsigned i = 1; i < 3; ++i)
+			{
+				// Edges along axis e lie on lines spaced along the other axis of the side
+				const unsigned 
+					e = (a + i) % 3,
+					o = (a + 3 - i) % 3;
+
+				for (p[o] = 0; p[o] <= d; p[o] += s)
+					for (p[e] = 0; p[e] < d; p[e] += s)
+					{
+						const bool bInside0 = pValues[_cubemeta.getGridPointIndex(p[0], p[1], p[2])] < 0;
+
+						p[e] += s;
+						const bool bInside1 = pValues[_cubemeta.getGridPointIndex(p[0], p[1], p[2])] < 0;
+						p[e] -= s;
+
+						if (bInside0 == bInside1)
+							continue;
+
+						surround(nLOD, p, e, bInside0, cells);
+						fn(cells, p, e, bInside0);
+					}
+			}
+		}
+
+	private:
+		/** Determines the four cells around an edge
+		@param nLOD The level of detail, affects the size of the cells
+		@param p The grid-point coordinates of the near end of the edge
+		@param a The axis of the edge
+		@param bInside0 Whether the near end of the edge is inside
+		@param cells Receives the cells counter-clockwise seen from the empty side */
+		inline void surround (const unsigned nLOD, const DimensionType (& p)[3], const unsigned a, const bool bInside0, Cell (& cells)[4]) const
+		{
+			const unsigned b = (a + 1) % 3, c = (a + 2) % 3;
+			signed short q[3];
+
+			// The four cells around the edge, counter-clockwise about the axis of the edge
+			static const signed short around[4][2] = { { -1, -1 }, { 0, -1 }, { 0, 0 }, { -1, 0 } };
+			for (unsigned i = 0; i < 4; ++i)
+			{
+				// Wind counter-clockwise about the direction from the inside end of the edge to the outside end
+				const unsigned k = bInside0 ? i : 3 - i;
+
+				q[a] = static_cast< signed short >(p[a] >> nLOD);
+				q[b] = static_cast< signed short >(p[b] >> nLOD) + around[k][0];
+				q[c] = static_cast< signed short >(p[c] >> nLOD) + around[k][1];
+
+				cells[i].x = q[0];
+				cells[i].y = q[1];
+				cells[i].z = q[2];
+			}
+		}
+
+		/// The meta-information singleton describing every voxel cube region in the scene
+		const Voxel::CubeDataRegionDescriptor & _cubemeta;
+		/// Offset of the first vertex of each level of detail followed by the total number of vertices
+		std::vector< size_t > _vOffsets;
+	};
+}
+
+#endif
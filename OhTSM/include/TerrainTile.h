@@ -193,20 +193,24 @@ namespace Ogre
 			boundaries it selects the adjacent terrain-tile and recursively traverses that one calling this method again if the cascade flag 
 			is set.  The result of the query is stored in the specified result parameter and method return value.
 			The search would complete if either the ray hit something or the distance limit of the parameters object was reached or the page
-			boundaries were reached.  The query is limited to the channels specified in the parameters object.  Must be called from the main thread.
+			boundaries were reached.  The query is limited to the channels specified in the parameters object.  Must be called from the main thread
+			unless the query is part of a batch.
 		@param result The result of the ray query is stored here
 		@param params Parameters influencing the ray query including the set of channels to restrict the query to and the maximum length of
 			the ray to search treating the ray as a line segment to eliminate the inevitable infinite search for true orthodox rays or
 			specify zero for no limit
 		@param distance The distance traversed so far in this query since the first terrain-tile in the parent page was queried
 		@param i The ray iterator for traversing terrain tiles and metafragments within this page initialized with the page-local world-space ray
+		@param pCopies Copies of voxel values shared by the rays of a batch queried in a background thread, meta-fragments are then only share-locked 
+			and their voxel fields are intersected at full resolution (RQM_Field), NULL for a single query in the main thread
 		@returns True if the intersection passed and a triangle in a surface was intersected by the ray, false if nothing was hit
 		*/
 		bool rayIntersects(
 			OverhangTerrainManager::RayResult & result, 
 			const OverhangTerrainManager::RayQueryParams & params,
 			const Real distance,
-			DiscreteRayIterator & i
+			DiscreteRayIterator & i,
+			Voxel::ValuesCache * pCopies = NULL
 		) const;
 
 		/// Persists this terrain-tile and its meta-fragments to the stream, can be background
@@ -225,6 +229,9 @@ namespace Ogre
 		@param encsTo The coordinate space to return the bounds in
 		@returns A bounding box of the region in the specified coordinate space relative to the page as a multiple of the specified Y-level */
 		AxisAlignedBox getYLevelBounds (const YLevel yl, const OverhangCoordinateSpace encsTo = OCS_Terrain) const;
+
+		/// Translates the page-relative world-space point where a ray enters the meta-fragment at the specified Y-level to its data-grid space clamped within the voxel cube
+		Vector3 computeFragmentOrigin (const YLevel yl, const Vector3 & intersection) const;
 		
 		/// Creates or retrieves a meta-fragment in the specified channel of this terrain-tile at the specified Y-level which is analogous to a vertical coordinate
 		MetaFragment::Container * acquireMetaWorldFragment (const Channel::Ident channel, const YLevel yl);
@@ -25,17 +25,29 @@
 //
 //================================================================================
 
-// The RegularCellData structure holds information about the triangulation
-// used for a single equivalence class in the modified Marching Cubes algorithm,
-// described in Section 3.2.
+// The RegularCaseData and TransitionCaseData structures hold everything needed to triangulate
+// a single cell case, so that one look-up of a single cache line suffices per cell. They are
+// flattened from the class, triangulation and vertex location tables described in the paper.
 
 #ifndef __TRANSVOXELTABLES_H__
 #define __TRANSVOXELTABLES_H__
 
+// Case records are aligned to cache lines so that a record never straddles two of them
+#ifdef _MSC_VER
+#define OHT_TRANSVOXEL_ALIGNED __declspec(align(64))
+#else
+#define OHT_TRANSVOXEL_ALIGNED __attribute__((aligned(64)))
+#endif
+
 namespace Ogre
 {
-	struct RegularCellData
+	// The RegularCaseData structure holds the vertex locations of a single case in the modified
+	// Marching Cubes algorithm along with the triangulation of the equivalence class, described in
+	// Section 3.2, that the case maps to.
+
+	struct OHT_TRANSVOXEL_ALIGNED RegularCaseData
 	{
+		unsigned short	vertexData[12];		// Vertex locations and reuse data, see regularCaseData below.
 		unsigned char	geometryCounts;		// High nibble is vertex count, low nibble is triangle count.
 		unsigned char	vertexIndex[15];	// Groups of 3 indexes giving the triangulation.
 
@@ -51,13 +63,14 @@ namespace Ogre
 	};
 
 
-	// The TransitionCellData structure holds information about the triangulation
-	// used for a single equivalence class in the Transvoxel Algorithm transition cell,
-	// described in Section 4.3.
+	// The TransitionCaseData structure holds the vertex locations of a single transition cell case
+	// in the Transvoxel Algorithm along with the triangulation of the equivalence class, described in
+	// Section 4.3, that the case maps to.
 
-	struct TransitionCellData
+	struct OHT_TRANSVOXEL_ALIGNED TransitionCaseData
 	{
-		long			geometryCounts;		// High nibble is vertex count, low nibble is triangle count.
+		unsigned short	vertexData[12];		// Vertex locations and reuse data, see transitionCaseData below.
+		unsigned char	geometryCounts;		// High nibble is vertex count, low nibble is triangle count.
 		unsigned char	vertexIndex[36];	// Groups of 3 indexes giving the triangulation.
 
 		long GetVertexCount(void) const
@@ -72,44 +85,13 @@ namespace Ogre
 	};
 
 
-	// The regularCellClass table maps an 8-bit regular Marching Cubes case index to
-	// an equivalence class index. Even though there are 18 equivalence classes in our
-	// modified Marching Cubes algorithm, a couple of them use the same exact triangulations,
-	// just with different vertex locations. We combined those classes for this table so
-	// that the class index ranges from 0 to 15.
-
-	const extern unsigned char regularCellClass[256];
-
-
-	// The regularCellData table holds the triangulation data for all 16 distinct classes to
-	// which a case can be mapped by the regularCellClass table.
-
-	const extern RegularCellData regularCellData[16];
-
-	// The regularVertexData table gives the vertex locations for every one of the 256 possible
-	// cases in the modified Marching Cubes algorithm. Each 16-bit value also provides information
-	// about whether a vertex can be reused from a neighboring cell. See Section 3.3 for details.
-	// The low byte contains the indexes for the two endpoints of the edge on which the vertex lies,
-	// as numbered in Figure 3.7. The high byte contains the vertex reuse data shown in Figure 3.8.
-
-	const extern unsigned short regularVertexData[256][12];
-
-
-	// The transitionCellClass table maps a 9-bit transition cell case index to an equivalence
-	// class index. Even though there are 73 equivalence classes in the Transvoxel Algorithm,
-	// several of them use the same exact triangulations, just with different vertex locations.
-	// We combined those classes for this table so that the class index ranges from 0 to 55.
-	// The high bit is set in the cases for which the inverse state of the voxel data maps to
-	// the equivalence class, meaning that the winding order of each triangle should be reversed.
-
-	const extern unsigned char transitionCellClass[512];
-
-
-	// The transitionCellData table holds the triangulation data for all 56 distinct classes to
-	// which a case can be mapped by the transitionCellClass table. The class index should be ANDed
-	// with 0x7F before using it to look up triangulation data in this table.
+	// The regularCaseData table holds the case record for every one of the 256 possible cases in the
+	// modified Marching Cubes algorithm. Each 16-bit vertex location also provides information about
+	// whether a vertex can be reused from a neighboring cell. See Section 3.3 for details. The low byte
+	// contains the indexes for the two endpoints of the edge on which the vertex lies, as numbered in
+	// Figure 3.7. The high byte contains the vertex reuse data shown in Figure 3.8.
 
-	const extern TransitionCellData transitionCellData[56];
+	const extern RegularCaseData regularCaseData[256];
 
 
 	// The transitionCornerData table contains the transition cell corner reuse data
@@ -118,13 +100,14 @@ namespace Ogre
 	const extern unsigned char transitionCornerData[13];
 
 
-	// The transitionVertexData table gives the vertex locations for every one of the 512 possible
-	// cases in the Transvoxel Algorithm. Each 16-bit value also provides information about whether
-	// a vertex can be reused from a neighboring cell. See Section 4.5 for details. The low byte
-	// contains the indexes for the two endpoints of the edge on which the vertex lies, as numbered
-	// in Figure 4.16. The high byte contains the vertex reuse data shown in Figure 4.18.
+	// The transitionCaseData table holds the case record for every one of the 512 possible cases in
+	// the Transvoxel Algorithm. Each 16-bit vertex location also provides information about whether a
+	// vertex can be reused from a neighboring cell. See Section 4.5 for details. The low byte contains
+	// the indexes for the two endpoints of the edge on which the vertex lies, as numbered in Figure 4.16.
+	// The high byte contains the vertex reuse data shown in Figure 4.18. Triangles of the cases for which
+	// the inverse state of the voxel data maps to the equivalence class are stored with reversed winding.
 
-	const extern unsigned short transitionVertexData[512][12];
+	const extern TransitionCaseData transitionCaseData[512];
 }
 
 #endif
\ No newline at end of file
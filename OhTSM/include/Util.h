@@ -1440,6 +1440,88 @@ namespace Ogre
 		}
 	};
 
+	/** Fixed-size array whose elements can all be reset to a default value in constant time
+	@remarks Each element is tagged with the generation it was last touched in, an element tagged with an earlier generation 
+		reads as the default value.  Clearing the array merely advances the generation, the tags are only actually reset when 
+		the generation counter wraps-around. */
+	template< typename T >
+	class GenerationalArray
+	{
+	private:
+		typedef unsigned short Generation;
+
+		/// The element storage and the generation tag of each element
+		T * const _vValues;
+		Generation * const _vGenerations;
+		/// The current generation, elements not tagged with this are stale
+		Generation _generation;
+		/// Value of elements that have not been touched since the last clear
+		const T _default;
+
+		GenerationalArray (const GenerationalArray &);
+
+	public:
+		/// The total number of elements
+		const size_t count;
+
+		/**
+		@param nCount The number of elements
+		@param defval Value of elements that have not been assigned since the last clear
+		*/
+		GenerationalArray (const size_t nCount, const T & defval)
+			: _vValues(new T[nCount]), _vGenerations(new Generation[nCount]), _generation(1), _default(defval), count(nCount)
+		{
+			memset(_vGenerations, 0, sizeof(Generation) * nCount);
+		}
+		~GenerationalArray()
+		{
+			delete [] _vValues;
+			delete [] _vGenerations;
+		}
+
+		/// Resets all elements to the default value
+		inline void clear ()
+		{
+			if (++_generation == 0)
+			{
+				memset(_vGenerations, 0, sizeof(Generation) * count);
+				_generation = 1;
+			}
+		}
+
+		/// @returns The element at the specified index or the default value if it is stale, reading never modifies the array
+		inline
+		const T & operator [] (const size_t i) const
+		{
+			OgreAssert(i < count, "Index out of bounds");
+			return _vGenerations[i] == _generation ? _vValues[i] : _default;
+		}
+
+		/** Retrieves a modifiable reference to an element, a stale element is reset to the default value and tagged with the current generation first
+		@remarks Touching an element that is already current writes nothing
+		*/
+		inline
+		T & touch (const size_t i)
+		{
+			OgreAssert(i < count, "Index out of bounds");
+			if (_vGenerations[i] != _generation)
+			{
+				_vGenerations[i] = _generation;
+				_vValues[i] = _default;
+			}
+			return _vValues[i];
+		}
+
+		/// Assigns an element and tags it with the current generation
+		inline
+		void set (const size_t i, const T & value)
+		{
+			OgreAssert(i < count, "Index out of bounds");
+			_vGenerations[i] = _generation;
+			_vValues[i] = value;
+		}
+	};
+
 	/// Computes the cross product of two vectors
 	inline Vector3 CROSS(const Vector3 & a, const Vector3 & b)
 	{
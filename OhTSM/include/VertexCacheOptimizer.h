@@ -0,0 +1,101 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#ifndef __OHTVERTEXCACHEOPTIMIZER_H__
+#define __OHTVERTEXCACHEOPTIMIZER_H__
+
+#include "OverhangTerrainPrerequisites.h"
+#include "IsoSurfaceSharedTypes.h"
+
+#include <vector>
+
+namespace Ogre
+{
+	/** Reorders triangle lists for locality in the post-transform vertex cache of the GPU
+	@remarks Implements Tom Forsyth's "Linear-Speed Vertex Cache Optimisation", triangles are emitted greedily by a score
+		derived from the position of their vertices in a simulated LRU cache and from how many triangles still reference them.
+		The scratch space is retained between calls, an instance should be re-used by a single thread.  Also provides the
+		average cache miss ratio (ACMR) metric for measuring the quality of a triangle order on the CPU. */
+	class _OverhangTerrainPluginExport VertexCacheOptimizer
+	{
+	public:
+		/// Number of entries of the simulated LRU cache used for scoring vertices
+		static const size_t CacheSize = 32;
+
+		/** Determines a triangle order optimized for the post-transform vertex cache
+		@param pIndices The triangle list, three vertex indices per triangle
+		@param nTriangleCount The number of triangles in the list
+		@param nVertexCount One more than the greatest vertex index referenced by the triangle list
+		@param vOrder (out) Receives the ordinals of all triangles of the list in their optimized order */
+		void optimize (const HWVertexIndex * pIndices, const size_t nTriangleCount, const size_t nVertexCount, std::vector< size_t > & vOrder);
+
+		/** Counts the vertices transformed when rendering a triangle list with a FIFO post-transform vertex cache
+		@param pIndices The triangle list, three vertex indices per triangle
+		@param nTriangleCount The number of triangles in the list
+		@param nCacheSize Number of entries of the simulated FIFO cache
+		@returns The number of vertex references that missed the cache */
+		static size_t countCacheMisses (const HWVertexIndex * pIndices, const size_t nTriangleCount, const size_t nCacheSize = 16);
+
+		/** Computes the average cache miss ratio (ACMR), the average number of vertices transformed per triangle
+		@remarks Ranges from 3 (no re-use at all) down to roughly 0.5 for an ideally ordered regular grid
+		@param pIndices The triangle list, three vertex indices per triangle
+		@param nTriangleCount The number of triangles in the list
+		@param nCacheSize Number of entries of the simulated FIFO cache */
+		static Real computeACMR (const HWVertexIndex * pIndices, const size_t nTriangleCount, const size_t nCacheSize = 16);
+
+	private:
+		/// Optimization state of a single vertex
+		struct Vertex
+		{
+			/// Current score of the vertex
+			float score;
+			/// Position in the simulated LRU cache, negative if not cached
+			int cached;
+			/// Number of triangles not emitted yet that reference the vertex
+			unsigned remaining;
+			/// Offset of the triangles referencing the vertex into the adjacency list
+			size_t adjacency;
+		};
+
+		/// State of every vertex referenced by the triangle list being optimized
+		std::vector< Vertex > _vVertices;
+		/// Triangles referencing each vertex, those not emitted yet come first in the range of each vertex
+		std::vector< size_t > _vAdjacency;
+		/// Current score of each triangle
+		std::vector< float > _vTriangleScores;
+		/// Whether each triangle was emitted already
+		std::vector< bool > _vEmitted;
+
+		/** Computes the score of a vertex
+		@param nCachePosition Position in the simulated LRU cache, negative if not cached
+		@param nRemaining Number of triangles not emitted yet that reference the vertex */
+		static float score (const int nCachePosition, const unsigned nRemaining);
+	};
+}
+
+#endif
@@ -0,0 +1,270 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#include "pch.h"
+
+#include "BuildCache.h"
+
+#include <limits>
+
+namespace Ogre
+{
+	/// Writes the element count of a vector followed by its elements verbatim
+	template< typename T >
+	static void writeVector (StreamSerialiser & output, const std::vector< T > & v)
+	{
+		const uint32 nCount = static_cast< uint32 > (v.size());
+
+		output.write(&nCount);
+		if (nCount > 0)
+			output.writeData(&v.front(), sizeof(T), nCount);
+	}
+
+	/// Reads a vector written by writeVector
+	template< typename T >
+	static void readVector (StreamSerialiser & input, std::vector< T > & v)
+	{
+		uint32 nCount;
+
+		input.read(&nCount);
+		v.resize(nCount);
+		if (nCount > 0)
+			input.readData(&v.front(), sizeof(T), nCount);
+	}
+
+	bool BuildCache::Key::operator < ( const Key & other ) const
+	{
+		if (content != other.content)
+			return content < other.content;
+		if (channel != other.channel)
+			return channel < other.channel;
+		if (halo != other.halo)
+			return halo < other.halo;
+		if (lod != other.lod)
+			return lod < other.lod;
+		if (stitches != other.stitches)
+			return stitches < other.stitches;
+		if (surfaceFlags != other.surfaceFlags)
+			return surfaceFlags < other.surfaceFlags;
+		if (vertexSize != other.vertexSize)
+			return vertexSize < other.vertexSize;
+		if (indexSize != other.indexSize)
+			return indexSize < other.indexSize;
+		return scale < other.scale;
+	}
+
+	StreamSerialiser & BuildCache::Key::operator >> ( StreamSerialiser & output ) const
+	{
+		const uint64 nContent = content, nHalo = halo;
+		const uint32 
+			nLOD = lod, 
+			nStitches = stitches, 
+			nSurfaceFlags = static_cast< uint32 > (surfaceFlags), 
+			nVertexSize = static_cast< uint32 > (vertexSize), 
+			nIndexSize = static_cast< uint32 > (indexSize);
+
+		output.write(&nContent);
+		output.write(&channel);
+		output.write(&nHalo);
+		output.write(&nLOD);
+		output.write(&nStitches);
+		output.write(&nSurfaceFlags);
+		output.write(&nVertexSize);
+		output.write(&nIndexSize);
+		output.write(&scale);
+
+		return output;
+	}
+
+	StreamSerialiser & BuildCache::Key::operator << ( StreamSerialiser & input )
+	{
+		uint64 nContent, nHalo;
+		uint32 nLOD, nStitches, nSurfaceFlags, nVertexSize, nIndexSize;
+
+		input.read(&nContent);
+		input.read(&channel);
+		input.read(&nHalo);
+		input.read(&nLOD);
+		input.read(&nStitches);
+		input.read(&nSurfaceFlags);
+		input.read(&nVertexSize);
+		input.read(&nIndexSize);
+		input.read(&scale);
+
+		content = nContent;
+		halo = nHalo;
+		lod = nLOD;
+		stitches = static_cast< Touch3DFlags > (nStitches);
+		surfaceFlags = nSurfaceFlags;
+		vertexSize = nVertexSize;
+		indexSize = nIndexSize;
+
+		return input;
+	}
+
+	size_t BuildCache::Entry::size() const
+	{
+		size_t nBytes = 
+			sizeof(*this) + 
+			vertices.size() + 
+			indices.size() + 
+			shipment.size() * sizeof(IsoVertexIndex) + 
+			regCases.size() * sizeof(NonTrivialRegularCase) +
+			(borderIsoVertexProperties.size() + middleIsoVertexProperties.size()) * sizeof(BorderIsoVertexProperties);
+
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			nBytes += transCases[s].size() * sizeof(NonTrivialTransitionCase);
+
+		return nBytes;
+	}
+
+	StreamSerialiser & BuildCache::Entry::operator >> ( StreamSerialiser & output ) const
+	{
+		writeVector(output, vertices);
+		writeVector(output, indices);
+		writeVector(output, shipment);
+		writeVector(output, regCases);
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			writeVector(output, transCases[s]);
+		writeVector(output, borderIsoVertexProperties);
+		writeVector(output, middleIsoVertexProperties);
+		output.write(stitched, CountOrthogonalNeighbors);
+
+		return output;
+	}
+
+	StreamSerialiser & BuildCache::Entry::operator << ( StreamSerialiser & input )
+	{
+		readVector(input, vertices);
+		readVector(input, indices);
+		readVector(input, shipment);
+		readVector(input, regCases);
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			readVector(input, transCases[s]);
+		readVector(input, borderIsoVertexProperties);
+		readVector(input, middleIsoVertexProperties);
+		input.read(stitched, CountOrthogonalNeighbors);
+
+		return input;
+	}
+
+	uint32 BuildCache::Entry::getLayout()
+	{
+		return 
+			static_cast< uint32 > (sizeof(IsoVertexIndex)) |
+			static_cast< uint32 > (sizeof(NonTrivialRegularCase)) << 8 |
+			static_cast< uint32 > (sizeof(NonTrivialTransitionCase)) << 16 |
+			static_cast< uint32 > (sizeof(BorderIsoVertexProperties)) << 24;
+	}
+
+	BuildCache::BuildCache( const size_t nCapacity )
+		: _nCapacity(nCapacity), _nBytes(0), _nHits(0), _nMisses(0)
+	{}
+
+	BuildCache::EntryPtr BuildCache::find( const Key & key )
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		EntryMap::iterator i = _mapEntries.find(key);
+
+		if (i == _mapEntries.end())
+		{
+			++_nMisses;
+			return EntryPtr();
+		}
+
+		++_nHits;
+		_lEntries.splice(_lEntries.begin(), _lEntries, i->second);
+		return i->second->second;
+	}
+
+	void BuildCache::insert( const Key & key, const EntryPtr & pEntry )
+	{
+		const size_t nSize = pEntry->size();
+
+		if (nSize > _nCapacity)
+			return;
+
+		boost::mutex::scoped_lock lock(_mutex);
+
+		EntryMap::iterator i = _mapEntries.find(key);
+
+		if (i != _mapEntries.end())
+		{
+			_nBytes -= i->second->second->size();
+			_lEntries.erase(i->second);
+			_mapEntries.erase(i);
+		}
+
+		while (_nBytes + nSize > _nCapacity)
+		{
+			_nBytes -= _lEntries.back().second->size();
+			_mapEntries.erase(_lEntries.back().first);
+			_lEntries.pop_back();
+		}
+
+		_lEntries.push_front(std::make_pair(key, pEntry));
+		_mapEntries[key] = _lEntries.begin();
+		_nBytes += nSize;
+	}
+
+	void BuildCache::collect( const unsigned long long content, const uint16 channel, EntryVector & entries ) const
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		// Keys are ordered by content and channel first, so all configurations of them are adjacent starting from the least key
+		Key least;
+		least.content = content;
+		least.channel = channel;
+		least.halo = 0;
+		least.lod = 0;
+		least.stitches = T3DS_None;
+		least.surfaceFlags = least.vertexSize = least.indexSize = 0;
+		least.scale = -std::numeric_limits< Real >::max();
+
+		for (EntryMap::const_iterator i = _mapEntries.lower_bound(least); i != _mapEntries.end() && i->first.content == content && i->first.channel == channel; ++i)
+			entries.push_back(*i->second);
+	}
+
+	void BuildCache::getStatistics( size_t & nHits, size_t & nMisses, size_t & nEntries, size_t & nBytes ) const
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		nHits = _nHits;
+		nMisses = _nMisses;
+		nEntries = _lEntries.size();
+		nBytes = _nBytes;
+	}
+
+	void BuildCache::resetStatistics()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		_nHits = _nMisses = 0;
+	}
+}
@@ -39,16 +39,26 @@ namespace Ogre
 {
 	namespace Voxel
 	{
-		CubeDataRegion::CubeDataRegion( const size_t nVRFlags, DataBasePool * pPool, const CubeDataRegionDescriptor & dgtmpl, const AxisAlignedBox & bbox /* = AxisAlignedBox::BOX_NULL */)
+		CubeDataRegion::CubeDataRegion( const size_t nVRFlags, DataBasePool * pPool, const CubeDataRegionDescriptor & dgtmpl, const AxisAlignedBox & bbox /* = AxisAlignedBox::BOX_NULL */, DataBaseCache * pCache /*= NULL*/)
 		  : meta(dgtmpl), _nVRFlags(nVRFlags), _pPool(pPool),
+			_pCache(pCache),
+			_pResident(NULL),
+			_nResidentDirty(0),
+			_nResidentLeases(0),
 			_bbox(bbox),
-			_compression(new CompressedDataBase(nVRFlags))
+			_compression(new CompressedDataBase(nVRFlags)),
+			_occupancy(dgtmpl),
+			_nContentHash(0),
+			_bContentHash(false)
 		{
 		}
 
 		CubeDataRegion::~CubeDataRegion()
 		{
 			OHT_DBGTRACE("Delete " << this);
+			if (_pCache != NULL)
+				_pCache->remove(this);
+			delete _pResident;
 			delete _compression;
 		}
 
@@ -131,69 +141,226 @@ namespace Ogre
 			input.read(&_bbox);
 			data << input;
 
+			if (_pResident != NULL)
+			{
+				// Resident voxels are stale now, refresh them and recover the signs from them
+				populate(_pResident);
+				_nResidentDirty = 0;
+				_occupancy.update(_pResident->values);
+			} else
+			{
+				// The voxels were replaced wholesale, recover their signs without going through the data-base pool
+				std::vector< FieldStrength > vValues (meta.gpcount);
+				_compression->values.decompress(meta.gpcount, reinterpret_cast< unsigned char * > (vValues.data()));
+				_occupancy.update(vValues.data());
+			}
+			_bContentHash = false;
+
 			return input;
 		}
 
 		DataAccessor CubeDataRegion::lease()
 		{
-			DataBase * pDataBucket = _pPool->lease();
-			populate(pDataBucket);
+			DataBase * pDataBucket = acquire();
 			return DataAccessor (_mutex, pDataBucket, this, meta);
 		}
 
 		const_DataAccessor CubeDataRegion::lease() const
 		{
-			DataBase * pDataBucket = _pPool->lease();
-			populate(pDataBucket);
+			DataBase * pDataBucket = acquire();
 			return const_DataAccessor (_mutex, pDataBucket, this, meta);
 		}
 
 		DataAccessor * CubeDataRegion::lease_p()
 		{
-			DataBase * pDataBucket = _pPool->lease();
-			populate(pDataBucket);
+			DataBase * pDataBucket = acquire();
 			return new DataAccessor (_mutex, pDataBucket, this, meta);
 		}
 
 		const_DataAccessor * CubeDataRegion::lease_p() const
 		{
-			DataBase * pDataBucket = _pPool->lease();
-			populate(pDataBucket);
+			DataBase * pDataBucket = acquire();
 			return new const_DataAccessor (_mutex, pDataBucket, this, meta);
 		}
 
+		const_DataAccessor CubeDataRegion::lease( const size_t nChannels ) const
+		{
+			DataBase * pDataBucket = acquire(nChannels | DataBase::DBC_Values);
+			return const_DataAccessor (_mutex, pDataBucket, this, meta, nChannels);
+		}
+
+		const_ValuesAccessor CubeDataRegion::leaseValues() const
+		{
+			return const_ValuesAccessor(lease(DataBase::DBC_Values));
+		}
+
 		CompressedDataAccessor CubeDataRegion::clease()
 		{
+			boost::recursive_mutex::scoped_lock lock(_mutex);
+
+			commit();
 			return CompressedDataAccessor(_mutex, _compression);
 		}
 
 		const_CompressedDataAccessor CubeDataRegion::clease() const
 		{
+			boost::recursive_mutex::scoped_lock lock(_mutex);
+
+			commit();
 			return const_CompressedDataAccessor(_mutex, _compression);
 		}
 
+		void CubeDataRegion::extractValues( 
+			const DimensionType x0, const DimensionType y0, const DimensionType z0, 
+			const DimensionType x1, const DimensionType y1, const DimensionType z1, 
+			FieldStrength * pDest 
+		) const
+		{
+			OgreAssert(x0 <= x1 && y0 <= y1 && z0 <= z1, "Invalid box");
+			OgreAssert(x1 <= meta.dimensions && y1 <= meta.dimensions && z1 <= meta.dimensions, "Box exceeds region dimensions");
+			OgreAssert(meta.coordsIndexTx.mx == 1, "Expected voxels to be contiguous along the x-axis");
+
+			boost::recursive_mutex::scoped_lock lock(_mutex);
+
+			const size_t nRow = x1 - x0 + 1;
+
+			// Rows along x are contiguous, so the box is extracted one row at a time
+			for (DimensionType z = z0; z <= z1; ++z)
+				for (DimensionType y = y0; y <= y1; ++y)
+				{
+					const VoxelIndex nFirst = meta.getGridPointIndex(x0, y, z);
+
+					// Resident voxels are authoritative, the compressed ones may be stale until the region is committed
+					if (_pResident != NULL)
+						memcpy(pDest, &_pResident->values[nFirst], nRow * sizeof(FieldStrength));
+					else
+						_compression->values.decompress(meta.gpcount, nFirst, nRow, reinterpret_cast< unsigned char * > (pDest));
+
+					pDest += nRow;
+				}
+		}
+
+		FieldStrength CubeDataRegion::getValue( const DimensionType x, const DimensionType y, const DimensionType z ) const
+		{
+			FieldStrength value;
+			extractValues(x, y, z, x, y, z, &value);
+			return value;
+		}
+
+		SignOccupancy CubeDataRegion::getOccupancy() const
+		{
+			boost::recursive_mutex::scoped_lock lock(_mutex);
+			return _occupancy;
+		}
+
+		unsigned long long CubeDataRegion::getContentHash() const
+		{
+			boost::recursive_mutex::scoped_lock lock(_mutex);
+
+			commit();
+			if (!_bContentHash)
+			{
+				_nContentHash = _compression->computeCRC();
+				_bContentHash = true;
+			}
+			return _nContentHash;
+		}
+
 		void CubeDataRegion::released( DataBase * pDataBucket )
 		{
-			*_compression << *pDataBucket;
+			const size_t nModified = pDataBucket->modified;
+
+			pDataBucket->modified = 0;
+			if (nModified != 0)
+			{
+				// Resident voxels are compressed lazily, when they are evicted or the compressed form is needed
+				if (pDataBucket == _pResident)
+					_nResidentDirty |= nModified;
+				else
+					_compression->commit(*pDataBucket, nModified);
+
+				if (nModified & DataBase::DBC_Values)
+					_occupancy.update(pDataBucket->values);
+				_bContentHash = false;
+			}
 			released(const_cast< const DataBase * > (pDataBucket));
 		}
 		void CubeDataRegion::released( const DataBase * pDataBucket ) const
 		{
-			_pPool->retire(pDataBucket);
+			if (pDataBucket == _pResident)
+				--_nResidentLeases;
+			else
+				_pPool->retire(pDataBucket);
+		}
+
+		void CubeDataRegion::populate( DataBase * pDataBucket, const size_t nChannels /*= DataBase::DBC_All*/ ) const
+		{
+			_compression->extract(*pDataBucket, nChannels);
+			pDataBucket->modified = 0;
 		}
 
-		void CubeDataRegion::populate( DataBase * pDataBucket ) const
+		DataBase * CubeDataRegion::acquire( const size_t nChannels /*= DataBase::DBC_All*/ ) const
 		{
-			*_compression >> *pDataBucket;
+			if (_pCache != NULL)
+			{
+				boost::recursive_mutex::scoped_lock lock(_mutex);
+				const bool bHit = _pResident != NULL;
+
+				// Resident voxels serve partial leases as well, but only leases of every channel make a region resident
+				if (bHit || (nChannels & getChannels()) == getChannels())
+				{
+					// Resident data-bases outlive the thread that leased them first so they are not checked-out of the pool
+					if (!bHit)
+					{
+						_pResident = new DataBase(meta.gpcount, _nVRFlags);
+						populate(_pResident);
+						_nResidentDirty = 0;
+					}
+
+					// Counted before touching the cache so that the region is passed over for eviction
+					++_nResidentLeases;
+					_pCache->touch(this, _pResident->size(), bHit);
+
+					return _pResident;
+				}
+			}
+
+			DataBase * pDataBucket = _pPool->lease();
+			populate(pDataBucket, nChannels);
+			return pDataBucket;
+		}
+
+		void CubeDataRegion::commit() const
+		{
+			if (_pResident != NULL && _nResidentDirty != 0)
+			{
+				_compression->commit(*_pResident, _nResidentDirty);
+				_nResidentDirty = 0;
+			}
+		}
+
+		bool CubeDataRegion::evict() const
+		{
+			boost::recursive_mutex::scoped_try_lock lock(_mutex);
+
+			if (!lock.owns_lock() || _nResidentLeases > 0)
+				return false;
+
+			commit();
+			delete _pResident;
+			_pResident = NULL;
+
+			return true;
 		}
 
 		const_DataAccessor::const_DataAccessor( 
 			boost::recursive_mutex & mutex, 
 			const DataBase * pBucket, 
 			const IDataBaseHook * pDataBaseHook,
-			const CubeDataRegionDescriptor & dgtmpl 
+			const CubeDataRegionDescriptor & dgtmpl,
+			const size_t nChannels
 		)
-			: template_DataAccessor(mutex, pBucket, pDataBaseHook, dgtmpl)
+			: template_DataAccessor(mutex, pBucket, pDataBaseHook, dgtmpl, nChannels)
 		{}
 
 		const_DataAccessor::const_DataAccessor( const const_DataAccessor & copy) 
@@ -204,6 +371,10 @@ namespace Ogre
 			: template_DataAccessor(static_cast< template_DataAccessor && > (move)) 
 		{}
 
+		const_ValuesAccessor::const_ValuesAccessor( const const_DataAccessor & access )
+			: const_DataAccessor(access)
+		{}
+
 		DataAccessor::EmptySet DataAccessor::getEmptyStatus()
 		{
 			FieldStrength acc = 0;
@@ -223,6 +394,7 @@ namespace Ogre
 
 		void DataAccessor::updateGradient()
 		{
+			touch(DataBase::DBC_Gradient);
 			for (FieldAccessor::gradient_iterator i = voxels.iterate_gradient(0); i; ++i)
 				gradients.dx[i.index()] = i->left - i->right;
 			for (FieldAccessor::gradient_iterator i = voxels.iterate_gradient(1); i; ++i)
@@ -233,6 +405,7 @@ namespace Ogre
 	
 		void DataAccessor::reset()
 		{
+			touch(DataBase::DBC_Values | DataBase::DBC_Gradient);
 			voxels.clear();
 			gradients.clear();
 		}
@@ -240,6 +413,7 @@ namespace Ogre
 		void DataAccessor::clear()
 		{
 			reset();
+			touch(DataBase::DBC_Colours);
 			colours.clear();
 		}
 
@@ -249,7 +423,7 @@ namespace Ogre
 			IDataBaseHook * pDataBaseHook,
 			const CubeDataRegionDescriptor & dgtmpl 
 		)
-			: template_DataAccessor(mutex, pBucket, pDataBaseHook, dgtmpl)
+			: template_DataAccessor(mutex, pBucket, pDataBaseHook, dgtmpl, DataBase::DBC_All)
 		{}
 
 		DataAccessor::DataAccessor( const DataAccessor & copy ) 
@@ -263,7 +437,8 @@ namespace Ogre
 		CompressedDataBase::CompressedDataBase( const size_t nVRFlags )
 		:	gradfield(nVRFlags & VRF_Gradient ? new GradientChannels : NULL),
 			colors(nVRFlags & VRF_Colours ? new ColorChannels : NULL),
-			texcoords(nVRFlags & VRF_TexCoords ? new TexCoordChannels : NULL)
+			texcoords(nVRFlags & VRF_TexCoords ? new TexCoordChannels : NULL),
+			values(ValuesIndexInterval)
 		{
 
 		}
@@ -277,16 +452,22 @@ namespace Ogre
 
 		void CompressedDataBase::operator<<( const DataBase & database )
 		{
-			values.compress(database.count, reinterpret_cast< unsigned char * > (database.values));
+			commit(database, DataBase::DBC_All);
+		}
+
+		void CompressedDataBase::commit( const DataBase & database, const size_t nChannels )
+		{
+			if (nChannels & DataBase::DBC_Values)
+				values.compress(database.count, reinterpret_cast< unsigned char * > (database.values));
 
-			if (gradfield != NULL)
+			if (gradfield != NULL && (nChannels & DataBase::DBC_Gradient))
 			{
 				gradfield->dx.compress(database.count, reinterpret_cast< const unsigned char * > (database.dx));
 				gradfield->dy.compress(database.count, reinterpret_cast< const unsigned char * > (database.dy));
 				gradfield->dz.compress(database.count, reinterpret_cast< const unsigned char * > (database.dz));
 			}
 
-			if (colors != NULL)
+			if (colors != NULL && (nChannels & DataBase::DBC_Colours))
 			{
 				colors->r.compress(database.count, reinterpret_cast< unsigned char * > (database.red));
 				colors->g.compress(database.count, reinterpret_cast< unsigned char * > (database.green));
@@ -294,7 +475,7 @@ namespace Ogre
 				colors->a.compress(database.count, reinterpret_cast< unsigned char * > (database.alpha));
 			}
 
-			if (texcoords != NULL)
+			if (texcoords != NULL && (nChannels & DataBase::DBC_TexCoords))
 			{
 				texcoords->u.compress(database.count, reinterpret_cast< unsigned char * > (database.tx));
 				texcoords->v.compress(database.count, reinterpret_cast< unsigned char * > (database.ty));
@@ -303,16 +484,22 @@ namespace Ogre
 
 		void CompressedDataBase::operator>>( DataBase & database ) const
 		{
-			values.decompress(database.count, reinterpret_cast< unsigned char * > (database.values));
+			extract(database, DataBase::DBC_All);
+		}
 
-			if (gradfield != NULL)
+		void CompressedDataBase::extract( DataBase & database, const size_t nChannels ) const
+		{
+			if (nChannels & DataBase::DBC_Values)
+				values.decompress(database.count, reinterpret_cast< unsigned char * > (database.values));
+
+			if (gradfield != NULL && (nChannels & DataBase::DBC_Gradient))
 			{
 				gradfield->dx.decompress(database.count, reinterpret_cast< unsigned char * > (database.dx));
 				gradfield->dy.decompress(database.count, reinterpret_cast< unsigned char * > (database.dy));
 				gradfield->dz.decompress(database.count, reinterpret_cast< unsigned char * > (database.dz));
 			}
 
-			if (colors != NULL)
+			if (colors != NULL && (nChannels & DataBase::DBC_Colours))
 			{
 				colors->r.decompress(database.count, reinterpret_cast< unsigned char * > (database.red));
 				colors->g.decompress(database.count, reinterpret_cast< unsigned char * > (database.green));
@@ -320,13 +507,137 @@ namespace Ogre
 				colors->a.decompress(database.count, reinterpret_cast< unsigned char * > (database.alpha));
 			}
 
-			if (texcoords != NULL)
+			if (texcoords != NULL && (nChannels & DataBase::DBC_TexCoords))
 			{
 				texcoords->u.decompress(database.count, reinterpret_cast< unsigned char * > (database.tx));
 				texcoords->v.decompress(database.count, reinterpret_cast< unsigned char * > (database.ty));
 			}
 		}
 
+		unsigned long long CompressedDataBase::computeCRC() const
+		{
+			const RLE::Channel * channels[10];
+			size_t c = 0;
+
+			channels[c++] = &values;
+			if (gradfield != NULL)
+			{
+				channels[c++] = &gradfield->dx;
+				channels[c++] = &gradfield->dy;
+				channels[c++] = &gradfield->dz;
+			}
+			if (colors != NULL)
+			{
+				channels[c++] = &colors->r;
+				channels[c++] = &colors->g;
+				channels[c++] = &colors->b;
+				channels[c++] = &colors->a;
+			}
+			if (texcoords != NULL)
+			{
+				channels[c++] = &texcoords->u;
+				channels[c++] = &texcoords->v;
+			}
+
+			// Mix the channels so that permuted channel contents do not collide
+			unsigned long long v = 0;
+			for (size_t i = 0; i < c; ++i)
+				v = (v ^ channels[i]->computeCRC()) * 0x100000001B3ULL;
+
+			return v;
+		}
+
+		SignOccupancy::SignOccupancy( const CubeDataRegionDescriptor & dgtmpl )
+		:	_pDescriptor(&dgtmpl),
+			_nSpan(std::max(DimensionType(dgtmpl.dimensions / MacroCount), DimensionType(1))),
+			_nCount(dgtmpl.dimensions / _nSpan)
+		{
+			OgreAssert(_nCount <= MacroCount, "Region dimensions must be a power of two");
+			invalidate();
+		}
+
+		void SignOccupancy::invalidate()
+		{
+			memset(_vMacroCells, Occ_Mixed, sizeof(_vMacroCells));
+			_enTotal = Occ_Mixed;
+		}
+
+		void SignOccupancy::update( const FieldStrength * values )
+		{
+			const CubeDataRegionDescriptor & dgtmpl = *_pDescriptor;
+			unsigned char total = 0;
+
+			for (DimensionType mz = 0; mz < _nCount; ++mz)
+				for (DimensionType my = 0; my < _nCount; ++my)
+					for (DimensionType mx = 0; mx < _nCount; ++mx)
+					{
+						// Sign bits of the bitwise union and intersection reveal whether any voxel is negative and whether any is not
+						FieldStrength any = 0, all = ~0;
+
+						// Each macro cell includes the grid-points on its maximal boundaries so that all corners of its cells are accounted for
+						for (DimensionType z = mz * _nSpan, zN = z + _nSpan; z <= zN; ++z)
+							for (DimensionType y = my * _nSpan, yN = y + _nSpan; y <= yN; ++y)
+							{
+								const FieldStrength * pRow = values + dgtmpl.getGridPointIndex(mx * _nSpan, y, z);
+
+								for (DimensionType x = 0; x <= _nSpan; ++x)
+								{
+									any |= pRow[x];
+									all &= pRow[x];
+								}
+							}
+
+						const unsigned char occ = 
+							(any < 0 ? Occ_Negative : 0) | 
+							(all >= 0 ? Occ_Positive : 0);
+
+						_vMacroCells[mz][my][mx] = occ;
+						total |= occ;
+					}
+
+			_enTotal = Occupancy(total);
+		}
+
+		SignOccupancy::Occupancy SignOccupancy::query( const DimensionType x0, const DimensionType y0, const DimensionType z0, const DimensionType x1, const DimensionType y1, const DimensionType z1 ) const
+		{
+			if (_enTotal != Occ_Mixed)
+				return _enTotal;
+
+			unsigned char occ = 0;
+
+			for (DimensionType mz = firstMacroCell(z0), mzN = lastMacroCell(z0, z1); mz <= mzN; ++mz)
+				for (DimensionType my = firstMacroCell(y0), myN = lastMacroCell(y0, y1); my <= myN; ++my)
+					for (DimensionType mx = firstMacroCell(x0), mxN = lastMacroCell(x0, x1); mx <= mxN; ++mx)
+						occ |= _vMacroCells[mz][my][mx];
+
+			return Occupancy(occ);
+		}
+
+		SignOccupancy::Occupancy SignOccupancy::query( const Touch3DSide side ) const
+		{
+			const DimensionType nDim = _pDescriptor->dimensions;
+			DimensionType p0[3], pN[3];
+
+			// Touch3DSide packs a TouchStatus for each of x, y, and z into successive pairs of bits
+			for (unsigned a = 0; a < 3; ++a)
+			{
+				switch ((side >> (a << 1)) & 3)
+				{
+				case TS_Low:
+					p0[a] = pN[a] = 0;
+					break;
+				case TS_High:
+					p0[a] = pN[a] = nDim;
+					break;
+				default:
+					p0[a] = 0;
+					pN[a] = nDim;
+					break;
+				}
+			}
+
+			return query(p0[0], p0[1], p0[2], pN[0], pN[1], pN[2]);
+		}
 
 		const_CompressedDataAccessor::const_CompressedDataAccessor( boost::recursive_mutex & m, const CompressedDataBase * compression ) 
 		: template_CompressedDataAccessor(m, compression)
@@ -396,5 +707,38 @@ namespace Ogre
 
 			return ins;
 		}
+
+		ValuesCache::ValuesCache( const size_t nCapacity )
+			: _nCapacity(nCapacity)
+		{
+			OgreAssert(nCapacity > 0, "Values cache must retain at least one region");
+		}
+
+		const FieldStrength * ValuesCache::values( const CubeDataRegion * pRegion )
+		{
+			for (CopyList::iterator i = _copies.begin(); i != _copies.end(); ++i)
+				if (i->first == pRegion)
+				{
+					_copies.splice(_copies.begin(), _copies, i);
+					return &_copies.front().second[0];
+				}
+
+			// The storage of the least recently used copy is reused
+			if (_copies.size() >= _nCapacity)
+				_copies.splice(_copies.begin(), _copies, --_copies.end());
+			else
+				_copies.push_front(CopyList::value_type());
+
+			std::vector< FieldStrength > & vValues = _copies.front().second;
+
+			_copies.front().first = pRegion;
+			{
+				// The region is locked only while its values are copied
+				const const_ValuesAccessor data = pRegion->leaseValues();
+
+				vValues.assign(data.values, data.values + data.count);
+			}
+			return &vValues[0];
+		}
 	}
 }
@@ -48,7 +48,7 @@ namespace Ogre
 		{
 			OgreAssert(((dimensions - 1) & dimensions) == 0, "Dimensions must be a power of 2");
 			OgreAssert(((cellcount - 1) & cellcount) == 0, "Cell count must be a power of 2");
-			OgreAssert(dimensions <= 0x20, "Dimensions must be no greater than 32");
+			OgreAssert(dimensions <= Voxel::MAX_DIM, "Dimensions exceed the maximum supported by voxel indices and row buffers");
 			_vertexPositions = new IsoFixVec3[gpcount];
 
 			const IsoFixVec3 vfExtent = IsoFixVec3(signed short(1),signed short(1),signed short(1)) * signed short (dimensions) / signed short (2);
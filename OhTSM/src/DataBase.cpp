@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include "DataBase.h"
+#include "CubeDataRegion.h"
 
 #include "OverhangTerrainOptions.h"
 
@@ -33,9 +34,24 @@ namespace Ogre
 			blue( (nVRFlags & VRF_Colours) != 0 ? new unsigned char[nCount] : NULL ),
 			alpha( (nVRFlags & VRF_Colours) != 0 ? new unsigned char[nCount] : NULL ),
 			tx( (nVRFlags & VRF_TexCoords) != 0 ? new unsigned char[nCount] : NULL ),
-			ty( (nVRFlags & VRF_TexCoords) != 0 ? new unsigned char[nCount] : NULL )
+			ty( (nVRFlags & VRF_TexCoords) != 0 ? new unsigned char[nCount] : NULL ),
+			modified(0)
 		{}
 
+		size_t DataBase::size() const
+		{
+			size_t nPerVoxel = sizeof(FieldStrength);
+
+			if (dx != NULL)
+				nPerVoxel += sizeof(*dx) + sizeof(*dy) + sizeof(*dz);
+			if (red != NULL)
+				nPerVoxel += sizeof(*red) + sizeof(*green) + sizeof(*blue) + sizeof(*alpha);
+			if (tx != NULL)
+				nPerVoxel += sizeof(*tx) + sizeof(*ty);
+
+			return count * nPerVoxel;
+		}
+
 		DataBasePool::LeaseEx::LeaseEx( const char * szMsg )
 			: std::exception(szMsg)
 		{}
@@ -114,5 +130,83 @@ namespace Ogre
 
 		}
 
+
+		DataBaseCache::DataBaseCache( const size_t nCapacity )
+			: _nCapacity(nCapacity), _nBytes(0), _nHits(0), _nMisses(0), _nEvictions(0)
+		{
+			OgreAssert(nCapacity > 0, "Capacity must be positive");
+		}
+
+		void DataBaseCache::touch( const CubeDataRegion * pRegion, const size_t nBytes, const bool bHit )
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+
+			if (bHit)
+				++_nHits;
+			else
+				++_nMisses;
+
+			RegionMap::iterator i = _mapRegions.find(pRegion);
+			if (i != _mapRegions.end())
+			{
+				_nBytes -= i->second->second;
+				_lRegions.erase(i->second);
+			}
+
+			_lRegions.push_front(std::make_pair(pRegion, nBytes));
+			_mapRegions[pRegion] = _lRegions.begin();
+			_nBytes += nBytes;
+
+			// Walk from the least recently used region, passing over the most recent one which was just leased
+			RegionList::iterator j = _lRegions.end();
+			while (_nBytes > _nCapacity && --j != _lRegions.begin())
+			{
+				if (j->first->evict())
+				{
+					_nBytes -= j->second;
+					_mapRegions.erase(j->first);
+					j = _lRegions.erase(j);
+					++_nEvictions;
+				}
+			}
+		}
+
+		void DataBaseCache::remove( const CubeDataRegion * pRegion )
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+
+			RegionMap::iterator i = _mapRegions.find(pRegion);
+			if (i != _mapRegions.end())
+			{
+				_nBytes -= i->second->second;
+				_lRegions.erase(i->second);
+				_mapRegions.erase(i);
+			}
+		}
+
+		void DataBaseCache::getStatistics( size_t & nHits, size_t & nMisses, size_t & nEvictions, size_t & nResidents, size_t & nBytes ) const
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+
+			nHits = _nHits;
+			nMisses = _nMisses;
+			nEvictions = _nEvictions;
+			nResidents = _lRegions.size();
+			nBytes = _nBytes;
+		}
+
+		Real DataBaseCache::getHitRatio() const
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+
+			return _nHits + _nMisses > 0 ? Real(_nHits) / Real(_nHits + _nMisses) : 0;
+		}
+
+		void DataBaseCache::resetStatistics()
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+
+			_nHits = _nMisses = _nEvictions = 0;
+		}
 	}
 }
\ No newline at end of file
@@ -43,11 +43,12 @@ namespace Ogre
 		bool bIndices, 
 		const size_t nLODLevels, 
 		const Real fPixelError, 
+		const HardwareIndexBuffer::IndexType enIndexType,
 		const Ogre::String & sName /*= ""*/
 	)
 	:	LODRenderable(nLODLevels, fPixelError, false, 0, sName),
 		_pVtxDecl(pVtxDecl), _pVtxBB(HardwareBufferManager::getSingletonPtr() ->createVertexBufferBinding()),
-		_pMesh(new Mesh(nLODLevels, pVtxDecl)),
+		_pMesh(new Mesh(nLODLevels, pVtxDecl, enIndexType)),
 		_txWorld(Matrix4::IDENTITY)
 	{
 		oht_assert_threadmodel(ThrMdl_Single);
@@ -81,6 +82,16 @@ namespace Ogre
 		return true;
 	}
 
+	bool DynamicRenderable::reserveIndexBuffer( const size_t indexCount )
+	{
+		oht_assert_threadmodel(ThrMdl_Single);
+
+		if (_renderOp.useIndexes)
+			return _pMesh->indices.reserve(indexCount);
+
+		return true;
+	}
+
 	bool DynamicRenderable::prepareVertexBuffer( const size_t nVtxCount, bool bClearIndicesToo )
 	{
 		oht_assert_threadmodel(ThrMdl_Single);
@@ -98,7 +109,8 @@ namespace Ogre
 	void /*SimpleRenderable::*/ DynamicRenderable::getWorldTransforms( Matrix4* xform ) const
 	{
 		oht_assert_threadmodel(ThrMdl_Single);
-		*xform = _txWorld * mParentNode->_getFullTransform();
+		// The renderable's own transform applies to vertices first
+		*xform = mParentNode->_getFullTransform() * _txWorld;
 	}
 
 	void /*SimpleRenderable::*/ DynamicRenderable::setWorldTransform( const Matrix4& xform )
@@ -311,6 +323,15 @@ namespace Ogre
 		}
 	}
 
+	bool DynamicRenderable::SurfaceIndexData::reserve( const size_t nIndexCount )
+	{
+		const bool bResult = prepare(nIndexCount);
+
+		// Room was made, the slots/slices are claimed by subsequent calls to prepare
+		_count -= nIndexCount;
+		return bResult;
+	}
+
 	void DynamicRenderable::SurfaceIndexData::reset()
 	{
 		for (unsigned i = 0; i < _nResCount; ++i)
@@ -333,9 +354,9 @@ namespace Ogre
 		_capacity = 0;
 	}
 
-	DynamicRenderable::SurfaceIndexData::SurfaceIndexData( const unsigned nResolutionCount, VertexDeclaration * pVtxDecl ) 
+	DynamicRenderable::SurfaceIndexData::SurfaceIndexData( const unsigned nResolutionCount, VertexDeclaration * pVtxDecl, const HardwareIndexBuffer::IndexType enIndexType ) 
 		: _nResCount(nResolutionCount), _pvResolutions(new Resolution * [nResolutionCount]), 
-		  _capacity(0), _count(0), _bReferenced(false)
+		  _capacity(0), _count(0), _enIndexType(enIndexType), _bReferenced(false)
 	{
 		for (unsigned c = 0; c < nResolutionCount; ++c)
 			_pvResolutions[c] = new Resolution(pVtxDecl);
@@ -347,6 +368,7 @@ namespace Ogre
 		_capacity(copy._capacity),
 		_count(copy._count),
 		_nResCount(copy._nResCount),
+		_enIndexType(copy._enIndexType),
 		_bReferenced(true)
 	{
 		for (unsigned i = 0; i < _nResCount; ++i)
@@ -359,6 +381,7 @@ namespace Ogre
 		_capacity(move._capacity),
 		_count(move._count),
 		_nResCount(move._nResCount),
+		_enIndexType(move._enIndexType),
 		_bReferenced(move._bReferenced)
 	{
 		move._pvResolutions = NULL;
@@ -397,7 +420,7 @@ namespace Ogre
 	{
 		_buffer =
 			HardwareBufferManager::getSingleton().createIndexBuffer(
-				HardwareIndexBuffer::IT_16BIT,
+				_enIndexType,
 				_capacity,
 				HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY,
 				DYNAMIC_RENDERABLE_SHADOW_BUFFERED
@@ -417,8 +440,8 @@ namespace Ogre
 	}
 
 
-	DynamicRenderable::Mesh::Mesh( const unsigned nResolutionCount, VertexDeclaration * pVtxDecl ) 
-		: vertices(pVtxDecl), indices(nResolutionCount, pVtxDecl)
+	DynamicRenderable::Mesh::Mesh( const unsigned nResolutionCount, VertexDeclaration * pVtxDecl, const HardwareIndexBuffer::IndexType enIndexType ) 
+		: vertices(pVtxDecl), indices(nResolutionCount, pVtxDecl, enIndexType)
 	{}
 
 	void DynamicRenderable::Mesh::clear()
@@ -54,26 +54,57 @@ namespace Ogre
 				delete stitches[s];
 		}
 
-		void MeshOperation::restoreHWIndices( HWVertexIndex * mapIVI2HWVI )
+		void MeshOperation::restoreHWIndices( HWVertexIndexMap & mapIVI2HWVI )
 		{
 			size_t nHardwareIndex = 0;
 			for (IsoVertexVector::const_iterator i = vertices->revmapIVI2HWVI.begin(); i != vertices->revmapIVI2HWVI.end(); ++i)
-				mapIVI2HWVI[*i] = nHardwareIndex++;
+			{
+				// Hardware vertices that became stale are no longer occupied by an isovertex
+				if (*i != IsoVertexIndex(~0))
+					mapIVI2HWVI.set(*i, nHardwareIndex);
+
+				++nHardwareIndex;
+			}
+		}
+
+		void Vertices::update( const IsoVertexRemapVector & remaps, const IsoVertexVector::const_iterator beginRevMapIVI2HWVI, const IsoVertexVector::const_iterator endRevMapIVI2HWVI )
+		{
+			// addHWIndices, first since siblings of a batch may patch vertices appended by the configurations before them
+			revmapIVI2HWVI.insert(revmapIVI2HWVI.end(), beginRevMapIVI2HWVI, endRevMapIVI2HWVI);
+
+			// Patched and stale hardware vertices
+			for (IsoVertexRemapVector::const_iterator i = remaps.begin(); i != remaps.end(); ++i)
+			{
+				OgreAssert(i->index < revmapIVI2HWVI.size(), "Hardware vertex remapping is out of range");
+				revmapIVI2HWVI[i->index] = i->ivi;
+			}
+
+			// Stale hardware vertices have been evicted
+			dirty.setNull();
 		}
 
 		void HardwareIsoVertexShadow::StateAccess::updateHardwareState( const IsoVertexVector::const_iterator beginRevMapIVI2HWVI, const IsoVertexVector::const_iterator endRevMapIVI2HWVI )
 		{
-			for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			auto batched = [] (LOD * pResolution, const Touch3DFlags enStitches)
 			{
-				const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+				for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+				{
+					const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
 
-				if (stitches & side)
-					this->meshOp.resolution->stitches[s] ->gpued = true;
-			}
-			this->meshOp.resolution->gpued = true;
+					if (enStitches & side)
+						pResolution->stitches[s] ->gpued = true;
+				}
+				pResolution->gpued = true;
+
+				// The resolution has been patched
+				pResolution->dirty.setNull();
+			};
+
+			batched(this->meshOp.resolution, stitches);
+			for (BuilderQueue::SiblingList::const_iterator i = _pBuilderQueue->siblings.begin(); i != _pBuilderQueue->siblings.end(); ++i)
+				batched(i->resolution, i->stitches);
 
-			// addHWIndices
-			this->meshOp.vertices->revmapIVI2HWVI.insert(this->meshOp.vertices->revmapIVI2HWVI.end(), beginRevMapIVI2HWVI, endRevMapIVI2HWVI);
+			this->meshOp.vertices->update(remapHWVI2IVIQueue, beginRevMapIVI2HWVI, endRevMapIVI2HWVI);
 		}
 
 		HardwareIsoVertexShadow::HardwareIsoVertexShadow( const unsigned nLODCount ) 
@@ -115,6 +146,18 @@ namespace Ogre
 			}
 		}
 
+		void HardwareIsoVertexShadow::invalidateRegion( const CellRegion & region )
+		{
+			{ OGRE_LOCK_RW_MUTEX_WRITE(_mutex);
+				delete _pBuilderQueue;
+				_pBuilderQueue = NULL;
+
+				for (unsigned i = 0; i < _nCountResolutions; ++i)
+					_vpResolutions[i]->dirty.merge(region);
+				_pVertices->dirty.merge(region);
+			}
+		}
+
 		HardwareIsoVertexShadow::ConsumerLock HardwareIsoVertexShadow::requestConsumerLock(const unsigned char nLOD, const Touch3DFlags enStitches)
 		{
 			return ConsumerLock (
@@ -149,7 +192,8 @@ namespace Ogre
 				pVtxFlag->queryInterface< RoleSecureFlag::ISetFlag > (),
 				pVtxFlag,
 				pIdxFlag->queryInterface< RoleSecureFlag::ISetFlag > (),
-				pIdxFlag
+				pIdxFlag,
+				&_staging
 			);
 		}
 
@@ -178,6 +222,7 @@ namespace Ogre
 		void HardwareIsoVertexShadow::clearVertices( const BufferDepth depth)
 		{
 			_pVertices->revmapIVI2HWVI.clear();
+			_pVertices->dirty.setNull();
 		}
 
 		void HardwareIsoVertexShadow::clearIndices( const BufferDepth depth)
@@ -195,6 +240,7 @@ namespace Ogre
 					pResolution->borderIsoVertexProperties.clear();
 					pResolution->middleIsoVertexProperties.clear();
 					pResolution->shadowed = false;
+					pResolution->dirty.setNull();
 					for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
 					{
 						pResolution->stitches[s] ->shadowed = false;
@@ -288,9 +334,10 @@ namespace Ogre
 			RoleSecureFlag::ISetFlag *						pSetResetVertexBufferFlag, 
 			RoleSecureFlag::Flag *							pResetVertexBufferFlag,
 			RoleSecureFlag::ISetFlag *						pSetResetIndexBufferFlag, 
-			RoleSecureFlag::Flag *							pResetIndexBufferFlag
+			RoleSecureFlag::Flag *							pResetIndexBufferFlag,
+			StagingArena *									pStaging
 		)
-		:	ConcurrentProducerConsumerQueueBase(reallocate(pBuilderQueue, pResolution, pVertices, pIndices, pBuffMan, enStitches, pResetVertexBufferFlag, pResetIndexBufferFlag)), 
+		:	ConcurrentProducerConsumerQueueBase(reallocate(pBuilderQueue, pResolution, pVertices, pIndices, pBuffMan, enStitches, pResetVertexBufferFlag, pResetIndexBufferFlag, pStaging)), 
 			resetVertexBuffer(*pSetResetVertexBufferFlag),
 			resetIndexBuffer(*pSetResetIndexBufferFlag),
 			_lock(static_cast< boost::unique_lock<boost::shared_mutex> && > (lock))
@@ -311,50 +358,119 @@ namespace Ogre
 			IBufferManager *					pBuffMan, 
 			const Touch3DFlags					enStitches, 
 			RoleSecureFlag::Flag *				pResetVertexBufferFlag, 
-			RoleSecureFlag::Flag *				pResetIndexBufferFlag 
+			RoleSecureFlag::Flag *				pResetIndexBufferFlag,
+			StagingArena *						pStaging
 		)
 		{
 			delete pBuilderQueue;
-			return pBuilderQueue = new BuilderQueue(pResolution, pVertices, pIndices, pBuffMan, enStitches, pResetVertexBufferFlag, pResetIndexBufferFlag);
+			// The pending batch, if any, is discarded along with its staged data
+			pStaging->clear();
+			return pBuilderQueue = new BuilderQueue(pResolution, pVertices, pIndices, pBuffMan, enStitches, pResetVertexBufferFlag, pResetIndexBufferFlag, pStaging);
+		}
+
+		StagingArena::StagingArena()
+			: vertexSize(0), indexSize(0)
+		{}
+
+		void StagingArena::clear()
+		{
+			vertices.clear();
+			patches.clear();
+			indices.clear();
+		}
+
+		unsigned char * StagingArena::Buffer::append( const size_t nBytes )
+		{
+			const size_t nOffset = _nSize;
+
+			_nSize += nBytes;
+			// Grow geometrically, the storage is never shrunk
+			if (_nSize > _vBytes.size())
+				_vBytes.resize(std::max(_nSize, _vBytes.size() * 2));
+
+			return &_vBytes[nOffset];
+		}
+
+		void BuilderQueue::CompactVertexElement::setPosition( const Vector3 & vPos )
+		{
+			for (unsigned c = 0; c < 3; ++c)
+				position[c] = int16(Math::Floor(std::min(std::max(vPos[c], Real(-0.5)), Real(+0.5)) * Real(2 * PositionRange) + Real(0.5)));
+			position[3] = 1;
+		}
+
+		void BuilderQueue::CompactVertexElement::setPosition( const IsoFixVec3 & pt, const DimensionType nDimensions )
+		{
+			setPosition(Vector3(Real(pt.x), Real(pt.y), Real(pt.z)) / Real(nDimensions));
 		}
 
-		BuilderQueue::VertexElement::VertexElement( 
-			const Vector3 & vPos, 
-			const Vector3 & vNorm, 
-			const ColourValue & cColour, 
-			const Vector2 & vTexCoord 
-		) : position(vPos), normal(vNorm), texcoord(vTexCoord)
+		Vector3 BuilderQueue::CompactVertexElement::getPosition() const
 		{
-			setColour(cColour);
+			return Vector3(Real(position[0]), Real(position[1]), Real(position[2])) / Real(2 * PositionRange);
+		}
+
+		Real BuilderQueue::CompactVertexElement::getPositionScale( const DimensionType nDimensions, const Real fGridScale )
+		{
+			return Real(nDimensions) * fGridScale / Real(2 * PositionRange);
+		}
+
+		void BuilderQueue::CompactVertexElement::setNormal( const Vector3 & vNorm )
+		{
+			// Project onto the octahedron and fold the lower hemisphere over the upper one
+			const Real fL1 = Math::Abs(vNorm.x) + Math::Abs(vNorm.y) + Math::Abs(vNorm.z);
+			Real
+				u = fL1 > 0 ? vNorm.x / fL1 : 0,
+				v = fL1 > 0 ? vNorm.y / fL1 : 0;
+
+			if (vNorm.z < 0)
+			{
+				const Real u0 = u;
+				u = (1 - Math::Abs(v)) * (u0 < 0 ? -1 : +1);
+				v = (1 - Math::Abs(u0)) * (v < 0 ? -1 : +1);
+			}
+
+			normal[0] = int16(Math::Floor(std::min(std::max(u, Real(-1)), Real(1)) * Real(32767) + Real(0.5)));
+			normal[1] = int16(Math::Floor(std::min(std::max(v, Real(-1)), Real(1)) * Real(32767) + Real(0.5)));
 		}
 
-		void BuilderQueue::VertexElement::setColour( const ColourValue & cColour )
+		void BuilderQueue::CompactVertexElement::setColour( const ColourValue & cColour )
 		{
 			Root::getSingleton().convertColourValue(cColour, &colour);
 		}
 
+		void BuilderQueue::CompactVertexElement::setTexCoord( const Real u, const Real v )
+		{
+			const Real fUnit = Real(1 << TexCoordFracBits);
+
+			texcoord[0] = int16(std::min(std::max(Math::Floor(u * fUnit + Real(0.5)), Real(-32768)), Real(32767)));
+			texcoord[1] = int16(std::min(std::max(Math::Floor(v * fUnit + Real(0.5)), Real(-32768)), Real(32767)));
+		}
+
 		HardwareIsoVertexShadow::StateAccess::StateAccess( BuilderQueue *& pBuilderQueue ) 
 		:	_pBuilderQueue(pBuilderQueue), 
 			meshOp(pBuilderQueue->meshOp),
 			stitches(pBuilderQueue->stitches), 
-			revmapIVI2HWVIQueue(pBuilderQueue->revmapIVI2HWVIQueue)
+			revmapIVI2HWVIQueue(pBuilderQueue->revmapIVI2HWVIQueue),
+			remapHWVI2IVIQueue(pBuilderQueue->remapHWVI2IVIQueue)
 		{}
 
 		HardwareIsoVertexShadow::StateAccess::StateAccess( StateAccess && move ) 
 		:	_pBuilderQueue(move._pBuilderQueue),
 			meshOp(move.meshOp),
 			stitches(move.stitches), 
-			revmapIVI2HWVIQueue(move.revmapIVI2HWVIQueue)
+			revmapIVI2HWVIQueue(move.revmapIVI2HWVIQueue),
+			remapHWVI2IVIQueue(move.remapHWVI2IVIQueue)
 		{}
 
 		HardwareIsoVertexShadow::ConcurrentProducerConsumerQueueBase::ConcurrentProducerConsumerQueueBase( BuilderQueue *& pBuilderQueue ) 
 		:	StateAccess(pBuilderQueue),
-			vertexQueue(pBuilderQueue->vertexQueue), indexQueue(pBuilderQueue->indexQueue)
+			staging(*pBuilderQueue->staging), indexRange(pBuilderQueue->indexRange),
+			siblings(pBuilderQueue->siblings)
 		{}
 
 		HardwareIsoVertexShadow::ConcurrentProducerConsumerQueueBase::ConcurrentProducerConsumerQueueBase( ConcurrentProducerConsumerQueueBase && move ) 
 		:	StateAccess(move),
-			vertexQueue(move.vertexQueue), indexQueue(move.indexQueue)
+			staging(move.staging), indexRange(move.indexRange),
+			siblings(move.siblings)
 		{}
 
 		HardwareIsoVertexShadow::ConsumerLock::ConsumerLock
@@ -389,6 +505,9 @@ namespace Ogre
 		MeshOperation::MeshOperation( LOD * pResolution, Vertices * pVertices, Indices * pIndices, IBufferManager * pBuffMan ) 
 			: resolution(pResolution), vertices(pVertices), indices(pIndices), _pBuffMan(pBuffMan) {}
 
+		MeshOperation::MeshOperation( const MeshOperation & other, LOD * pResolution, Vertices * pVertices ) 
+			: resolution(pResolution), vertices(pVertices), indices(other.indices), _pBuffMan(other._pBuffMan) {}
+
 		BuilderQueue::BuilderQueue( 
 			LOD * pResolution, 
 			Vertices * pVertexStuff, 
@@ -396,9 +515,10 @@ namespace Ogre
 			IBufferManager * pBuffMan, 
 			const Touch3DFlags enStitches, 
 			RoleSecureFlag::Flag * pResetVertexHWBuffer,
-			RoleSecureFlag::Flag * pResetIndexHWBuffer
+			RoleSecureFlag::Flag * pResetIndexHWBuffer,
+			StagingArena * pStaging /*= NULL*/
 		)
-			: meshOp(pResolution, pVertexStuff, pIndexStuff, pBuffMan), stitches(enStitches), pResetVertexHWBuffer(pResetVertexHWBuffer), pResetIndexHWBuffer(pResetIndexHWBuffer)
+			: meshOp(pResolution, pVertexStuff, pIndexStuff, pBuffMan), stitches(enStitches), pResetVertexHWBuffer(pResetVertexHWBuffer), pResetIndexHWBuffer(pResetIndexHWBuffer), staging(pStaging)
 		{
 
 		}
@@ -409,6 +529,25 @@ namespace Ogre
 			delete pResetIndexHWBuffer;
 		}
 
+		bool BuilderQueue::includes( const MeshOperation & other, const Touch3DFlags enStitches ) const
+		{
+			if (meshOp == other && stitches == enStitches)
+				return true;
+
+			if (meshOp.vertices == other.vertices)
+			{
+				for (SiblingList::const_iterator i = siblings.begin(); i != siblings.end(); ++i)
+					if (i->resolution == other.resolution && i->stitches == enStitches)
+						return true;
+			}
+
+			return false;
+		}
+
+		BuilderQueue::Sibling::Sibling( LOD * pResolution, const Touch3DFlags enStitches ) 
+			: resolution(pResolution), stitches(enStitches)
+		{}
+
 
 		HardwareIsoVertexShadow::DirectAccess::DirectAccess( 
 			BuilderQueue *& pBuilderQueue, 
@@ -32,6 +32,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include <strstream>
 #include <stack>
 #include <hash_set>
+#include <limits>
 
 #include "IsoSurfaceBuilder.h"
 #include "IsoSurfaceRenderable.h"
@@ -39,6 +40,12 @@ http://www.gnu.org/copyleft/lesser.txt.
 
 #include "DebugTools.h"
 
+#if defined(OHT_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(OHT_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace Ogre
 {
 	using namespace Voxel;
@@ -198,15 +205,51 @@ namespace Ogre
 
 	IsoSurfaceBuilder::IsoSurfaceBuilder(
 		const CubeDataRegionDescriptor & cubemeta,
-		const Channel::Index< ChannelParameters > & chanparams
+		const Channel::Index< ChannelParameters > & chanparams,
+		const size_t nSlabs /*= 1*/,
+		BuildCache * pBuildCache /*= NULL*/,
+		SlabWorkers * pSlabWorkers /*= NULL*/
 	)
 	: 	_cubemeta(cubemeta),
 		_chanparams(chanparams),
-		_pCurrentChannelParams(NULL)
+		_pCurrentChannelParams(NULL),
+		_occupancy(cubemeta),
+		_rowccc(cubemeta),
+		_bShareCaseCodes(false),
+		_bCaseCodes0(false),
+		_nSlabs(1),
+		_pSlabWorkers(pSlabWorkers),
+		_nCacheTriangles(0),
+		_nCacheMissesBefore(0),
+		_nCacheMissesAfter(0),
+		_nets(cubemeta),
+		_nDecimationTrianglesBefore(0),
+		_nDecimationTrianglesAfter(0),
+		_nDecimationCollapses(0),
+		_fDecimationMaxError(0),
+		_fDecimationTotalError(0),
+		_pBuildCache(pBuildCache)
 	{
 		oht_assert_threadmodel(ThrMdl_Main);
 
-		_pMainVtxElems = new MainVertexElements(cubemeta);
+		// Iso-vertices are mapped to hardware vertices as wide as the widest indices of any channel
+		bool bWideIndices = false, bSurfaceNets = false;
+		for (Channel::Index< ChannelParameters >::const_iterator i = chanparams.begin(); i != chanparams.end(); ++i)
+		{
+			bWideIndices = bWideIndices || i->value->wideIndices;
+			// Cell vertices of Surface Nets are only allocated if some channel uses them
+			bSurfaceNets = bSurfaceNets || i->value->surfaceNetsLODEnd > i->value->surfaceNetsLODBegin;
+		}
+
+		_pMainVtxElems = new MainVertexElements(cubemeta, bWideIndices, bSurfaceNets);
+
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			_bHalo[s] = false;
+
+		// There cannot be more slabs than layers of cells at full resolution
+		if (nSlabs > 1)
+			for (size_t c = std::min(nSlabs, size_t(cubemeta.dimensions)); c > 0; --c)
+				_vpSlabs.push_back(new Slab(cubemeta));
 	}
 
 	IsoSurfaceBuilder::ChannelParameters::TransitionCellTranslators * IsoSurfaceBuilder::ChannelParameters::createTransitionCellTranslators( const unsigned short nLODCount, const Real fTCWidthRatio )
@@ -237,14 +280,26 @@ namespace Ogre
 		const unsigned short nLODCount,
 		const Real fMaxPixelError,
 		const bool bFlipNormals,
-		const NormalsType enNormalType
+		const NormalsType enNormalType,
+		const bool bOptimizeVertexCache,
+		const unsigned short nSurfaceNetsLODBegin,
+		const unsigned short nSurfaceNetsLODEnd,
+		const unsigned short nDecimationLOD,
+		const Real fDecimationMaxError,
+		const bool bWideIndices
 	)
 		:	_txTCHalf2Full(createTransitionCellTranslators(nLODCount, fTCWidthRatio)),
 			surfaceFlags(nSurfaceFlags),
 			clod(nLODCount),
 			maxPixelError(fMaxPixelError),
 			flipNormals(bFlipNormals),
-			normalsType(enNormalType)
+			normalsType(enNormalType),
+			optimizeVertexCache(bOptimizeVertexCache),
+			surfaceNetsLODBegin(nSurfaceNetsLODBegin),
+			surfaceNetsLODEnd(nSurfaceNetsLODEnd),
+			decimationLOD(nDecimationLOD),
+			decimationMaxError(fDecimationMaxError),
+			wideIndices(bWideIndices)
 	{
 		OgreAssert(fTCWidthRatio <= 1.0f && fTCWidthRatio >= 0.0f, "Width ratio was out of bounds");
 	}
@@ -261,6 +316,9 @@ namespace Ogre
 
 			delete _pMainVtxElems;
 
+			for (std::vector< Slab * >::iterator i = _vpSlabs.begin(); i != _vpSlabs.end(); ++i)
+				delete *i;
+
 		}
 	}
 
@@ -269,15 +327,38 @@ namespace Ogre
 		return
 			(chanopts.normals != NT_None ? IsoVertexElements::GEN_NORMALS : 0) |
 			(chanopts.voxelRegionFlags & VRF_Colours ? IsoVertexElements::GEN_VERTEX_COLOURS : 0) |
-			(chanopts.voxelRegionFlags & VRF_TexCoords ? IsoVertexElements::GEN_TEX_COORDS : 0);
+			(chanopts.voxelRegionFlags & VRF_TexCoords ? IsoVertexElements::GEN_TEX_COORDS : 0) |
+			(chanopts.compactVertices ? IsoVertexElements::GEN_COMPACT : 0);
+	}
+
+	size_t IsoSurfaceBuilder::getLeaseChannels( const Channel::Ident channel, const size_t nSurfaceFlags ) const
+	{
+		return
+			DataBase::DBC_Values |
+			(nSurfaceFlags & IsoVertexElements::GEN_NORMALS && _chanparams[channel].normalsType == NT_Gradient ? DataBase::DBC_Gradient : 0) |
+			(nSurfaceFlags & IsoVertexElements::GEN_VERTEX_COLOURS ? DataBase::DBC_Colours : 0);
 	}
 
 	void IsoSurfaceBuilder::queueBuild( const MetaFragment::Container * pMF, SharedPtr< HardwareShadow::HardwareIsoVertexShadow > pShadow, const Channel::Ident channel, const unsigned lod, const size_t nSurfaceFlags, const Touch3DFlags enStitches, const size_t nVertexBufferCapacity )
 	{
+		queueBuild(pMF, pShadow, channel, ConfigurationList(1, Configuration(lod, enStitches)), nSurfaceFlags, nVertexBufferCapacity);
+	}
+
+	void IsoSurfaceBuilder::queueBuild( const MetaFragment::Container * pMF, SharedPtr< HardwareShadow::HardwareIsoVertexShadow > pShadow, const Channel::Ident channel, const ConfigurationList & configs, const size_t nSurfaceFlags, const size_t nVertexBufferCapacity )
+	{
+		OgreAssert(!configs.empty(), "Expected at least one configuration to build");
+
 		{ OGRE_LOCK_MUTEX(mMutex);
 			oht_assert_threadmodel(ThrMdl_Background);
 
-			HardwareIsoVertexShadow::ProducerQueueAccess queue = pShadow->requestProducerQueue(lod, enStitches);
+			// Sampled before the shadow is locked, neighbouring regions are only locked one at a time while their voxels are copied
+			const unsigned long long nHaloHash = sampleHalo(pMF, channel, nSurfaceFlags);
+
+			HardwareIsoVertexShadow::ProducerQueueAccess queue = pShadow->requestProducerQueue(configs.front().lod, configs.front().stitches);
+
+			// Vertices and indices are staged in the final layout of the hardware buffers of the channel
+			queue.staging.vertexSize = pMF->factory->getVertexSize();
+			queue.staging.indexSize = pMF->factory->getIndexType() == HardwareIndexBuffer::IT_32BIT ? sizeof(uint32) : sizeof(uint16);
 				
 			auto fragment = pMF->acquire< MetaFragment::Interfaces::const_Basic >();
 
@@ -285,21 +366,365 @@ namespace Ogre
 			DebugInfo debugs = DebugInfo(fragment.surface);
 	#endif
 
-			buildImpl(
+			// Each configuration of a batch is cached on its own, regions with voxels of only one sign have no surface worth caching
+			const bool bCacheable = 
+				_pBuildCache != NULL && 
+				!fragment.block->getOccupancy().homogeneous();
+			std::vector< BuildCache::Key > keys;
+			std::vector< BuildCache::EntryPtr > entries (configs.size());
+			bool bAllCached = false;
+
+			if (bCacheable)
+			{
+				BuildCache::Key key;
+
+				key.content = fragment.block->getContentHash();
+				key.channel = channel;
+				key.halo = nHaloHash;
+				key.surfaceFlags = nSurfaceFlags;
+				key.vertexSize = queue.staging.vertexSize;
+				key.indexSize = queue.staging.indexSize;
+				key.scale = fragment.block->getGridScale();
+
+				// Cached configurations cannot evict stale hardware vertices, only an extraction can
+				bAllCached = queue.meshOp.vertices->dirty.isNull();
+				for (ConfigurationList::const_iterator i = configs.begin(); i != configs.end(); ++i)
+				{
+					key.lod = i->lod;
+					key.stitches = i->stitches;
+					keys.push_back(key);
+
+					entries[i - configs.begin()] = _pBuildCache->find(key);
+					bAllCached = bAllCached && !entries[i - configs.begin()].isNull();
+				}
+			}
+
+			// Configurations after the first one build upon the vertices of those before them that have not been batched to the GPU yet
+			Vertices vertices = *queue.meshOp.vertices;
+			// The hardware vertex of the first vertex staged by the batch
+			size_t nBatchBase = vertices.revmapIVI2HWVI.size();
+			// Rather than grow past the range of 16-bit indices the vertex buffer starts over
+			const bool b16Bit = queue.staging.indexSize == sizeof(uint16);
+			const size_t nCapacity = b16Bit ? std::min(nVertexBufferCapacity, MaxHWVertices16) : nVertexBufferCapacity;
+
+			auto batch = [&] (const_DataAccessor * pData)
+			{
+				// Cells are classified once at LOD 0 by the first configuration that needs them, coarser cells derive their case codes from those
+				_bShareCaseCodes = pData != NULL && configs.size() > 1;
+				_bCaseCodes0 = false;
+
+				for (ConfigurationList::const_iterator i = configs.begin(); i != configs.end(); ++i)
+				{
+					const bool bPrimary = i == configs.begin();
+					const BuildCache::EntryPtr & pEntry = entries[i - configs.begin()];
+					MeshOperation meshOp (queue.meshOp, pShadow->getDirectAccess(i->lod), &vertices);
+
+					if (!pEntry.isNull() && vertices.dirty.isNull())
+					{
+						StageTimer timer (_timer, _extractstats.stages[Stage_QueueFill]);
+
+						// Either the sibling does not fit or the primary started the hardware buffers over, there are no prior vertices for siblings to build upon
+						if (!replayBuild(queue, vertices, meshOp.resolution, i->stitches, *pEntry, bPrimary, nCapacity) || _bResetVertexBuffer)
+							break;
+
+						continue;
+					}
+
+					buildImpl(
 	#if defined(_DEBUG) || defined(_OHT_LOG_TRACE)
-				debugs,
+						debugs,
 	#endif // _DEBUG
-				channel,
-				&queue.meshOp, fragment.block, pShadow, nSurfaceFlags, enStitches, nVertexBufferCapacity
-			);
-			fillShadowQueues(queue, fragment.block->getGridScale());
+						channel,
+						&meshOp, fragment.block, pShadow, nSurfaceFlags, i->stitches, nCapacity, pData
+					);
+
+					// Not even a vertex buffer started over holds the surface
+					if (b16Bit && _pMainVtxElems->vertexShipment.size() > MaxHWVertices16)
+						OGRE_EXCEPT(Exception::ERR_INVALIDPARAMS, "Too many vertices for 16-bit indices, use 32-bit indices for this channel", __FUNCTION__);
+
+					if (!bPrimary)
+					{
+						// The configuration does not fit the vertex buffer along with the rest of the batch
+						if (_bResetVertexBuffer)
+							break;
+
+						// All configurations of the batch are appended to the index buffer after the primary one
+						_bResetIndexBuffer = false;
+						queue.siblings.push_back(BuilderQueue::Sibling(meshOp.resolution, i->stitches));
+					} else if (_bResetVertexBuffer)
+						nBatchBase = 0;
+
+					BuilderQueue::IndexRange & indices = bPrimary ? queue.indexRange : queue.siblings.back().indices;
+
+					{ StageTimer timer (_timer, _extractstats.stages[Stage_QueueFill]);
+						vertices.update(_pMainVtxElems->vertexRemaps, _pMainVtxElems->vertexShipment.begin(), _pMainVtxElems->vertexShipment.end());
+						fillShadowQueues(queue, indices, pMF->factory, fragment.block->getGridScale());
+					}
+
+					// Patched hardware vertices are staged apart from the new ones, the new ones would no longer follow the hardware vertex order
+					if (bCacheable && queue.remapHWVI2IVIQueue.empty())
+						retainBuild(keys[i - configs.begin()], queue, meshOp.resolution, indices, nBatchBase);
+
+					// A batch that resets the vertex buffer starts over, there are no prior vertices for siblings to build upon
+					if (_bResetVertexBuffer)
+						break;
+				}
+
+				_bShareCaseCodes = _bCaseCodes0 = false;
+			};
+
+			// All configurations are extracted from the same lease, the voxels are decompressed only once for the whole batch and not at all if every configuration is cached
+			if (fragment.block->getOccupancy().homogeneous() || bAllCached)
+				batch(NULL);
+			else
+			{
+				const_DataAccessor data = fragment.block->lease(getLeaseChannels(channel, nSurfaceFlags));
+				batch(&data);
+			}
+		}
+	}
+
+	bool IsoSurfaceBuilder::replayBuild( 
+		HardwareIsoVertexShadow::ProducerQueueAccess & queue, 
+		Vertices & vertices, 
+		LOD * pResolution, 
+		const Touch3DFlags enStitches, 
+		const BuildCache::Entry & entry, 
+		const bool bPrimary, 
+		const size_t nVertexBufferCapacity 
+	)
+	{
+		oht_assert_threadmodel(ThrMdl_Background);
+
+		StagingArena & staging = queue.staging;
+		const bool b32Bit = staging.indexSize == sizeof(uint32);
+		MeshOperation meshOp (queue.meshOp, pResolution, &vertices);
+		size_t nAppended = 0;
+
+		// Iso-vertices already in the hardware vertex buffer are referenced rather than appended again
+		_pMainVtxElems->indices.clear();
+		meshOp.restoreHWIndices(_pMainVtxElems->indices);
+		for (IsoVertexVector::const_iterator i = entry.shipment.begin(); i != entry.shipment.end(); ++i)
+			if (_pMainVtxElems->indices[*i] == HWVertexIndex(~0))
+				++nAppended;
+
+		const bool bFits = meshOp.nextVertexIndex() + nAppended <= nVertexBufferCapacity;
+
+		if (!bFits && !bPrimary)
+			return false;
+
+		// Starting over, every vertex of the entry is appended to an empty hardware vertex buffer
+		_bResetVertexBuffer = !bFits;
+		if (_bResetVertexBuffer)
+		{
+			++queue.resetVertexBuffer;
+			vertices.revmapIVI2HWVI.clear();
+			_pMainVtxElems->indices.clear();
+		}
+
+		const size_t nIndices = entry.indices.size() / staging.indexSize;
+
+		if (bPrimary && (_bResetVertexBuffer || nIndices > queue.meshOp.indices->free()))
+			++queue.resetIndexBuffer;
+
+		// This is not a rebuild and is counted separately from extracted surfaces
+		++_extractstats.replays;
+
+		// Hardware vertex of each vertex of the entry
+		std::vector< HWVertexIndex > vHWVI (entry.shipment.size());
+		IsoVertexVector shipment;
+		HWVertexIndex nNext = HWVertexIndex(meshOp.nextVertexIndex());
+
+		for (size_t j = 0; j < entry.shipment.size(); ++j)
+		{
+			const IsoVertexIndex ivi = entry.shipment[j];
+
+			vHWVI[j] = _pMainVtxElems->indices[ivi];
+			if (vHWVI[j] == HWVertexIndex(~0))
+			{
+				vHWVI[j] = nNext++;
+				_pMainVtxElems->indices.set(ivi, vHWVI[j]);
+				memcpy(staging.vertices.append(staging.vertexSize), &entry.vertices[j * staging.vertexSize], staging.vertexSize);
+				shipment.push_back(ivi);
+			}
+		}
+
+		BuilderQueue::IndexRange range;
+
+		range.offset = staging.indexCount();
+		range.count = nIndices;
+		if (nIndices > 0)
+		{
+			void * pIndices = staging.indices.append(entry.indices.size());
+
+			// The indices of the entry number its own vertices from zero
+			for (size_t n = 0; n < nIndices; ++n)
+			{
+				const HWVertexIndex hwvi = vHWVI[
+					b32Bit 
+					? reinterpret_cast< const uint32 * > (&entry.indices[0])[n] 
+					: reinterpret_cast< const uint16 * > (&entry.indices[0])[n]
+				];
+
+				if (b32Bit)
+					static_cast< uint32 * > (pIndices)[n] = hwvi;
+				else
+					static_cast< uint16 * > (pIndices)[n] = static_cast< uint16 > (hwvi);
+			}
+		}
+
+		if (bPrimary)
+			queue.indexRange = range;
+		else
+		{
+			queue.siblings.push_back(BuilderQueue::Sibling(pResolution, enStitches));
+			queue.siblings.back().indices = range;
+		}
+
+		queue.revmapIVI2HWVIQueue.insert(queue.revmapIVI2HWVIQueue.end(), shipment.begin(), shipment.end());
+		vertices.update(IsoVertexRemapVector(), shipment.begin(), shipment.end());
+
+		// The shadow meta data reflects the voxels as they are now, stale cases are superseded and the dirty region is cleared once batched
+		pResolution->regCases = entry.regCases;
+		pResolution->borderIsoVertexProperties = entry.borderIsoVertexProperties;
+		pResolution->middleIsoVertexProperties = entry.middleIsoVertexProperties;
+		pResolution->shadowed = true;
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+		{
+			pResolution->stitches[s] ->transCases = entry.transCases[s];
+			pResolution->stitches[s] ->shadowed = entry.stitched[s];
 		}
+
+		return true;
+	}
+
+	void IsoSurfaceBuilder::retainBuild( 
+		const BuildCache::Key & key, 
+		const HardwareIsoVertexShadow::ProducerQueueAccess & queue, 
+		const LOD * pResolution, 
+		const BuilderQueue::IndexRange & indices, 
+		const size_t nBatchBase 
+	)
+	{
+		oht_assert_threadmodel(ThrMdl_Background);
+		OgreAssert(queue.remapHWVI2IVIQueue.empty(), "Staged vertices must follow the hardware vertex order");
+
+		const StagingArena & staging = queue.staging;
+		const size_t nStaged = staging.vertexCount();
+		const bool b32Bit = staging.indexSize == sizeof(uint32);
+		BuildCache::EntryPtr pEntry (new BuildCache::Entry);
+
+		if (indices.count > 0)
+		{
+			const unsigned char * pIndices = staging.indices.data(indices.offset * staging.indexSize);
+			// Vertex of the entry of each vertex staged by the batch
+			std::vector< HWVertexIndex > vLocal (nStaged, HWVertexIndex(~0));
+			HWVertexIndex nCount = 0;
+
+			pEntry->indices.resize(indices.count * staging.indexSize);
+			for (size_t n = 0; n < indices.count; ++n)
+			{
+				const size_t hwvi = b32Bit 
+					? reinterpret_cast< const uint32 * > (pIndices)[n] 
+					: reinterpret_cast< const uint16 * > (pIndices)[n];
+
+				// The configuration shares vertices batched to the GPU before, it cannot be replayed on its own
+				if (hwvi < nBatchBase || hwvi - nBatchBase >= nStaged)
+					return;
+
+				HWVertexIndex & local = vLocal[hwvi - nBatchBase];
+
+				if (local == HWVertexIndex(~0))
+				{
+					const unsigned char * pVertex = staging.vertices.data((hwvi - nBatchBase) * staging.vertexSize);
+
+					local = nCount++;
+					pEntry->shipment.push_back(queue.revmapIVI2HWVIQueue[hwvi - nBatchBase]);
+					pEntry->vertices.insert(pEntry->vertices.end(), pVertex, pVertex + staging.vertexSize);
+				}
+
+				if (b32Bit)
+					reinterpret_cast< uint32 * > (&pEntry->indices[0])[n] = local;
+				else
+					reinterpret_cast< uint16 * > (&pEntry->indices[0])[n] = static_cast< uint16 > (local);
+			}
+		}
+
+		pEntry->regCases = pResolution->regCases;
+		pEntry->borderIsoVertexProperties = pResolution->borderIsoVertexProperties;
+		pEntry->middleIsoVertexProperties = pResolution->middleIsoVertexProperties;
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+		{
+			pEntry->stitched[s] = pResolution->stitches[s] ->shadowed;
+			if (pEntry->stitched[s])
+				pEntry->transCases[s] = pResolution->stitches[s] ->transCases;
+		}
+
+		_pBuildCache->insert(key, pEntry);
+	}
+
+	unsigned long long IsoSurfaceBuilder::sampleHalo( const MetaFragment::Container * pMF, const Channel::Ident channel, const size_t nSurfaceFlags )
+	{
+		const DimensionType d = _cubemeta.dimensions;
+		unsigned long long nHash = 0;
+
+		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			_bHalo[s] = false;
+
+		if (!(nSurfaceFlags & IsoVertexElements::GEN_NORMALS) || _chanparams[channel].normalsType != NT_CentralDifference)
+			return 0;
+
+		auto fragment = pMF->acquire< MetaFragment::Interfaces::const_Basic >();
+
+		// Homogeneous regions yield no surface
+		if (fragment.block->getOccupancy().homogeneous())
+			return 0;
+
+		for (unsigned a = 0; a < 3; ++a)
+			for (unsigned h = 0; h < 2; ++h)
+			{
+				const OrthogonalNeighbor enSide = AxisSides[a][h];
+				const MetaFragment::Container * pNeighbor = fragment.neighbor(static_cast< Moore3DNeighbor > (enSide));
+
+				if (pNeighbor == NULL)
+					continue;
+
+				auto neighbor = pNeighbor->acquire< MetaFragment::Interfaces::const_Basic >();
+
+				if (neighbor.block == NULL)
+					continue;
+
+				// Neighbours share the layer of voxels at the common side, sample the next one into the neighbour
+				DimensionType 
+					lo[3] = { 0, 0, 0 },
+					hi[3] = { d, d, d };
+
+				lo[a] = hi[a] = h == 0 ? d - 1 : 1;
+
+				// Indexed by the two remaining axes, the higher one is major
+				std::vector< FieldStrength > & halo = _vHalo[enSide];
+				halo.resize((size_t(d) + 1) * (size_t(d) + 1));
+				neighbor.block->extractValues(lo[0], lo[1], lo[2], hi[0], hi[1], hi[2], &halo[0]);
+				_bHalo[enSide] = true;
+
+				nHash = (nHash ^ (enSide + 1)) * 0x100000001B3ULL;
+				for (std::vector< FieldStrength >::const_iterator i = halo.begin(); i != halo.end(); ++i)
+					nHash = (nHash ^ static_cast< unsigned char > (*i)) * 0x100000001B3ULL;
+			}
+
+		return nHash;
 	}
 
 	void IsoSurfaceBuilder::build( const Voxel::CubeDataRegion * pDataGrid, IsoSurfaceRenderable * pISR, const unsigned nLOD, const Touch3DFlags enStitches )
 	{
 		{ OGRE_LOCK_MUTEX(mMutex);
+			sampleHalo(pISR->getMetaWorldFragment(), pISR->getMetaWorldFragment() ->factory->channel, pISR->getMetaWorldFragment() ->factory->surfaceFlags);
+
 			HardwareIsoVertexShadow::DirectAccess direct = pISR->getShadow() ->requestDirectAccess(nLOD, enStitches);
+			// Rather than grow past the range of 16-bit indices the vertex buffer starts over
+			const size_t nCapacity = pISR->getMetaWorldFragment() ->factory->getIndexType() == HardwareIndexBuffer::IT_16BIT
+				? std::min(pISR->getVertexBufferCapacity(), MaxHWVertices16)
+				: pISR->getVertexBufferCapacity();
 
 			buildImpl(
 #if defined(_DEBUG) || defined(_OHT_LOG_TRACE)
@@ -308,7 +733,7 @@ namespace Ogre
 				pISR->getMetaWorldFragment() ->factory->channel,
 				&direct.meshOp, pDataGrid, pISR->getShadow(),
 				pISR->getMetaWorldFragment() ->factory->surfaceFlags,
-				enStitches, pISR->getVertexBufferCapacity()
+				enStitches, nCapacity
 			);
 			if (_bResetVertexBuffer)
 			{
@@ -319,14 +744,24 @@ namespace Ogre
 				direct.meshOp.clearIndices(IBufferManager::BD_GPU);
 			}
 
-			pISR->populateBuffers(
-				_pMainVtxElems, 
-				direct, 
-				_bResetVertexBuffer, 
-				_bResetIndexBuffer,
-				_pMainVtxElems->vertexShipment.size(), 
-				_pMainVtxElems->triangles.size() * 3
-			);
+			{ StageTimer timer (_timer, _extractstats.stages[Stage_QueueFill]);
+				const MetaVoxelFactory * pFactory = pISR->getMetaWorldFragment() ->factory;
+				BuilderQueue::IndexRange indices;
+
+				// Staged in the layout of the hardware buffers just as batches are, the renderable copies them in blocks
+				_staging.clear();
+				_staging.vertexSize = pFactory->getVertexSize();
+				_staging.indexSize = pFactory->getIndexType() == HardwareIndexBuffer::IT_32BIT ? sizeof(uint32) : sizeof(uint16);
+				stageBuffers(_staging, indices, pFactory, pDataGrid->getGridScale());
+
+				pISR->populateBuffers(
+					_pMainVtxElems, 
+					_staging,
+					direct, 
+					_bResetVertexBuffer, 
+					_bResetIndexBuffer
+				);
+			}
 		}
 	}
 
@@ -343,7 +778,8 @@ namespace Ogre
 		SharedPtr< HardwareIsoVertexShadow > & pShadow, 
 		const size_t nSurfaceFlags,
 		const Touch3DFlags enStitches, 
-		const size_t nVertexBufferCapacity
+		const size_t nVertexBufferCapacity,
+		const_DataAccessor * pData /*= NULL*/
 	)
 	{
 		oht_assert_threadmodel(ThrMdl_Single);
@@ -363,69 +799,183 @@ namespace Ogre
 
 		_nVertexBufPos = _pMeshOp->nextVertexIndex();
 		_nIndexBufFree = _pMeshOp->indices->free();
+
+		computeDirtyRegion(_pMeshOp->resolution->dirty, _pMeshOp->vertices->dirty);
+		if (!_dirtyVoxels.isNull())
+		{
+			const signed int nDim = _cubemeta.dimensions;
+
+			// Transition cells and the iso-vertex properties along them derive from voxels flush with the cube's sides, start over if any changed
+			if (_dirtyVoxels.x0 == 0 || _dirtyVoxels.y0 == 0 || _dirtyVoxels.z0 == 0 ||
+				_dirtyVoxels.xN == nDim || _dirtyVoxels.yN == nDim || _dirtyVoxels.zN == nDim)
+			{
+				for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+				{
+					_pMeshOp->resolution->stitches[s] ->transCases.clear();
+					_pMeshOp->resolution->stitches[s] ->shadowed = 
+					_pMeshOp->resolution->stitches[s] ->gpued = false;
+				}
+				_pMeshOp->resolution->borderIsoVertexProperties.clear();
+				_pMeshOp->resolution->middleIsoVertexProperties.clear();
+			}
+		}
+
 		_vBorderIVP = _pMeshOp->resolution->borderIsoVertexProperties;
 		_vCenterIVP = _pMeshOp->resolution->middleIsoVertexProperties;
 		_pMainVtxElems->clear();
-
-		const_DataAccessor data = pDataGrid->lease();
+		_occupancy = pDataGrid->getOccupancy();
 
 		OHT_ISB_DBGTRACE(">>> Name/LOD/Flags: " << _debugs.name << '/' << _nLOD << '/' << Touch3DFlagNames[_enStitches]);
-		//OHTDD_Translate(pDataGrid->getBoundingBox().getHalfSize() / pDataGrid->getGridScale());
-
-		// Check to see if the hardware buffer contains basic vertices for this resolution
-		if (!_pMeshOp->resolution->shadowed)
-			attainRegularTriangulationCases(data);
 
-		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+		// A region whose voxels all share the same sign has no non-trivial cells at any resolution nor along any side,
+		// so there is nothing to extract and no reason to decompress its voxels
+		if (_occupancy.homogeneous())
 		{
-			const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+			// The voxels were edited such that the surface previously extracted vanished entirely
+			if (!_dirtyVoxels.isNull())
+			{
+				_pMeshOp->resolution->regCases.clear();
+				for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+					_pMeshOp->resolution->stitches[s] ->transCases.clear();
+			}
 
-			if ((_enStitches & side) && !_pMeshOp->resolution->stitches[s] ->shadowed)
-				attainTransitionTriangulationCases(data, OrthogonalNeighbor(s));
+			// Stale hardware vertices of other resolutions are evicted all the same
+			if (!_staleVoxels.isNull())
+			{
+				_pMeshOp->restoreHWIndices(_pMainVtxElems->indices);
+				evictIsoVertices();
+				releaseFreeHWVertices();
+			}
+
+			if (_nVertexBufPos > nVertexBufferCapacity)
+			{
+				_bResetIndexBuffer =
+				_bResetVertexBuffer = true;
+
+				_nVertexBufPos = 0;
+				_pMainVtxElems->rollback();
+			}
+		} else if (pData != NULL)
+			extractSurface(pDataGrid, *pData, nVertexBufferCapacity);
+		else
+		{
+			const_DataAccessor data = pDataGrid->lease(getLeaseChannels(channel, nSurfaceFlags));
+			extractSurface(pDataGrid, data, nVertexBufferCapacity);
 		}
 
-		computeRegularRefinements(data);
+		_pMeshOp->resolution->borderIsoVertexProperties.insert(
+			_pMeshOp->resolution->borderIsoVertexProperties.end(), 
+			_vBorderIVP.begin() + _pMeshOp->resolution->borderIsoVertexProperties.size(), 
+			_vBorderIVP.end()
+		);
+		_pMeshOp->resolution->middleIsoVertexProperties.insert(
+			_pMeshOp->resolution->middleIsoVertexProperties.end(), 
+			_vCenterIVP.begin() + _pMeshOp->resolution->middleIsoVertexProperties.size(), 
+			_vCenterIVP.end()
+		);
+			
+		_pMeshOp->resolution->shadowed = true;
 		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
 		{
 			const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
 
 			if (_enStitches & side)
-				computeTransitionRefinements(OrthogonalNeighbor(s), data);
+				_pMeshOp->resolution->stitches[s] ->shadowed = true;
 		}
 
-		_pMeshOp->restoreHWIndices(_pMainVtxElems->indices);
+		const size_t nCellsPerSide = _cubemeta.dimensions >> _nLOD;
 
-		clearTransitionInfo();
-		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+		++_extractstats.builds;
+		_extractstats.cells += nCellsPerSide * nCellsPerSide * nCellsPerSide;
+		_extractstats.vertices += _pMainVtxElems->vertexShipment.size();
+		_extractstats.triangles += _pMainVtxElems->triangles.size();
+
+		_pMeshOp = NULL;
+		_pShadow.setNull();
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::extractSurface( const Voxel::CubeDataRegion * pDataGrid, const_DataAccessor & data, const size_t nVertexBufferCapacity )
+	{
+		partitionSlabs();
+
+		if (_pCurrentChannelParams->surfaceNets(_nLOD))
 		{
-			const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+			extractSurfaceNets(pDataGrid, data, nVertexBufferCapacity);
+			return;
+		}
+
+		//OHTDD_Translate(pDataGrid->getBoundingBox().getHalfSize() / pDataGrid->getGridScale());
+
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_CaseCodes]);
+			// Check to see if the hardware buffer contains basic vertices for this resolution
+			if (!_pMeshOp->resolution->shadowed)
+				attainRegularTriangulationCases(data);
+			else if (!_dirtyCells.isNull())
+				reattainRegularTriangulationCases(data);
 
-			if (_enStitches & side) 
+			for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
 			{
-				if (!_pMeshOp->resolution->stitches[s] ->gpued)
-					marshalTransitionVertexElements(pDataGrid, data, OrthogonalNeighbor(s));
-				if (!_pMeshOp->resolution->stitches[s] ->shadowed)
-					collectTransitionVertexProperties(data, OrthogonalNeighbor(s));
+				const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+
+				if ((_enStitches & side) && !_pMeshOp->resolution->stitches[s] ->shadowed)
+					attainTransitionTriangulationCases(data, OrthogonalNeighbor(s));
 			}
 		}
-		_vBorderIVP.insert(
-			_vBorderIVP.end(), 
-			_vTransInfos3[TransitionVRECaCC::TVT_FullOutside].begin(), 
-			_vTransInfos3[TransitionVRECaCC::TVT_FullOutside].end()
-		);
-		_vCenterIVP.insert(
-			_vCenterIVP.end(),
-			_vTransInfos3[TransitionVRECaCC::TVT_Half].begin(),
-			_vTransInfos3[TransitionVRECaCC::TVT_Half].end()
-		);
 
-		if (!_pMeshOp->resolution->gpued)
-			marshalRegularVertexElements(pDataGrid, data);
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Refinements]);
+			computeRegularRefinements(data);
+			for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			{
+				const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+
+				if (_enStitches & side)
+					computeTransitionRefinements(OrthogonalNeighbor(s), data);
+			}
+		}
+
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Marshal]);
+			_pMeshOp->restoreHWIndices(_pMainVtxElems->indices);
+			if (!_staleVoxels.isNull())
+				evictIsoVertices();
+
+			clearTransitionInfo();
+			for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+			{
+				const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+
+				if (_enStitches & side) 
+				{
+					if (!_pMeshOp->resolution->stitches[s] ->gpued)
+						marshalTransitionVertexElements(pDataGrid, data, OrthogonalNeighbor(s));
+					if (!_pMeshOp->resolution->stitches[s] ->shadowed)
+						collectTransitionVertexProperties(data, OrthogonalNeighbor(s));
+				}
+			}
+			_vBorderIVP.insert(
+				_vBorderIVP.end(), 
+				_vTransInfos3[TransitionVRECaCC::TVT_FullOutside].begin(), 
+				_vTransInfos3[TransitionVRECaCC::TVT_FullOutside].end()
+			);
+			_vCenterIVP.insert(
+				_vCenterIVP.end(),
+				_vTransInfos3[TransitionVRECaCC::TVT_Half].begin(),
+				_vTransInfos3[TransitionVRECaCC::TVT_Half].end()
+			);
+
+			marshalDirtyRegularVertexElements(pDataGrid, data);
+			if (!_pMeshOp->resolution->gpued)
+				marshalRegularVertexElements(pDataGrid, data);
 
-		restoreTransitionVertexMappings(data);
+			restoreTransitionVertexMappings(data);
+		}
 
-		triangulateRegulars();
-		triangulateTransitions();
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Triangulate]);
+			triangulateRegulars();
+			triangulateTransitions();
+		}
 
 		/* TODO: This is supposed to correct "plateaus" in transition cells (Lengyel p.39)
 			but the results look worse, needs work. */
@@ -434,56 +984,104 @@ namespace Ogre
 		_bResetIndexBuffer = (_pMainVtxElems->indexCount() > _nIndexBufFree);
 
 		const size_t nRequiredVertexBufferCapacity = _nVertexBufPos + _pMainVtxElems->vertexShipment.size();
-		if (nRequiredVertexBufferCapacity > nVertexBufferCapacity)
+		if (nRequiredVertexBufferCapacity > nVertexBufferCapacity || fragmented())
 		{
-			OHT_DBGTRACE("Buffer resized, " << nRequiredVertexBufferCapacity << " > " << nVertexBufferCapacity);
+			OHT_DBGTRACE("Buffer resized, " << nRequiredVertexBufferCapacity << " > " << nVertexBufferCapacity << " or compacted");
 				
 			_bResetIndexBuffer =
 			_bResetVertexBuffer = true;
 
 			_nVertexBufPos = 0;
 			_pMainVtxElems->rollback();
+			// The whole buffer is rebuilt, there is nothing to patch
+			_vFreeHWVertices.clear();
 
-			for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
-			{
-				const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+			{ StageTimer timer (_timer, _extractstats.stages[Stage_Marshal]);
+				for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
+				{
+					const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
 
-				if (_enStitches & side)
-					marshalTransitionVertexElements(pDataGrid, data, OrthogonalNeighbor(s));
-			}
+					if (_enStitches & side)
+						marshalTransitionVertexElements(pDataGrid, data, OrthogonalNeighbor(s));
+				}
 
-			marshalRegularVertexElements(pDataGrid, data);
+				marshalRegularVertexElements(pDataGrid, data);
+			}
 
-			triangulateRegulars();
-			triangulateTransitions();
+			{ StageTimer timer (_timer, _extractstats.stages[Stage_Triangulate]);
+				triangulateRegulars();
+				triangulateTransitions();
+			}
 
 			/* TODO: This is supposed to correct "plateaus" in transition cells (Lengyel p.39)
 				but the results look worse, needs work. */
 			//alignTransitionVertices();
 		}
 
-		_pMeshOp->resolution->borderIsoVertexProperties.insert(
-			_pMeshOp->resolution->borderIsoVertexProperties.end(), 
-			_vBorderIVP.begin() + _pMeshOp->resolution->borderIsoVertexProperties.size(), 
-			_vBorderIVP.end()
-		);
-		_pMeshOp->resolution->middleIsoVertexProperties.insert(
-			_pMeshOp->resolution->middleIsoVertexProperties.end(), 
-			_vCenterIVP.begin() + _pMeshOp->resolution->middleIsoVertexProperties.size(), 
-			_vCenterIVP.end()
-		);
-			
-		_pMeshOp->resolution->shadowed = true;
-		for (unsigned s = 0; s < CountOrthogonalNeighbors; ++s)
-		{
-			const Touch3DSide side = OrthogonalNeighbor_to_Touch3DSide[s];
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Triangulate]);
+			if (_pCurrentChannelParams->decimation(_nLOD))
+				decimateTriangles(pDataGrid, data);
 
-			if (_enStitches & side)
-				_pMeshOp->resolution->stitches[s] ->shadowed = true;
+			releaseFreeHWVertices();
+
+			if (_pCurrentChannelParams->optimizeVertexCache)
+				optimizeTriangleOrder();
 		}
+	}
 
-		_pMeshOp = NULL;
-		_pShadow.setNull();
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::extractSurfaceNets( const Voxel::CubeDataRegion * pDataGrid, const_DataAccessor & data, const size_t nVertexBufferCapacity )
+	{
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_CaseCodes]);
+			// Surface Nets shares the regular triangulation cases with Transvoxel, they identify the cells the surface passes through
+			if (!_pMeshOp->resolution->shadowed)
+				attainRegularTriangulationCases(data);
+			else if (!_dirtyCells.isNull())
+				reattainRegularTriangulationCases(data);
+		}
+
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Marshal]);
+			_pMeshOp->restoreHWIndices(_pMainVtxElems->indices);
+			if (!_staleVoxels.isNull())
+				evictIsoVertices();
+		}
+
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Triangulate]);
+			// Iso-vertices are configured as the quads are emitted
+			triangulateNets(pDataGrid, data);
+		}
+
+		_bResetIndexBuffer = (_pMainVtxElems->indexCount() > _nIndexBufFree);
+
+		const size_t nRequiredVertexBufferCapacity = _nVertexBufPos + _pMainVtxElems->vertexShipment.size();
+		if (nRequiredVertexBufferCapacity > nVertexBufferCapacity || fragmented())
+		{
+			OHT_DBGTRACE("Buffer resized, " << nRequiredVertexBufferCapacity << " > " << nVertexBufferCapacity << " or compacted");
+				
+			_bResetIndexBuffer =
+			_bResetVertexBuffer = true;
+
+			_nVertexBufPos = 0;
+			_pMainVtxElems->rollback();
+			// The whole buffer is rebuilt, there is nothing to patch
+			_vFreeHWVertices.clear();
+
+			{ StageTimer timer (_timer, _extractstats.stages[Stage_Triangulate]);
+				triangulateNets(pDataGrid, data);
+			}
+		}
+
+		{ StageTimer timer (_timer, _extractstats.stages[Stage_Triangulate]);
+			if (_pCurrentChannelParams->decimation(_nLOD))
+				decimateTriangles(pDataGrid, data);
+
+			releaseFreeHWVertices();
+
+			if (_pCurrentChannelParams->optimizeVertexCache)
+				optimizeTriangleOrder();
+		}
 	}
 
 	std::pair< bool, Real > IsoSurfaceBuilder::rayQuery( 
@@ -521,7 +1119,8 @@ namespace Ogre
 			SharedPtr< IRegularCaseLookup > pcluReg;
 			SharedPtr< ITransitionCaseLookup > pcluTran;
 			
-			if (ro.meshOp.resolution->shadowed)
+			// Cached cases are stale within the dirty region until the resolution is patched
+			if (ro.meshOp.resolution->shadowed && ro.meshOp.resolution->dirty.isNull())
 			{
 				pcluReg.bind(new RegularCaseCache(ro.meshOp.resolution, _cubemeta));
 				pcluTran.bind(new TransitionCaseCache(ro.meshOp.resolution, _cubemeta));
@@ -688,6 +1287,98 @@ namespace Ogre
 		}
 	}
 
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	std::pair< bool, Real > IsoSurfaceBuilder::rayQueryField( 
+		const Real limit,
+		const CubeDataRegion * pDataGrid, 
+		const Ray & ray, 
+		const unsigned nLOD, 
+		const Real fTolerance,
+		const FieldStrength * pValues /*= NULL*/
+	)
+	{
+		std::pair< bool, Real > result (false, 0);
+
+		// There is no surface where all voxels share the same sign
+		if (pDataGrid->getOccupancy().homogeneous())
+			return result;
+
+		if (pValues == NULL)
+		{
+			const const_ValuesAccessor data = pDataGrid->leaseValues();
+			return rayQueryField(limit, pDataGrid, ray, nLOD, fTolerance, data.values);
+		}
+
+		const CubeDataRegionDescriptor & cubemeta = pDataGrid->meta;
+		const IsoFixVec3 * vertices = pDataGrid->getVertices();
+		const Real fSpan = Real(1 << nLOD);
+
+		DiscreteRayIterator walker(ray, fSpan, Vector3::UNIT_SCALE * pDataGrid->getBoxSize().getMinimum() / pDataGrid->getGridScale());
+		GridCell gc(cubemeta, nLOD);
+		GridCellCoords gcc(
+			DimensionType(walker->i << nLOD),
+			DimensionType(walker->j << nLOD),
+			DimensionType(walker->k << nLOD),
+			nLOD
+		);
+
+		while (walker < limit &&
+			gcc.i < cubemeta.dimensions &&
+			gcc.j < cubemeta.dimensions &&
+			gcc.k < cubemeta.dimensions
+		)
+		{
+			gc = gcc;
+
+			VoxelIndex corners[8];
+			unsigned char casecode = 0;
+
+			for (unsigned char c = 0; c < 8; ++c)
+			{
+				corners[c] = gc.corners[c];
+				casecode |= ((pValues[corners[c]] >> 7) & 1) << c;
+			}
+
+			// Cells whose corners all share the same sign are trivial just as they are for triangulation
+			if (casecode != 0x00 && casecode != 0xFF)
+			{
+				const Vector3
+					vMin = vertices[corners[0]],
+					vMax = vertices[corners[7]];
+				Real t0, t1;
+
+				if (Math::intersects(ray, AxisAlignedBox(vMin, vMax), &t0, &t1) && t1 > t0)
+				{
+					Real afCorners[8];
+
+					for (unsigned char c = 0; c < 8; ++c)
+						afCorners[c] = Real(pValues[corners[c]]);
+
+					const Vector3
+						u0 = (ray.getPoint(t0) - vMin) / fSpan,
+						u1 = (ray.getPoint(t1) - vMin) / fSpan;
+					Real fRoot;
+
+					if (findTrilinearRoot(afCorners, u0, u1, fTolerance / (t1 - t0), fRoot))
+					{
+						result.first = true;
+						result.second = t0 + (t1 - t0) * fRoot;
+						return result;
+					}
+				}
+			}
+
+			++walker;
+			gcc.i = DimensionType(walker->i << nLOD);
+			gcc.j = DimensionType(walker->j << nLOD);
+			gcc.k = DimensionType(walker->k << nLOD);
+		}
+
+		return result;
+	}
+
 #ifdef _DEBUG
 	#pragma optimize("gtpy", on)
 #endif
@@ -729,9 +1420,9 @@ namespace Ogre
 			computeRefinedTransitionIsoVertex(tc, data, vrecacc, ei, cif0, cif1, tsx, tsy, rside, fivi, csc);
 
 			if (((_enStitches | touch) ^ _enStitches) == 0)
-				_pMainVtxElems->remappings[fivi] = index;
+				_pMainVtxElems->remappings.set(fivi, index);
 			else
-				_pMainVtxElems->trmappings[index] = fivi;
+				_pMainVtxElems->trmappings.set(index, fivi);
 		}
 	}
 
@@ -743,21 +1434,123 @@ namespace Ogre
 		OgreAssert(_nLOD < _pCurrentChannelParams->clod, "Level of detail exceeds lowest allowed");
 		oht_assert_threadmodel(ThrMdl_Single);
 
+		RegularTriangulationCaseList & regCases = _pMeshOp->resolution->regCases;
+
+		if (_bShareCaseCodes && !_bCaseCodes0)
+			classifyCells(data);
+
+		if (_nSlabs > 1)
+		{
+			forEachSlab([&] (const size_t s)
+			{
+				Slab & slab = *_vpSlabs[s];
+
+				slab.cases.clear();
+				attainRegularTriangulationCases(data, slab.z0, slab.zN, slab.rowccc, slab.cases);
+			});
+
+			// Slabs are ordered along Z, so concatenating them yields the same order as the serial path
+			for (size_t s = 0; s < _nSlabs; ++s)
+				regCases.insert(regCases.end(), _vpSlabs[s]->cases.begin(), _vpSlabs[s]->cases.end());
+		} else
+			attainRegularTriangulationCases(data, 0, _cubemeta.dimensions, _rowccc, regCases);
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::attainRegularTriangulationCases( 
+		const_DataAccessor & data, 
+		const DimensionType z0, const DimensionType zN, 
+		RegularCaseRowCompiler & rowccc, 
+		RegularTriangulationCaseList & cases 
+	)
+	{
 		const IsoVertexIndex nDim = _cubemeta.dimensions;
 		typedef DimensionType DimType;
 		const DimType nResSpan = 1 << _nLOD;
 		NonTrivialRegularCase nontrivialcase;
 
-		for (iterator_GridCells i = iterate_GridCells(data); i; ++i)
-		{
-			nontrivialcase.casecode = i->casecode;
-			nontrivialcase.cell = i->gc.index();
+		for (DimType z = z0; z < zN; z += nResSpan)
+			for (DimType y = 0; y < nDim; y += nResSpan)
+			{
+				// Every cell of a row lying within macro cells of uniform sign is trivial
+				if (_occupancy.query(0, y, z, nDim, y + nResSpan, z + nResSpan) != SignOccupancy::Occ_Mixed)
+					continue;
+
+				const size_t nNonTrivials = 
+					_bCaseCodes0 
+					? rowccc.derive(&_vCaseCodes0[0], y, z, _nLOD) 
+					: rowccc.compile(data.values, y, z, _nLOD);
 
-			if (!i->trivial)
+				for (size_t i = 0; i < nNonTrivials; ++i)
+				{
+					const DimType c = rowccc.nontrivials[i];
+
+					// Cell has a nontrivial triangulation.
+					nontrivialcase.casecode = rowccc.casecodes[c];
+					nontrivialcase.cell = _cubemeta.getGridCellIndex(c << _nLOD, y, z);
+					cases.push_back(nontrivialcase);
+				}
+			}
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::classifyCells( const_DataAccessor & data )
+	{
+		const DimensionType nDim = _cubemeta.dimensions;
+
+		_vCaseCodes0.resize(size_t(nDim) * nDim * nDim);
+
+		for (DimensionType z = 0; z < nDim; ++z)
+			for (DimensionType y = 0; y < nDim; ++y)
 			{
-				// Cell has a nontrivial triangulation.
-				_pMeshOp->resolution->regCases.push_back(nontrivialcase);
+				NonTrivialRegularCase::CodeType * vRow = &_vCaseCodes0[(size_t(z) * nDim + y) * nDim];
+
+				// A row of uniform sign is trivial, every corner of every cell has the sign bit of that sign
+				switch (_occupancy.query(0, y, z, nDim, y + 1, z + 1))
+				{
+				case SignOccupancy::Occ_Negative:
+					memset(vRow, 0xFF, nDim);
+					break;
+				case SignOccupancy::Occ_Positive:
+					memset(vRow, 0x00, nDim);
+					break;
+				default:
+					_rowccc.compile(data.values, y, z, 0);
+					memcpy(vRow, _rowccc.casecodes, nDim);
+					break;
+				}
 			}
+
+		_bCaseCodes0 = true;
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::partitionSlabs()
+	{
+		// Intra-cube parallelism is disabled, _nSlabs remains one
+		if (_vpSlabs.empty())
+			return;
+
+		const DimensionType 
+			nResSpan = 1 << _nLOD,
+			nLayers = _cubemeta.dimensions >> _nLOD;
+
+		// Splitting few cells only adds synchronization, coarse levels of detail get fewer slabs and the coarsest are extracted serially
+		const size_t nCells = size_t(nLayers) * size_t(nLayers) * size_t(nLayers);
+
+		_nSlabs = std::max(std::min(std::min(_vpSlabs.size(), size_t(nLayers)), nCells / MinSlabCells), size_t(1));
+
+		// Distribute layers of cells as evenly as possible, slab boundaries fall on cell boundaries of the current LOD
+		for (size_t s = 0; s < _nSlabs; ++s)
+		{
+			_vpSlabs[s]->z0 = DimensionType(s * nLayers / _nSlabs * nResSpan);
+			_vpSlabs[s]->zN = DimensionType((s + 1) * nLayers / _nSlabs * nResSpan);
 		}
 	}
 
@@ -774,6 +1567,10 @@ namespace Ogre
 
 		OgreAssert(_pMeshOp->resolution->stitches[on] != NULL, "Transition state was not allocated");
 
+		// Transition cells only sample the voxels of the full-resolution face, every cell is trivial if they share the same sign
+		if (_occupancy.query(OrthogonalNeighbor_to_Touch3DSide[on]) != SignOccupancy::Occ_Mixed)
+			return;
+
 		for (tc.x = 0; tc.x < nDim; tc.x += nResSpan)
 			for (tc.y = 0; tc.y < nDim; tc.y += nResSpan)
 			{
@@ -799,6 +1596,11 @@ namespace Ogre
 
 		GridCell gc (_cubemeta, _nLOD);
 		IsoFixVec3::PrecisionType t;
+		const size_t nFirst = _pMainVtxElems->vertexShipment.size();
+		// Central differences are computed in batches so shipped iso-vertices are always configured afterwards
+		const bool bDeferred = 
+			_nSlabs > 1 || 
+			((_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) && _pCurrentChannelParams->normalsType == NT_CentralDifference);
 
 		processRegularIsoVertices
 		(
@@ -806,16 +1608,467 @@ namespace Ogre
 			gc, 
 			[&] (const IsoVertexIndex ivi, const VoxelIndex c0, const VoxelIndex c1) 
 			{
-				t = computeIsoVertexPosition(data.values, c0, c1);
-				configureIsoVertex(_pMainVtxElems, pDataGrid, data, ivi, t, c0, c1);
+				// When split into slabs only the hardware index and attribute allocation happens here, they alone are order-dependent,
+				// iso-vertices reoccupying evicted hardware vertices are not part of the shipment and so are configured here regardless
+				if (!shipIsoVertex(ivi) || !bDeferred)
+				{
+					t = computeIsoVertexPosition(data.values, c0, c1);
+					configureIsoVertex(_pMainVtxElems, pDataGrid, data, ivi, t, c0, c1);
+				} else
+					_pMainVtxElems->touch(ivi);
 
-				OgreAssert(_pMainVtxElems->indices[ivi] == HWVertexIndex(~0), "Expected unallocated HW iso-vertex index");
-				// Assign the next index in the hardware vertex buffer to this iso-vertex
-				_pMainVtxElems->indices[ivi] = _nVertexBufPos++;
-				_pMainVtxElems->vertexShipment.push_back(ivi);
 				OHT_ISB_DBGTRACE("MarshalRegular " << ivi << " to HWIdx " << (_nHWBufPos - 1) << ", position=" << _pMainVtxElems->positions[ivi]);
 			}
 		);
+
+		if (bDeferred)
+			configureRegularIsoVertices(pDataGrid, data, nFirst);
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::configureRegularIsoVertices( const CubeDataRegion * pDataGrid, const_DataAccessor & data, const size_t nFirst )
+	{
+		const IsoVertexVector & shipment = _pMainVtxElems->vertexShipment;
+		const size_t nCount = shipment.size() - nFirst;
+		const bool bCentralDifferences = 
+			(_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) && 
+			_pCurrentChannelParams->normalsType == NT_CentralDifference;
+
+		// Every iso-vertex occurs once in the shipment, so contiguous portions of it can be configured independently
+		forEachSlab([&] (const size_t s)
+		{
+			const size_t iN = nFirst + (s + 1) * nCount / _nSlabs;
+
+			if (bCentralDifferences)
+			{
+				VoxelIndex corners[CentralDifferenceBatch * 2];
+				Vector3 gradients[CentralDifferenceBatch * 2];
+
+				for (size_t i = nFirst + s * nCount / _nSlabs; i < iN; i += CentralDifferenceBatch)
+				{
+					const size_t nBatch = iN - i < CentralDifferenceBatch ? iN - i : CentralDifferenceBatch;
+
+					for (size_t b = 0; b < nBatch; ++b)
+					{
+						const MainVertexElements::CellIndexPair & pair = _pMainVtxElems->cellindices[shipment[i + b]];
+
+						corners[b * 2 + 0] = pair.corner0;
+						corners[b * 2 + 1] = pair.corner1;
+					}
+
+					computeCentralDifferences(data.values, corners, nBatch * 2, gradients);
+
+					for (size_t b = 0; b < nBatch; ++b)
+						configureIsoVertex(
+							_pMainVtxElems, pDataGrid, data, shipment[i + b], 
+							computeIsoVertexPosition(data.values, corners[b * 2 + 0], corners[b * 2 + 1]), 
+							corners[b * 2 + 0], corners[b * 2 + 1],
+							IsoFixVec3(static_cast< signed short >(0), static_cast< signed short >(0), static_cast< signed short >(0)),
+							&gradients[b * 2]
+						);
+				}
+			} else
+			{
+				for (size_t i = nFirst + s * nCount / _nSlabs; i < iN; ++i)
+				{
+					const IsoVertexIndex ivi = shipment[i];
+					const MainVertexElements::CellIndexPair & pair = _pMainVtxElems->cellindices[ivi];
+
+					configureIsoVertex(
+						_pMainVtxElems, pDataGrid, data, ivi, 
+						computeIsoVertexPosition(data.values, pair.corner0, pair.corner1), 
+						pair.corner0, pair.corner1
+					);
+				}
+			}
+		});
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	bool IsoSurfaceBuilder::shipIsoVertex( const IsoVertexIndex ivi )
+	{
+		OgreAssert(_pMainVtxElems->indices[ivi] == HWVertexIndex(~0), "Expected unallocated HW iso-vertex index");
+
+		if (!_vFreeHWVertices.empty())
+		{
+			// Reoccupy a hardware vertex evicted while patching, the hardware vertex is rewritten in-place
+			const HWVertexIndex hwvi = _vFreeHWVertices.back();
+
+			_vFreeHWVertices.pop_back();
+			_pMainVtxElems->indices.set(ivi, hwvi);
+			_pMainVtxElems->vertexRemaps.push_back(IsoVertexRemap(hwvi, ivi));
+			return false;
+		}
+
+		// Assign the next index in the hardware vertex buffer to this iso-vertex
+		_pMainVtxElems->indices.set(ivi, _nVertexBufPos++);
+		_pMainVtxElems->vertexShipment.push_back(ivi);
+		return true;
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::releaseFreeHWVertices()
+	{
+		for (std::vector< HWVertexIndex >::const_iterator i = _vFreeHWVertices.begin(); i != _vFreeHWVertices.end(); ++i)
+			_pMainVtxElems->vertexRemaps.push_back(IsoVertexRemap(*i, IsoVertexIndex(~0)));
+
+		_vFreeHWVertices.clear();
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::optimizeTriangleOrder()
+	{
+		IsoTriangleVector & triangles = _pMainVtxElems->triangles;
+		const size_t nTriangleCount = triangles.size();
+
+		if (nTriangleCount < 2)
+			return;
+
+		size_t nVertexCount = 0;
+
+		_vCacheIndices.clear();
+		_vCacheIndices.reserve(nTriangleCount * 3);
+		for (IsoTriangleVector::const_iterator i = triangles.begin(); i != triangles.end(); ++i)
+			for (unsigned c = 0; c < 3; ++c)
+			{
+				const HWVertexIndex hwvi = _pMainVtxElems->indices[i->vertices[c]];
+
+				OgreAssert(hwvi != HWVertexIndex(~0), "Iso-vertex to hardware vertex index not mapped");
+				_vCacheIndices.push_back(hwvi);
+				nVertexCount = std::max(nVertexCount, size_t(hwvi) + 1);
+			}
+
+		_nCacheTriangles += nTriangleCount;
+		_nCacheMissesBefore += VertexCacheOptimizer::countCacheMisses(&_vCacheIndices[0], nTriangleCount);
+
+		_vco.optimize(&_vCacheIndices[0], nTriangleCount, nVertexCount, _vTriangleOrder);
+
+		_vReorderedTriangles.clear();
+		_vReorderedTriangles.reserve(nTriangleCount);
+		_vCacheIndices.clear();
+		for (std::vector< size_t >::const_iterator i = _vTriangleOrder.begin(); i != _vTriangleOrder.end(); ++i)
+		{
+			const IsoTriangle & tri = triangles[*i];
+
+			_vReorderedTriangles.push_back(tri);
+			for (unsigned c = 0; c < 3; ++c)
+				_vCacheIndices.push_back(_pMainVtxElems->indices[tri.vertices[c]]);
+		}
+		triangles.swap(_vReorderedTriangles);
+
+		_nCacheMissesAfter += VertexCacheOptimizer::countCacheMisses(&_vCacheIndices[0], nTriangleCount);
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::decimateTriangles( const CubeDataRegion * pDataGrid, const_DataAccessor & data )
+	{
+		IsoTriangleVector & triangles = _pMainVtxElems->triangles;
+		const size_t nTriangleCount = triangles.size();
+
+		if (nTriangleCount < 2)
+			return;
+
+		_vDecimationVertices.clear();
+		_vDecimationVertices.reserve(nTriangleCount * 3);
+		for (IsoTriangleVector::const_iterator i = triangles.begin(); i != triangles.end(); ++i)
+			_vDecimationVertices.insert(_vDecimationVertices.end(), i->vertices, i->vertices + 3);
+
+		std::sort(_vDecimationVertices.begin(), _vDecimationVertices.end());
+		_vDecimationVertices.erase(std::unique(_vDecimationVertices.begin(), _vDecimationVertices.end()), _vDecimationVertices.end());
+
+		const size_t nVertexCount = _vDecimationVertices.size();
+		const IsoFixVec3* vertices = pDataGrid->getVertices();
+		const DimensionType d = _cubemeta.dimensions;
+		GridPointCoords gp0, gp1;
+
+		_vDecimationPositions.resize(nVertexCount);
+		_vDecimationLocked.assign(nVertexCount, false);
+		for (size_t v = 0; v < nVertexCount; ++v)
+		{
+			const IsoVertexIndex ivi = _vDecimationVertices[v];
+			const MainVertexElements::CellIndexPair & pair = _pMainVtxElems->cellindices[ivi];
+
+			_cubemeta.computeGridPoint(gp0, pair.corner0);
+			_cubemeta.computeGridPoint(gp1, pair.corner1);
+
+			// Iso-vertices already in the hardware buffer are not necessarily configured by this build
+			if (_pMainVtxElems->touched(ivi))
+				_vDecimationPositions[v] = _pMainVtxElems->positions[ivi];
+			else if (_pMainVtxElems->isNetVertex(ivi))
+			{
+				// A cell vertex averages the crossings in its box, the pair merely spans the diagonal of the box
+				const SurfaceNets::Box box = { gp0.i, gp0.j, gp0.k, gp1.i, gp1.j, gp1.k };
+
+				configureNetVertex(pDataGrid, data, ivi, box);
+				_vDecimationPositions[v] = _pMainVtxElems->positions[ivi];
+			} else
+			{
+				const IsoFixVec3::PrecisionType t = computeIsoVertexPosition(data.values, pair.corner0, pair.corner1);
+				_vDecimationPositions[v] = vertices[pair.corner0]*t + vertices[pair.corner1]*(-t+signed short(1));
+			}
+
+			// An iso-vertex is flush with a side of the cube if both voxels it depends on are
+			_vDecimationLocked[v] = 
+				(gp0.i == gp1.i && (gp0.i == 0 || gp0.i == d)) ||
+				(gp0.j == gp1.j && (gp0.j == 0 || gp0.j == d)) ||
+				(gp0.k == gp1.k && (gp0.k == 0 || gp0.k == d));
+		}
+
+		_vDecimationIndices.clear();
+		_vDecimationIndices.reserve(nTriangleCount * 3);
+		for (IsoTriangleVector::const_iterator i = triangles.begin(); i != triangles.end(); ++i)
+			for (unsigned c = 0; c < 3; ++c)
+				_vDecimationIndices.push_back(size_t(
+					std::lower_bound(_vDecimationVertices.begin(), _vDecimationVertices.end(), i->vertices[c]) - _vDecimationVertices.begin()
+				));
+
+		const MeshDecimator::Result result = _decimator.decimate(
+			&_vDecimationPositions[0], _vDecimationLocked, _vDecimationIndices, _pCurrentChannelParams->decimationMaxError
+		);
+
+		triangles.resize(_vDecimationIndices.size() / 3);
+		for (size_t t = 0; t < triangles.size(); ++t)
+		{
+#ifdef _OHT_LOG_TRACE
+			triangles[t].id = t;
+#endif
+			for (unsigned c = 0; c < 3; ++c)
+				triangles[t].vertices[c] = _vDecimationVertices[_vDecimationIndices[t * 3 + c]];
+		}
+
+		_nDecimationTrianglesBefore += nTriangleCount;
+		_nDecimationTrianglesAfter += triangles.size();
+		_nDecimationCollapses += result.collapses;
+		_fDecimationMaxError = std::max(_fDecimationMaxError, result.maxError);
+		_fDecimationTotalError += result.totalError;
+
+		// Fewer indices may fit the free space of the index buffer now, unless the whole buffer is rebuilt anyway
+		if (!_bResetVertexBuffer)
+			_bResetIndexBuffer = (_pMainVtxElems->indexCount() > _nIndexBufFree);
+	}
+
+	void IsoSurfaceBuilder::takeDecimationStatistics( size_t & nTrianglesBefore, size_t & nTrianglesAfter, size_t & nCollapses, Real & fMaxError, Real & fTotalError )
+	{
+		nTrianglesBefore = _nDecimationTrianglesBefore;
+		nTrianglesAfter = _nDecimationTrianglesAfter;
+		nCollapses = _nDecimationCollapses;
+		fMaxError = _fDecimationMaxError;
+		fTotalError = _fDecimationTotalError;
+
+		_nDecimationTrianglesBefore = _nDecimationTrianglesAfter = _nDecimationCollapses = 0;
+		_fDecimationMaxError = _fDecimationTotalError = 0;
+	}
+
+	void IsoSurfaceBuilder::takeExtractionStatistics( ExtractionStatistics & stats )
+	{
+		stats = _extractstats;
+		_extractstats = ExtractionStatistics();
+	}
+
+	void IsoSurfaceBuilder::takeVertexCacheStatistics( size_t & nTriangles, size_t & nMissesBefore, size_t & nMissesAfter )
+	{
+		nTriangles = _nCacheTriangles;
+		nMissesBefore = _nCacheMissesBefore;
+		nMissesAfter = _nCacheMissesAfter;
+
+		_nCacheTriangles = _nCacheMissesBefore = _nCacheMissesAfter = 0;
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::computeDirtyRegion( const CellRegion & voxels, const CellRegion & stale )
+	{
+		_vDirtyRegCases.clear();
+		_vFreeHWVertices.clear();
+
+		const signed int
+			nDim = _cubemeta.dimensions,
+			nResSpan = 1 << _nLOD;
+
+		// Gradients of voxels adjacent to those that changed are affected too, voxels of the apron have no iso-vertices
+		auto grow = [nDim] (const CellRegion & region) -> CellRegion
+		{
+			if (region.isNull())
+				return region;
+
+			return CellRegion(
+				std::max(region.x0 - 1, 0), std::max(region.y0 - 1, 0), std::max(region.z0 - 1, 0),
+				std::min(region.xN + 1, nDim), std::min(region.yN + 1, nDim), std::min(region.zN + 1, nDim)
+			);
+		};
+
+		_staleVoxels = grow(stale);
+		_dirtyVoxels = grow(voxels);
+
+		if (_dirtyVoxels.isNull())
+		{
+			_dirtyCells.setNull();
+			return;
+		}
+
+		// Cells of the current resolution span [c, c + nResSpan] along each axis, find the first and last aligned cells reaching a dirty voxel
+		auto first = [nResSpan] (const signed int p) -> signed int { return std::max(((p + nResSpan - 1) / nResSpan - 1) * nResSpan, 0); };
+		auto last = [nResSpan, nDim] (const signed int p) -> signed int { return std::min(p / nResSpan * nResSpan, nDim - nResSpan); };
+
+		_dirtyCells = CellRegion(
+			first(_dirtyVoxels.x0), first(_dirtyVoxels.y0), first(_dirtyVoxels.z0),
+			last(_dirtyVoxels.xN), last(_dirtyVoxels.yN), last(_dirtyVoxels.zN)
+		);
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::reattainRegularTriangulationCases( const_DataAccessor & data )
+	{
+		OgreAssert(_nLOD < _pCurrentChannelParams->clod, "Level of detail exceeds lowest allowed");
+		oht_assert_threadmodel(ThrMdl_Single);
+
+		RegularTriangulationCaseList & regCases = _pMeshOp->resolution->regCases;
+		typedef DimensionType DimType;
+		const DimType nResSpan = 1 << _nLOD;
+		NonTrivialRegularCase nontrivialcase;
+
+		const DimType 
+			x0 = DimType(_dirtyCells.x0), 
+			xN = DimType(_dirtyCells.xN);
+
+		for (DimType z = DimType(_dirtyCells.z0); z <= _dirtyCells.zN; z += nResSpan)
+			for (DimType y = DimType(_dirtyCells.y0); y <= _dirtyCells.yN; y += nResSpan)
+			{
+				if (_occupancy.query(x0, y, z, xN + nResSpan, y + nResSpan, z + nResSpan) != SignOccupancy::Occ_Mixed)
+					continue;
+
+				// The whole row is compiled at once, only the cells within the dirty region are kept
+				const size_t nNonTrivials = 
+					_bCaseCodes0 
+					? _rowccc.derive(&_vCaseCodes0[0], y, z, _nLOD) 
+					: _rowccc.compile(data.values, y, z, _nLOD);
+
+				for (size_t i = 0; i < nNonTrivials; ++i)
+				{
+					const DimType c = _rowccc.nontrivials[i];
+					const DimType x = c << _nLOD;
+
+					if (x < x0 || x > xN)
+						continue;
+
+					nontrivialcase.casecode = _rowccc.casecodes[c];
+					nontrivialcase.cell = _cubemeta.getGridCellIndex(x, y, z);
+					_vDirtyRegCases.push_back(nontrivialcase);
+				}
+			}
+
+		// Both lists are ordered by cell index, merge the fresh cases with the cached cases outside of the dirty region
+		RegularTriangulationCaseList merged;
+		GridCellCoords gcc(_nLOD);
+
+		merged.reserve(regCases.size() + _vDirtyRegCases.size());
+		RegularTriangulationCaseList::const_iterator j = _vDirtyRegCases.begin();
+		for (RegularTriangulationCaseList::const_iterator i = regCases.begin(); i != regCases.end(); ++i)
+		{
+			_cubemeta.computeGridCell(gcc, i->cell);
+			if (_dirtyCells.contains(gcc.i, gcc.j, gcc.k))
+				continue;
+
+			for (; j != _vDirtyRegCases.end() && j->cell < i->cell; ++j)
+				merged.push_back(*j);
+			merged.push_back(*i);
+		}
+		merged.insert(merged.end(), j, RegularTriangulationCaseList::const_iterator(_vDirtyRegCases.end()));
+
+		regCases.swap(merged);
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::evictIsoVertices()
+	{
+		const IsoVertexVector & revmap = _pMeshOp->vertices->revmapIVI2HWVI;
+		GridPointCoords gp0, gp1;
+
+		for (size_t hwvi = 0; hwvi < revmap.size(); ++hwvi)
+		{
+			const IsoVertexIndex ivi = revmap[hwvi];
+
+			// Holes left by previous patches are reoccupied along with the hardware vertices evicted now
+			if (ivi == IsoVertexIndex(~0))
+			{
+				_vFreeHWVertices.push_back(static_cast< HWVertexIndex > (hwvi));
+				continue;
+			}
+
+			// An iso-vertex depends only on the voxels (and their gradients) at either end of the edge it lies on
+			const MainVertexElements::CellIndexPair & pair = _pMainVtxElems->cellindices[ivi];
+			_cubemeta.computeGridPoint(gp0, pair.corner0);
+			_cubemeta.computeGridPoint(gp1, pair.corner1);
+
+			const CellRegion edge(
+				std::min(gp0.i, gp1.i), std::min(gp0.j, gp1.j), std::min(gp0.k, gp1.k),
+				std::max(gp0.i, gp1.i), std::max(gp0.j, gp1.j), std::max(gp0.k, gp1.k)
+			);
+
+			if (edge.intersects(_staleVoxels))
+			{
+				_pMainVtxElems->indices.set(ivi, HWVertexIndex(~0));
+				_vFreeHWVertices.push_back(static_cast< HWVertexIndex > (hwvi));
+			}
+		}
+
+		// Reoccupy the lowest hardware vertices first
+		std::reverse(_vFreeHWVertices.begin(), _vFreeHWVertices.end());
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::marshalDirtyRegularVertexElements( const CubeDataRegion * pDataGrid, const_DataAccessor & data )
+	{
+		oht_assert_threadmodel(ThrMdl_Single);
+
+		GridCell gc (_cubemeta, _nLOD);
+
+		// Only averaged normals of iso-vertices already in the hardware buffer depend on the triangles surrounding them
+		const bool bPatchNormals = 
+			(_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) && 
+			_pCurrentChannelParams->averagedNormals();
+
+		walkCellVertices(_vDirtyRegCases.begin(), _vDirtyRegCases.end(), gc, [&] (const GridCell & gc, const unsigned short nVRECaCC, const unsigned nLOD)
+		{
+			const IsoVertexIndex refined = _pMainVtxElems->refinements[_pMainVtxElems->getRegularVertexIndex(gc, VRECaCC(nVRECaCC), _nLOD)];
+
+			OgreAssert(refined != IsoVertexIndex(~0), "Unmapped refinement");
+			if (_pMainVtxElems->touched(refined))
+				return;
+
+			const HWVertexIndex hwvi = _pMainVtxElems->indices[refined];
+
+			if (hwvi == HWVertexIndex(~0))
+				shipIsoVertex(refined);
+			else if (bPatchNormals)
+				_pMainVtxElems->vertexRemaps.push_back(IsoVertexRemap(hwvi, refined));
+			else
+				return;
+
+			const MainVertexElements::CellIndexPair & pair = _pMainVtxElems->cellindices[refined];
+			configureIsoVertex(
+				_pMainVtxElems, pDataGrid, data, refined, 
+				computeIsoVertexPosition(data.values, pair.corner0, pair.corner1), 
+				pair.corner0, pair.corner1
+			);
+		});
 	}
 
 #ifdef _DEBUG
@@ -852,9 +2105,7 @@ namespace Ogre
 					dv & long(~((type & TransitionVRECaCC::TVT_Half) - 1))	/// Transform vertex from full to half resolution face iff the edge-code indicates such
 				);
 
-				// Assign the next index in the hardware vertex buffer to this iso vertex
-				_pMainVtxElems->indices[ivi] = _nVertexBufPos++;
-				_pMainVtxElems->vertexShipment.push_back(ivi);
+				shipIsoVertex(ivi);
 				OHT_ISB_DBGTRACE("MarshalTransition " << ivi << " to HWIdx " << (_nHWBufPos - 1) << ", position=" << _pMainVtxElems->positions[ivi]);
 			}
 		);
@@ -1022,72 +2273,522 @@ namespace Ogre
 		if (_pMainVtxElems->trmappings[index] != IsoVertexIndex(~0))
 			return;
 
-		Vector3 & n = _pMainVtxElems->normals[index];
-		n.normalise();
+		IsoVertexElements::Attributes & attrs = _pMainVtxElems->attributes(index);
+		Vector3 & n = attrs.normal;
+		n.normalise();
+
+		const Matrix3 matProj (
+			1 - Math::Sqr(n.x),				-n.x*n.y,		-n.x*n.z,
+			-n.x*n.y,				1 - Math::Sqr(n.y),		-n.y*n.z,
+			-n.x*n.z,						-n.y*n.z,		1 - Math::Sqr(n.z)
+		);
+		const IsoFixVec3 & dv = _pCurrentChannelParams->_txTCHalf2Full[_nLOD].side[t3ds];
+
+		attrs.position += IsoFixVec3(matProj * Vector3(-dv)) + dv;
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::configureIsoVertex( IsoVertexElements * pVtxElems, const CubeDataRegion * pDataGrid, const_DataAccessor & data, const IsoVertexIndex nIsoVertexIdx, const IsoFixVec3::PrecisionType t, const VoxelIndex corner0, const VoxelIndex corner1, const IsoFixVec3 & dv /*= IsoFixVec3(signed short(0),signed short(0),signed short(0)) */, const Vector3 * pGradients /*= NULL*/ )
+	{
+		IsoVertexElements::Attributes & attrs = pVtxElems->touch(nIsoVertexIdx);
+
+		// Calculate the iso vertex position by interpolation
+		const IsoFixVec3* vertices = pDataGrid->getVertices();
+		attrs.position = vertices[corner0]*t + vertices[corner1]*(-t+signed short(1)) + dv;
+
+		if (_nSurfaceFlags & IsoVertexElements::GEN_NORMALS)
+		{
+			// Generate optional normal
+			switch (_pCurrentChannelParams->normalsType)
+			{
+			case NT_WeightedAverage:
+			case NT_Average:
+				attrs.normal = Vector3::ZERO;
+				break;
+
+			case NT_Gradient:
+				{
+					const IsoFixVec3 
+						g0(static_cast< const_DataAccessor::GradientField::VectorType > (data.gradients[corner0])),
+						g1(static_cast< const_DataAccessor::GradientField::VectorType > (data.gradients[corner1]));
+
+					if (_pCurrentChannelParams->flipNormals)
+						attrs.normal = (g0 - g1)*t - g0;
+					else
+						attrs.normal = g0 + (g1 - g0)*t;
+
+					attrs.normal.normalise();
+				}
+				break;
+
+			case NT_CentralDifference:
+				{
+					Vector3 gradients[2];
+
+					if (pGradients == NULL)
+					{
+						const VoxelIndex corners[2] = { corner0, corner1 };
+
+						computeCentralDifferences(data.values, corners, 2, gradients);
+						pGradients = gradients;
+					}
+
+					const Real fT = t;
+					const Vector3 
+						& g0 = pGradients[0],
+						& g1 = pGradients[1];
+
+					if (_pCurrentChannelParams->flipNormals)
+						attrs.normal = (g0 - g1)*fT - g0;
+					else
+						attrs.normal = g0 + (g1 - g0)*fT;
+
+					attrs.normal.normalise();
+				}
+				break;
+			}
+		}
+
+		if (_nSurfaceFlags & IsoVertexElements::GEN_VERTEX_COLOURS)
+		{
+			// Generate optional vertex colours by interpolation
+			const ColourValue 
+				c0 = data.colours[corner0],
+				c1 = data.colours[corner1];
+			attrs.colour = t*c0 + (-t+signed short(1))*c1;
+		}
+
+		if (_nSurfaceFlags & IsoVertexElements::GEN_TEX_COORDS)
+		{
+			// Generate optional texture coordinates
+			// TODO: Implementation
+
+			attrs.texcoord[0] = attrs.position.x;
+			attrs.texcoord[1] = attrs.position.y;
+			// TODO: I think this is wrong
+			//mIsoVertexTexCoords[isoVertex][2] = mIsoVertexPositions[isoVertex].z;
+		}
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::triangulateNets( const CubeDataRegion * pDataGrid, const_DataAccessor & data )
+	{
+		OgreAssert(_nLOD < _nets.lodCount(), "Level of detail exceeds lowest allowed");
+		oht_assert_threadmodel(ThrMdl_Single);
+
+		// Only averaged normals of iso-vertices already in the hardware buffer depend on the triangles surrounding them
+		const bool bPatchNormals = 
+			(_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) && 
+			_pCurrentChannelParams->averagedNormals() &&
+			!_dirtyVoxels.isNull();
+
+		GridCellCoords gcc(_nLOD);
+		IsoTriangle tri;
+		IsoVertexIndex quad[4];
+
+		// Ships an iso-vertex the first time it is used by this build, or patches it if its normal may have changed
+		auto claim = [&] (const IsoVertexIndex ivi, const CellRegion & region)
+		{
+			const HWVertexIndex hwvi = _pMainVtxElems->indices[ivi];
+
+			if (hwvi == HWVertexIndex(~0))
+				shipIsoVertex(ivi);
+			else if (bPatchNormals && region.intersects(_dirtyVoxels))
+				_pMainVtxElems->vertexRemaps.push_back(IsoVertexRemap(hwvi, ivi));
+		};
+
+		// Maps a cell to its iso-vertex, configuring it the first time it is used by this build
+		auto vertex = [&] (const unsigned nLOD, const SurfaceNets::Cell & cell) -> IsoVertexIndex
+		{
+			const IsoVertexIndex ivi = _pMainVtxElems->getNetVertexIndex(_nets.index(nLOD, cell));
+
+			if (!_pMainVtxElems->touched(ivi))
+			{
+				const SurfaceNets::Box box = _nets.box(nLOD, cell);
+
+				claim(ivi, CellRegion(box.x0, box.y0, box.z0, box.x1, box.y1, box.z1));
+
+				// Positions of iso-vertices already in the hardware buffer are still required for averaged normals
+				configureNetVertex(pDataGrid, data, ivi, box);
+			}
+
+			return ivi;
+		};
+
+		auto triangle = [&] (const IsoVertexIndex a, const IsoVertexIndex b, const IsoVertexIndex c)
+		{
+			tri.vertices[0] = a;
+			tri.vertices[1] = b;
+			tri.vertices[2] = c;
+#ifdef _OHT_LOG_TRACE
+			tri.id = _pMainVtxElems->triangles.size();
+#endif
+			addIsoTriangle(tri);
+		};
+
+		// Sides facing a neighbour of the next finer level of detail are spanned by seams instead of the quads of the edges in them
+		bool bStitched[3][2], bSeams = false;
+		for (unsigned a = 0; a < 3; ++a)
+			for (unsigned h = 0; h < 2; ++h)
+				bSeams |= bStitched[a][h] = _nLOD > 0 && (_enStitches & OrthogonalNeighbor_to_Touch3DSide[AxisSides[a][h]]) != 0;
+
+		// Whether the cell is a virtual one beyond a stitched side
+		auto beyond = [&] (const signed short nCells, const SurfaceNets::Cell & cell) -> bool
+		{
+			const signed short coords[3] = { cell.x, cell.y, cell.z };
+
+			for (unsigned a = 0; a < 3; ++a)
+				if ((coords[a] < 0 && bStitched[a][0]) || (coords[a] >= nCells && bStitched[a][1]))
+					return true;
+
+			return false;
+		};
+
+		const signed short nCells = static_cast< signed short > (_cubemeta.dimensions >> _nLOD);
+
+		for (RegularTriangulationCaseList::const_iterator i = _pMeshOp->resolution->regCases.begin(); i != _pMeshOp->resolution->regCases.end(); ++i)
+		{
+			_cubemeta.computeGridCell(gcc, i->cell);
+
+			_nets.quads(data.values, _nLOD, gcc.i, gcc.j, gcc.k, [&] (const SurfaceNets::Cell (& cells)[4])
+			{
+				if (bSeams && (beyond(nCells, cells[0]) || beyond(nCells, cells[1]) || beyond(nCells, cells[2]) || beyond(nCells, cells[3])))
+					return;
+
+				for (unsigned c = 0; c < 4; ++c)
+					quad[c] = vertex(_nLOD, cells[c]);
+
+				triangle(quad[0], quad[1], quad[2]);
+				triangle(quad[0], quad[2], quad[3]);
+			});
+		}
+
+		if (!bSeams)
+			return;
+
+		const unsigned nFine = _nLOD - 1;
+		const bool bFineNets = _pCurrentChannelParams->surfaceNets(nFine);
+		const signed short nFineCells = static_cast< signed short > (_cubemeta.dimensions >> nFine);
+		const DimensionType 
+			d = _cubemeta.dimensions,
+			sf = DimensionType(1 << nFine);
+
+		auto inside = [&] (const DimensionType (& p)[3]) -> bool
+		{
+			return data.values[_cubemeta.getGridPointIndex(p[0], p[1], p[2])] < 0;
+		};
+
+		// Maps an edge of the finer level of detail to the regular iso-vertex where the surface crosses it, refined exactly as Transvoxel 
+		// refines it for the neighbour
+		auto crossing = [&] (const DimensionType (& p)[3], const unsigned e) -> IsoVertexIndex
+		{
+			// Edge codes of regular iso-vertices on edges along the x, y and z axes respectively
+			static const unsigned char EdgeCodes[3] = { 2, 1, 3 };
+			DimensionType o[3];
+			unsigned char k0 = 0;
+
+			// Edges on the far sides of the cube are on the far sides of the last cells
+			for (unsigned i = 0; i < 3; ++i)
+			{
+				o[i] = std::min(p[i], DimensionType(d - sf));
+				k0 |= unsigned char(p[i] > o[i] ? 1 : 0) << i;
+			}
+
+			const GridCell gc (_cubemeta, nFine, o[0], o[1], o[2]);
+
+			_rgrefiner.compute(nFine, gc.corners, data, k0, unsigned char(k0 | (1 << e)));
+
+			const IsoVertexIndex ivi = _pMainVtxElems->getRegularVertexIndex(unsigned char(EdgeCodes[e] & ~_rgrefiner.getZeroValueFlag()), _rgrefiner.getCoords());
+
+			if (!_pMainVtxElems->touched(ivi))
+			{
+				const VoxelIndex 
+					c0 = _rgrefiner.getGridIndex0(),
+					c1 = _rgrefiner.getGridIndex1();
+
+				claim(ivi, CellRegion(p[0], p[1], p[2], p[0] + (e == 0 ? sf : 0), p[1] + (e == 1 ? sf : 0), p[2] + (e == 2 ? sf : 0)));
+				configureIsoVertex(_pMainVtxElems, pDataGrid, data, ivi, computeIsoVertexPosition(data.values, c0, c1), c0, c1);
+			}
+
+			return ivi;
+		};
+
+		for (unsigned a = 0; a < 3; ++a)
+			for (unsigned h = 0; h < 2; ++h)
+			{
+				if (!bStitched[a][h])
+					continue;
+
+				_nets.seam(data.values, nFine, a, h != 0, [&] (const SurfaceNets::Cell (& cells)[4], const DimensionType (& p)[3], const unsigned e, const bool bInside0)
+				{
+					auto virt = [&] (const SurfaceNets::Cell & cell) -> bool
+					{
+						const signed short q = a == 0 ? cell.x : (a == 1 ? cell.y : cell.z);
+						return h == 0 ? q < 0 : q >= nFineCells;
+					};
+
+					// Rotate the quad so that it starts at the cell inside the cube that is followed by the two virtual cells beyond the side
+					unsigned r = 0;
+					while (virt(cells[r]) || !virt(cells[(r + 1) & 3]))
+						++r;
+
+					const SurfaceNets::Cell 
+						& va = cells[(r + 1) & 3],
+						& vb = cells[(r + 2) & 3];
+					const IsoVertexIndex
+						iviA = vertex(_nLOD, _nets.coarsen(nFine, cells[r])),
+						iviB = vertex(_nLOD, _nets.coarsen(nFine, cells[(r + 3) & 3]));
+
+					if (bFineNets)
+					{
+						// The neighbour spans the edge with the same virtual cells, collapsed onto the side, when both cells inside the
+						// cube are part of the same coarser cell the quad folds into a triangle
+						const IsoVertexIndex
+							iviVA = vertex(nFine, va),
+							iviVB = vertex(nFine, vb);
+
+						triangle(iviA, iviVA, iviVB);
+						triangle(iviA, iviVB, iviB);
+						return;
+					}
+
+					// The neighbour's surface meets the side along segments joining the crossings of the edges in it
+					const IsoVertexIndex ivi = crossing(p, e);
+
+					triangle(iviA, ivi, iviB);
+
+					// The square of the side under the second virtual cell, unless it is beyond the rim of the side
+					const unsigned o = 3 - a - e;
+					const signed short sq = o == 0 ? vb.x : (o == 1 ? vb.y : vb.z);
+
+					if (sq < 0 || sq >= nFineCells)
+						return;
+
+					// Near ends of the other three edges of the square, the two across the edge along the other axis and the opposite one
+					const DimensionType lo = DimensionType(sq) * sf;
+					DimensionType others[3][3];
+					unsigned axes[3], nCrossed = 0, j = 0;
+
+					for (unsigned k = 0; k < 3; ++k)
+					{
+						for (unsigned i = 0; i < 3; ++i)
+							others[k][i] = p[i];
+
+						if (k < 2)
+						{
+							others[k][e] += DimensionType(k * sf);
+							others[k][o] = lo;
+							axes[k] = o;
+						} else
+						{
+							others[k][o] = p[o] == lo ? lo + sf : lo;
+							axes[k] = e;
+						}
 
-		const Matrix3 matProj (
-			1 - Math::Sqr(n.x),				-n.x*n.y,		-n.x*n.z,
-			-n.x*n.y,				1 - Math::Sqr(n.y),		-n.y*n.z,
-			-n.x*n.z,						-n.y*n.z,		1 - Math::Sqr(n.z)
-		);
-		const IsoFixVec3 & dv = _pCurrentChannelParams->_txTCHalf2Full[_nLOD].side[t3ds];
+						DimensionType end[3] = { others[k][0], others[k][1], others[k][2] };
+						end[axes[k]] += sf;
+						if (inside(others[k]) != inside(end))
+						{
+							++nCrossed;
+							j = k;
+						}
+					}
+
+					// The neighbour's segments in a square crossed on all four edges cut off the corners inside, so the crossing joined to 
+					// this one is on the other edge at the inside end of this edge
+					if (nCrossed == 3)
+						j = bInside0 ? 0 : 1;
 
-		_pMainVtxElems->positions[index] += IsoFixVec3(matProj * Vector3(-dv)) + dv;
+					OgreAssert(nCrossed == 1 || nCrossed == 3, "Surface crosses a square an odd number of times");
+					triangle(iviB, ivi, crossing(others[j], axes[j]));
+				});
+			}
 	}
 
 #ifdef _DEBUG
 	#pragma optimize("gtpy", on)
 #endif
-	void IsoSurfaceBuilder::configureIsoVertex( IsoVertexElements * pVtxElems, const CubeDataRegion * pDataGrid, const_DataAccessor & data, const IsoVertexIndex nIsoVertexIdx, const IsoFixVec3::PrecisionType t, const VoxelIndex corner0, const VoxelIndex corner1, const IsoFixVec3 & dv /*= IsoFixVec3(signed short(0),signed short(0),signed short(0)) */ )
+	void IsoSurfaceBuilder::configureNetVertex( const CubeDataRegion * pDataGrid, const_DataAccessor & data, const IsoVertexIndex nIsoVertexIdx, const SurfaceNets::Box & box )
 	{
-		// Calculate the iso vertex position by interpolation
+		IsoVertexElements::Attributes & attrs = _pMainVtxElems->touch(nIsoVertexIdx);
 		const IsoFixVec3* vertices = pDataGrid->getVertices();
-		pVtxElems->positions[nIsoVertexIdx] = vertices[corner0]*t + vertices[corner1]*(-t+signed short(1)) + dv;
+		const bool 
+			bNormals = (_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) != 0,
+			bCentralDifferences = bNormals && _pCurrentChannelParams->normalsType == NT_CentralDifference,
+			bGradient = bNormals && (_pCurrentChannelParams->normalsType == NT_Gradient || bCentralDifferences),
+			bColours = (_nSurfaceFlags & IsoVertexElements::GEN_VERTEX_COLOURS) != 0;
+
+		// Voxel pairs of the crossings, a cell has twelve edges and forty-eight edges half as long on its surface
+		VoxelIndex corners[48 * 2];
+		Vector3 gradients[48 * 2];
+		size_t nCount = 0;
+
+		auto collect = [&] (const VoxelIndex corner0, const VoxelIndex corner1)
+		{
+			corners[nCount * 2 + 0] = corner0;
+			corners[nCount * 2 + 1] = corner1;
+			++nCount;
+		};
 
-		if (_nSurfaceFlags & IsoVertexElements::GEN_NORMALS)
+		_nets.crossings(data.values, box, collect);
+
+		// Seams may use a cell that the surface only crosses at the next finer level of detail, then the finer crossings on its surface are averaged
+		if (nCount == 0)
 		{
-			// Generate optional normal
-			switch (_pCurrentChannelParams->normalsType)
-			{
-			case NT_WeightedAverage:
-			case NT_Average:
-				pVtxElems->normals[nIsoVertexIdx] = Vector3::ZERO;
-				break;
+			const DimensionType nSpan = std::max(std::max(box.x1 - box.x0, box.y1 - box.y0), box.z1 - box.z0);
 
-			case NT_Gradient:
-				{
-					const IsoFixVec3 
-						g0(static_cast< const_DataAccessor::GradientField::VectorType > (data.gradients[corner0])),
-						g1(static_cast< const_DataAccessor::GradientField::VectorType > (data.gradients[corner1]));
+			if (nSpan > 1)
+				_nets.crossings(data.values, box, collect, DimensionType(nSpan >> 1));
+		}
 
-					if (_pCurrentChannelParams->flipNormals)
-						pVtxElems->normals[nIsoVertexIdx] = (g0 - g1)*t - g0;
-					else
-						pVtxElems->normals[nIsoVertexIdx] = g0 + (g1 - g0)*t;
+		OgreAssert(nCount > 0, "Surface Nets cell vertex without any crossings");
 
-					pVtxElems->normals[nIsoVertexIdx].normalise();
-				}
+		if (bCentralDifferences)
+			computeCentralDifferences(data.values, corners, nCount * 2, gradients);
+
+		// Accumulate in floating-point, the sum of several fixed-point positions may exceed its range
+		Vector3 position = Vector3::ZERO, normal = Vector3::ZERO;
+		ColourValue colour = ColourValue::ZERO;
+
+		for (size_t c = 0; c < nCount; ++c)
+		{
+			const VoxelIndex 
+				corner0 = corners[c * 2 + 0],
+				corner1 = corners[c * 2 + 1];
+			const IsoFixVec3::PrecisionType t = computeIsoVertexPosition(data.values, corner0, corner1);
+			const Vector3 crossing = vertices[corner0]*t + vertices[corner1]*(-t+signed short(1));
+
+			position += crossing;
+
+			if (bCentralDifferences)
+			{
+				const Real fT = t;
+				const Vector3 
+					& g0 = gradients[c * 2 + 0],
+					& g1 = gradients[c * 2 + 1];
+
+				normal += _pCurrentChannelParams->flipNormals ? (g0 - g1)*fT - g0 : g0 + (g1 - g0)*fT;
+			} 
+			else if (bGradient)
+			{
+				const IsoFixVec3 
+					g0(static_cast< const_DataAccessor::GradientField::VectorType > (data.gradients[corner0])),
+					g1(static_cast< const_DataAccessor::GradientField::VectorType > (data.gradients[corner1]));
+				const Vector3 g = _pCurrentChannelParams->flipNormals ? (g0 - g1)*t - g0 : g0 + (g1 - g0)*t;
+
+				normal += g;
+			}
+
+			if (bColours)
+			{
+				const ColourValue 
+					c0 = data.colours[corner0],
+					c1 = data.colours[corner1];
+				colour += t*c0 + (-t+signed short(1))*c1;
 			}
 		}
 
-		if (_nSurfaceFlags & IsoVertexElements::GEN_VERTEX_COLOURS)
+		const Real fInvCount = Real(1) / Real(nCount);
+
+		position *= fInvCount;
+		attrs.position = IsoFixVec3(position);
+
+		if (bNormals)
 		{
-			// Generate optional vertex colours by interpolation
-			const ColourValue 
-				c0 = data.colours[corner0],
-				c1 = data.colours[corner1];
-			pVtxElems->colours[nIsoVertexIdx] = t*c0 + (-t+signed short(1))*c1;
+			// Averaged normals are accumulated from the surrounding triangles
+			attrs.normal = normal;
+			if (bGradient)
+				attrs.normal.normalise();
 		}
 
+		if (bColours)
+			attrs.colour = colour * fInvCount;
+
 		if (_nSurfaceFlags & IsoVertexElements::GEN_TEX_COORDS)
 		{
-			// Generate optional texture coordinates
-			// TODO: Implementation
+			attrs.texcoord[0] = attrs.position.x;
+			attrs.texcoord[1] = attrs.position.y;
+		}
+	}
 
-			pVtxElems->texcoords[nIsoVertexIdx][0] = pVtxElems->positions[nIsoVertexIdx].x;
-			pVtxElems->texcoords[nIsoVertexIdx][1] = pVtxElems->positions[nIsoVertexIdx].y;
-			// TODO: I think this is wrong
-			//mIsoVertexTexCoords[isoVertex][2] = mIsoVertexPositions[isoVertex].z;
+	const OrthogonalNeighbor IsoSurfaceBuilder::AxisSides[3][2] =
+	{
+		{ OrthoN_WEST, OrthoN_EAST },
+		{ OrthoN_BELOW, OrthoN_ABOVE },
+		{ OrthoN_NORTH, OrthoN_SOUTH }
+	};
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::computeCentralDifferences( const FieldStrength * pValues, const VoxelIndex * pCorners, const size_t nCount, Vector3 * pGradients ) const
+	{
+		const DimensionType d = _cubemeta.dimensions;
+		const size_t strides[3] = { 1, size_t(d) + 1, (size_t(d) + 1)*(size_t(d) + 1) };
+		GridPointCoords gp;
+
+		// Samples either side of each voxel along each axis and the factor compensating for one-sided differences, four voxels at a time
+		signed int left[3][4], right[3][4];
+		float scale[3][4], diff[3][4];
+
+		for (size_t i = 0; i < nCount; i += 4)
+		{
+			const size_t nBatch = std::min(nCount - i, size_t(4));
+
+			for (size_t b = 0; b < 4; ++b)
+			{
+				// Pad the last batch with the last voxel
+				const VoxelIndex corner = pCorners[i + std::min(b, nBatch - 1)];
+
+				_cubemeta.computeGridPoint(gp, corner);
+				const DimensionType coords[3] = { gp.i, gp.j, gp.k };
+
+				for (unsigned a = 0; a < 3; ++a)
+				{
+					const OrthogonalNeighbor
+						enLow = AxisSides[a][0],
+						enHigh = AxisSides[a][1];
+					const bool 
+						bLow = coords[a] > 0,
+						bHigh = coords[a] < d;
+					// Index of the voxel in the halo of either side along this axis
+					const size_t nHalo = a == 2 
+						? size_t(coords[1]) * (size_t(d) + 1) + coords[0]
+						: size_t(coords[2]) * (size_t(d) + 1) + coords[a == 0 ? 1 : 0];
+
+					// Both cubes sharing a side sample the same voxels either side of it so their differences agree
+					left[a][b] = bLow ? pValues[corner - strides[a]] : (_bHalo[enLow] ? _vHalo[enLow][nHalo] : pValues[corner]);
+					right[a][b] = bHigh ? pValues[corner + strides[a]] : (_bHalo[enHigh] ? _vHalo[enHigh][nHalo] : pValues[corner]);
+					scale[a][b] = (bLow || _bHalo[enLow]) && (bHigh || _bHalo[enHigh]) ? 1.0f : 2.0f;
+				}
+			}
+
+			for (unsigned a = 0; a < 3; ++a)
+			{
+#if defined(OHT_SIMD_SSE2) || defined(OHT_SIMD_AVX2)
+				_mm_storeu_ps(diff[a], 
+					_mm_mul_ps(
+						_mm_cvtepi32_ps(
+							_mm_sub_epi32(
+								_mm_loadu_si128(reinterpret_cast< const __m128i * > (left[a])), 
+								_mm_loadu_si128(reinterpret_cast< const __m128i * > (right[a]))
+							)
+						), 
+						_mm_loadu_ps(scale[a])
+					)
+				);
+#else
+				for (size_t b = 0; b < 4; ++b)
+					diff[a][b] = float(left[a][b] - right[a][b]) * scale[a][b];
+#endif
+			}
+
+			for (size_t b = 0; b < nBatch; ++b)
+				pGradients[i + b] = Vector3(diff[0][b], diff[1][b], diff[2][b]);
 		}
 	}
 
@@ -1102,7 +2803,7 @@ namespace Ogre
 		)
 			return;
 
-		if ((_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) && (_pCurrentChannelParams->normalsType != NT_Gradient))
+		if ((_nSurfaceFlags & IsoVertexElements::GEN_NORMALS) && _pCurrentChannelParams->averagedNormals())
 		{
 			IsoFixVec3 normal = 
 				(_pMainVtxElems->positions[isoTriangle.vertices[1]] - _pMainVtxElems->positions[isoTriangle.vertices[0]]) 
@@ -1121,9 +2822,9 @@ namespace Ogre
 				break;
 			}
 
-			_pMainVtxElems->normals[isoTriangle.vertices[0]] += normal;
-			_pMainVtxElems->normals[isoTriangle.vertices[1]] += normal;
-			_pMainVtxElems->normals[isoTriangle.vertices[2]] += normal;
+			_pMainVtxElems->attributes(isoTriangle.vertices[0]).normal += normal;
+			_pMainVtxElems->attributes(isoTriangle.vertices[1]).normal += normal;
+			_pMainVtxElems->attributes(isoTriangle.vertices[2]).normal += normal;
 		}
 
 		_pMainVtxElems->triangles.push_back(isoTriangle);
@@ -1142,14 +2843,14 @@ namespace Ogre
 #ifdef _DEBUG
 	#pragma optimize("gtpy", on)
 #endif
-	void IsoSurfaceBuilder::computeRefinedRegularIsoVertex( const GridCell & gc, const_DataAccessor & data, const VRECaCC & vrecacc, unsigned char & ei, VoxelIndex & ci0, VoxelIndex & ci1, const unsigned nLOD, IsoVertexIndex & ivi, GridPointCoords & gpc )
+	void IsoSurfaceBuilder::computeRefinedRegularIsoVertex( IsoVertexIndexRefiner< GridCell::CornerLocator, GridPointCoords > & refiner, const GridCell & gc, const_DataAccessor & data, const VRECaCC & vrecacc, unsigned char & ei, VoxelIndex & ci0, VoxelIndex & ci1, const unsigned nLOD, IsoVertexIndex & ivi, GridPointCoords & gpc )
 	{
-		_rgrefiner.compute(nLOD, gc.corners, data, vrecacc.getCorner0(), vrecacc.getCorner1());
-		gpc = _rgrefiner.getCoords();
-		ei = vrecacc.getEdgeCode() & ~_rgrefiner.getZeroValueFlag();
+		refiner.compute(nLOD, gc.corners, data, vrecacc.getCorner0(), vrecacc.getCorner1());
+		gpc = refiner.getCoords();
+		ei = vrecacc.getEdgeCode() & ~refiner.getZeroValueFlag();
 		ivi = _pMainVtxElems->getRegularVertexIndex(ei, gpc);
-		ci0 = _rgrefiner.getGridIndex0();
-		ci1 = _rgrefiner.getGridIndex1();
+		ci0 = refiner.getGridIndex0();
+		ci1 = refiner.getGridIndex1();
 
 		OHT_ISB_DBGTRACE("Refining Regular: VRECaCC=" << vrecacc << ", GC=" << gc << ": ivi=" << ivi << ", resolved EI=" << (int)ei << ", coords pair=<" << ci0 << "x" << ci1 << ">");
 	}
@@ -1215,6 +2916,29 @@ namespace Ogre
 #endif
 	void IsoSurfaceBuilder::computeRegularRefinements( const_DataAccessor & data )
 	{
+		if (_nSlabs > 1)
+		{
+			const RegularTriangulationCaseList & regCases = _pMeshOp->resolution->regCases;
+
+			NonTrivialRegularCase bound;
+
+			// Regular cases are sorted by cell index, which orders them along Z first
+			for (size_t s = 0; s < _nSlabs; ++s)
+			{
+				bound.cell = _cubemeta.getGridCellIndex(0, 0, _vpSlabs[s]->z0);
+				_vpSlabs[s]->begin = std::lower_bound(regCases.begin(), regCases.end(), bound, 
+					[] (const NonTrivialRegularCase & a, const NonTrivialRegularCase & b) { return a.cell < b.cell; });
+			}
+			for (size_t s = 0; s < _nSlabs; ++s)
+				_vpSlabs[s]->end = s + 1 < _nSlabs ? _vpSlabs[s + 1]->begin : regCases.end();
+
+			forEachSlab([&] (const size_t s)
+			{
+				computeRegularRefinements(data, *_vpSlabs[s]);
+			});
+			return;
+		}
+
 		GridCell gc(_cubemeta, _nLOD);
 
 		walkCellVertices
@@ -1228,6 +2952,40 @@ namespace Ogre
 		);
 	}
 
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	void IsoSurfaceBuilder::computeRegularRefinements( const_DataAccessor & data, Slab & slab )
+	{
+		GridCell gc(_cubemeta, _nLOD);
+		VoxelIndex c0, c1;
+		GridPointCoords gpc;
+		unsigned char ei;
+		IsoVertexIndex ivi;
+
+		walkCellVertices
+		(
+			slab.begin, slab.end, 
+			gc, 
+			[&] (const GridCell & gc, const unsigned short nVRECaCC, const unsigned nLOD)
+			{
+				const VRECaCC vrecacc(nVRECaCC);
+
+				// Edges along the bottom face of the slab are also edges of cells in the slab beneath, which owns them
+				if (slab.z0 > 0 && gc.z == slab.z0 && ((vrecacc.getCorner0() | vrecacc.getCorner1()) & 0x4) == 0)
+					return;
+
+				const IsoVertexIndex coarse = _pMainVtxElems->getRegularVertexIndex(gc, vrecacc, _nLOD);
+
+				if (_pMainVtxElems->refinements[coarse] == IsoVertexIndex(~0))
+				{
+					computeRefinedRegularIsoVertex(slab.rgrefiner, gc, data, vrecacc, ei, c0, c1, _nLOD, ivi, gpc);
+					_pMainVtxElems->refinements.set(coarse, ivi);
+				}
+			}
+		);
+	}
+
 #ifdef _DEBUG
 	#pragma optimize("gtpy", on)
 #endif
@@ -1320,7 +3078,102 @@ namespace Ogre
 		return s >= 0 && t >= 0 && s+t <= 1.0f;
 	}
 
-	void IsoSurfaceBuilder::fillShadowQueues( HardwareIsoVertexShadow::ProducerQueueAccess & queue, const Real fVertScale )
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	bool IsoSurfaceBuilder::findTrilinearRoot( const Real afCorners[8], const Vector3 & u0, const Vector3 & u1, const Real fResolution, Real & fRoot )
+	{
+		// The cubic is sampled at four equidistant points along the segment and expanded from forward differences in y = [0, 3]
+		const Vector3 du = (u1 - u0) / 3;
+		const Real
+			f0 = interpolateTrilinear(afCorners, u0),
+			f1 = interpolateTrilinear(afCorners, u0 + du),
+			f2 = interpolateTrilinear(afCorners, u0 + du * 2),
+			f3 = interpolateTrilinear(afCorners, u1),
+
+			d1 = f1 - f0,
+			d2 = f2 - 2 * f1 + f0,
+			d3 = f3 - 3 * f2 + 3 * f1 - f0,
+
+			c0 = f0,
+			c1 = d1 - d2 / 2 + d3 / 3,
+			c2 = (d2 - d3) / 2,
+			c3 = d3 / 6;
+
+		auto cubic = [&] (const Real y) -> Real { return ((c3 * y + c2) * y + c1) * y + c0; };
+
+		// Split the segment into monotonic pieces at the extrema of the cubic
+		const Real 
+			a = 3 * c3, 
+			b = 2 * c2, 
+			epsilon = std::numeric_limits< Real >::epsilon();
+		Real afSplits[4];
+		size_t nSplits = 0;
+
+		afSplits[nSplits++] = 0;
+		if (Math::Abs(a) > epsilon)
+		{
+			const Real disc = b*b - 4*a*c1;
+
+			if (disc > 0)
+			{
+				const Real 
+					sq = Math::Sqrt(disc),
+					ya = (-b - sq) / (2 * a),
+					yb = (-b + sq) / (2 * a);
+
+				if (std::min(ya, yb) > 0 && std::min(ya, yb) < 3)
+					afSplits[nSplits++] = std::min(ya, yb);
+				if (std::max(ya, yb) > 0 && std::max(ya, yb) < 3)
+					afSplits[nSplits++] = std::max(ya, yb);
+			}
+		} else if (Math::Abs(b) > epsilon)
+		{
+			const Real y = -c1 / b;
+
+			if (y > 0 && y < 3)
+				afSplits[nSplits++] = y;
+		}
+		afSplits[nSplits++] = 3;
+
+		for (size_t i = 1; i < nSplits; ++i)
+		{
+			Real 
+				ya = afSplits[i - 1], 
+				yb = afSplits[i],
+				fa = cubic(ya),
+				fb = cubic(yb);
+			const bool bInside = fa < 0;
+
+			if (bInside == (fb < 0))
+				continue;
+
+			// The piece is monotonic so bisection converges on its only root, the bracket is measured in thirds of the segment
+			for (unsigned n = 0; n < 32 && yb - ya > fResolution * 3; ++n)
+			{
+				const Real 
+					ym = (ya + yb) / 2,
+					fm = cubic(ym);
+
+				if ((fm < 0) == bInside)
+				{
+					ya = ym;
+					fa = fm;
+				} else
+				{
+					yb = ym;
+					fb = fm;
+				}
+			}
+
+			fRoot = (ya + (yb - ya) * fa / (fa - fb)) / 3;
+			return true;
+		}
+
+		return false;
+	}
+
+	void IsoSurfaceBuilder::fillShadowQueues( HardwareIsoVertexShadow::ProducerQueueAccess & queue, BuilderQueue::IndexRange & indexRange, const MetaVoxelFactory * pFactory, const Real fVertScale )
 	{
 		oht_assert_threadmodel(ThrMdl_Background);
 
@@ -1329,48 +3182,136 @@ namespace Ogre
 		if (_bResetIndexBuffer)
 			++queue.resetIndexBuffer;
 
-		for (IsoVertexVector::const_iterator i = _pMainVtxElems->vertexShipment.begin(); i != _pMainVtxElems->vertexShipment.end(); ++i)
+		stageBuffers(queue.staging, indexRange, pFactory, fVertScale);
+
+		// Appended, sibling configurations of a batch follow the primary one
+		queue.revmapIVI2HWVIQueue.insert(queue.revmapIVI2HWVIQueue.end(), _pMainVtxElems->vertexShipment.begin(), _pMainVtxElems->vertexShipment.end());
+		_pMainVtxElems->vertexShipment.clear();
+		queue.remapHWVI2IVIQueue.insert(queue.remapHWVI2IVIQueue.end(), _pMainVtxElems->vertexRemaps.begin(), _pMainVtxElems->vertexRemaps.end());
+		_pMainVtxElems->vertexRemaps.clear();
+	}
+
+	void IsoSurfaceBuilder::stageBuffers( StagingArena & staging, BuilderQueue::IndexRange & indexRange, const MetaVoxelFactory * pFactory, const Real fVertScale )
+	{
+		const MetaVoxelFactory::VertexDeclarationElements * pVtxDeclElems = pFactory->getVertexDeclarationElements();
+
+		auto stageVertex = [&] (unsigned char * pOffset, const IsoVertexIndex ivi)
 		{
-			BuilderQueue::VertexElement vtxelem;
+			Real * pReal;
 
-			const IsoFixVec3 & pt = _pMainVtxElems->positions[*i];
+			const IsoFixVec3 & pt = _pMainVtxElems->positions[ivi];
+			pVtxDeclElems->position->baseVertexPointerToElement(pOffset, &pReal);
+			*pReal++ = Real(pt.x) * fVertScale;
+			*pReal++ = Real(pt.y) * fVertScale;
+			*pReal++ = Real(pt.z) * fVertScale;
 
-			vtxelem.position.x = Real(pt.x) * fVertScale;
-			vtxelem.position.y = Real(pt.y) * fVertScale;
-			vtxelem.position.z = Real(pt.z) * fVertScale;
+			if (pVtxDeclElems->normal != NULL)
+			{
+				const Vector3 & n = _pMainVtxElems->normals[ivi];
+				pVtxDeclElems->normal->baseVertexPointerToElement(pOffset, &pReal);
+				*pReal++ = n.x;
+				*pReal++ = n.y;
+				*pReal++ = n.z;
+			}
+			if (pVtxDeclElems->diffuse != NULL)
+			{
+				uint32 * uColour;
+				pVtxDeclElems->diffuse->baseVertexPointerToElement(pOffset, &uColour);
+				Root::getSingleton().convertColourValue(_pMainVtxElems->colours[ivi], uColour);
+			}
+			if (pVtxDeclElems->texcoords != NULL)
+			{
+				pVtxDeclElems->texcoords->baseVertexPointerToElement(pOffset, &pReal);
+				*pReal++ = _pMainVtxElems->texcoords[ivi][0];
+				*pReal++ = _pMainVtxElems->texcoords[ivi][1];
+			}
+		};
 
-			if (_nSurfaceFlags & IsoVertexElements::GEN_NORMALS)
-				vtxelem.normal = _pMainVtxElems->normals[*i];
+		auto stageCompactVertex = [&] (unsigned char * pOffset, const IsoVertexIndex ivi)
+		{
+			BuilderQueue::CompactVertexElement vtxelem;
+			int16 * pShort;
 
-			if (_nSurfaceFlags & IsoVertexElements::GEN_VERTEX_COLOURS)
-				vtxelem.setColour(_pMainVtxElems->colours[*i]);
+			// Positions of compact vertices are relative to the centre of the cube, the renderable scales them back
+			vtxelem.setPosition(_pMainVtxElems->positions[ivi], _cubemeta.dimensions);
+			pVtxDeclElems->position->baseVertexPointerToElement(pOffset, &pShort);
+			memcpy(pShort, vtxelem.position, sizeof(vtxelem.position));
 
-			if (_nSurfaceFlags & IsoVertexElements::GEN_TEX_COORDS)
+			if (pVtxDeclElems->normal != NULL)
+			{
+				vtxelem.setNormal(_pMainVtxElems->normals[ivi]);
+				pVtxDeclElems->normal->baseVertexPointerToElement(pOffset, &pShort);
+				memcpy(pShort, vtxelem.normal, sizeof(vtxelem.normal));
+			}
+			if (pVtxDeclElems->diffuse != NULL)
+			{
+				uint32 * uColour;
+				vtxelem.setColour(_pMainVtxElems->colours[ivi]);
+				pVtxDeclElems->diffuse->baseVertexPointerToElement(pOffset, &uColour);
+				*uColour = vtxelem.colour;
+			}
+			if (pVtxDeclElems->texcoords != NULL)
 			{
-				vtxelem.texcoord.x = _pMainVtxElems->texcoords[*i][0];
-				vtxelem.texcoord.y = _pMainVtxElems->texcoords[*i][1];
+				vtxelem.setTexCoord(_pMainVtxElems->texcoords[ivi][0], _pMainVtxElems->texcoords[ivi][1]);
+				pVtxDeclElems->texcoords->baseVertexPointerToElement(pOffset, &pShort);
+				memcpy(pShort, vtxelem.texcoord, sizeof(vtxelem.texcoord));
 			}
+		};
 
-			queue.vertexQueue.push_back(vtxelem);
+		const bool bCompact = (_nSurfaceFlags & IsoVertexElements::GEN_COMPACT) != 0;
+
+		if (!_pMainVtxElems->vertexShipment.empty())
+		{
+			unsigned char * pOffset = staging.vertices.append(_pMainVtxElems->vertexShipment.size() * staging.vertexSize);
+
+			for (IsoVertexVector::const_iterator i = _pMainVtxElems->vertexShipment.begin(); i != _pMainVtxElems->vertexShipment.end(); ++i, pOffset += staging.vertexSize)
+				if (bCompact)
+					stageCompactVertex(pOffset, *i);
+				else
+					stageVertex(pOffset, *i);
 		}
 
-		for (IsoTriangleVector::const_iterator i = _pMainVtxElems->triangles.begin(); i != _pMainVtxElems->triangles.end(); ++i)
+		// Hardware vertices rewritten in-place, stale ones that are merely unmapped have no vertex element
+		for (IsoVertexRemapVector::const_iterator i = _pMainVtxElems->vertexRemaps.begin(); i != _pMainVtxElems->vertexRemaps.end(); ++i)
+			if (i->ivi != IsoVertexIndex(~0))
+			{
+				if (bCompact)
+					stageCompactVertex(staging.patches.append(staging.vertexSize), i->ivi);
+				else
+					stageVertex(staging.patches.append(staging.vertexSize), i->ivi);
+			}
+
+		// Indices are staged in the width of the hardware index buffer of the channel
+		indexRange.offset = staging.indexCount();
+		indexRange.count = _pMainVtxElems->triangles.size() * 3;
+
+		if (indexRange.count > 0)
 		{
-			OgreAssert(
-				_pMainVtxElems->indices[i->vertices[0]] != HWVertexIndex(~0) &&
-				_pMainVtxElems->indices[i->vertices[1]] != HWVertexIndex(~0) &&
-				_pMainVtxElems->indices[i->vertices[2]] != HWVertexIndex(~0),
+			void * pIndices = staging.indices.append(indexRange.count * staging.indexSize);
+			const bool b32Bit = staging.indexSize == sizeof(uint32);
+			size_t n = 0;
 
-				"Iso-vertex to hardware vertex index not mapped"
-			);
+			for (IsoTriangleVector::const_iterator i = _pMainVtxElems->triangles.begin(); i != _pMainVtxElems->triangles.end(); ++i)
+			{
+				OgreAssert(
+					_pMainVtxElems->indices[i->vertices[0]] != HWVertexIndex(~0) &&
+					_pMainVtxElems->indices[i->vertices[1]] != HWVertexIndex(~0) &&
+					_pMainVtxElems->indices[i->vertices[2]] != HWVertexIndex(~0),
 
-			queue.indexQueue.push_back(_pMainVtxElems->indices[i->vertices[0]]);
-			queue.indexQueue.push_back(_pMainVtxElems->indices[i->vertices[1]]);
-			queue.indexQueue.push_back(_pMainVtxElems->indices[i->vertices[2]]);
-		}
+					"Iso-vertex to hardware vertex index not mapped"
+				);
 
-		queue.revmapIVI2HWVIQueue = _pMainVtxElems->vertexShipment;
-		_pMainVtxElems->vertexShipment.clear();
+				for (unsigned c = 0; c < 3; ++c, ++n)
+				{
+					const HWVertexIndex hwvi = _pMainVtxElems->indices[i->vertices[c]];
+
+					if (b32Bit)
+						static_cast< uint32 * > (pIndices)[n] = hwvi;
+					else
+						static_cast< uint16 * > (pIndices)[n] = static_cast< uint16 > (hwvi);
+				}
+			}
+		}
 	}
 
 	const IsoSurfaceBuilder::MainVertexElements::Shift3D
@@ -1623,7 +3564,7 @@ namespace Ogre
 		}
 	};
 
-	size_t IsoSurfaceBuilder::MainVertexElements::computeTotalElements( const CubeDataRegionDescriptor & dgtmpl )
+	size_t IsoSurfaceBuilder::MainVertexElements::computeTotalElements( const CubeDataRegionDescriptor & dgtmpl, const bool bSurfaceNets )
 	{
 		const size_t 
 			d = dgtmpl.dimensions,
@@ -1636,6 +3577,7 @@ namespace Ogre
 		return 
 			3*(d+1)*(d+1)*d +		// X/Y/Z axes
 			(d+1)*(d+1)*(d+1) +		// Corner points
+			(bSurfaceNets ? SurfaceNets::computeTotalElements(dgtmpl) : 0) +	// Surface Nets cell vertices of every LOD
 
 			oc*2*dh*dh2 +			// X/Y Half-resolution transition axes on each side sans edges and corners
 			m3c*dh +				// X/Y Half-resolution transition axes on each edge sans corners
@@ -1644,19 +3586,15 @@ namespace Ogre
 			mcc;					// Transition corner points on each side corner
 	}
 
-	IsoSurfaceBuilder::MainVertexElements::MainVertexElements( const CubeDataRegionDescriptor & dgtmpl )
-		: IsoVertexElements(computeTotalElements(dgtmpl)),
+	IsoSurfaceBuilder::MainVertexElements::MainVertexElements( const CubeDataRegionDescriptor & dgtmpl, const bool bWideIndices, const bool bSurfaceNets )
+		: IsoVertexElements(computeTotalElements(dgtmpl, bSurfaceNets), bWideIndices),
 			_cubemeta(dgtmpl), 
-			remappings(new IsoVertexIndex[computeTotalElements(dgtmpl)]),
-			trmappings(new IsoVertexIndex[computeTotalElements(dgtmpl)]),
-			refinements(new IsoVertexIndex[computeTotalElements(dgtmpl)]),
-			cellindices(new CellIndexPair[computeTotalElements(dgtmpl)]),
-			trackFullOutsides(computeTotalElements(dgtmpl))			
+			trackFullOutsides(computeTotalElements(dgtmpl, bSurfaceNets), false),
+			remappings(computeTotalElements(dgtmpl, bSurfaceNets), IsoVertexIndex(~0)),
+			trmappings(computeTotalElements(dgtmpl, bSurfaceNets), IsoVertexIndex(~0)),
+			refinements(computeTotalElements(dgtmpl, bSurfaceNets), IsoVertexIndex(~0)),
+			cellindices(new CellIndexPair[computeTotalElements(dgtmpl, bSurfaceNets)])
 	{
-		memset(remappings, ~0, sizeof(*remappings) * count);
-		memset(trmappings, ~0, sizeof(*trmappings) * count);
-		memset(refinements, ~0, sizeof(*refinements) * count);
-
 		const size_t 
 			d = dgtmpl.dimensions,
 			d2 = d - 1,
@@ -1809,6 +3747,11 @@ namespace Ogre
 			}
 		}
 
+		if (bSurfaceNets)
+			o = SurfaceNets::computeTotalElements(dgtmpl) + (_offsets.nets = o);
+		else
+			_offsets.nets = IsoVertexIndex(~0);
+
 		for (unsigned e = 0; e < 4; ++e)
 		{
 			const Shift3D & shift = _regeiivimx[e];
@@ -1849,14 +3792,30 @@ namespace Ogre
 			}
 		}
 
+		// Surface Nets cell vertices depend on the voxels of the box spanned by the pair
+		const SurfaceNets nets (_cubemeta);
+		SurfaceNets::Cell cell;
+		for (unsigned l = 0; bSurfaceNets && l < nets.lodCount(); ++l)
+		{
+			const signed short n = static_cast< signed short > (_cubemeta.dimensions >> l);
+
+			for (cell.z = -1; cell.z <= n; ++cell.z)
+				for (cell.y = -1; cell.y <= n; ++cell.y)
+					for (cell.x = -1; cell.x <= n; ++cell.x)
+					{
+						const SurfaceNets::Box box = nets.box(l, cell);
+						CellIndexPair & pair = cellindices[getNetVertexIndex(nets.index(l, cell))];
+
+						pair.corner0 = _cubemeta.getGridPointIndex(box.x0, box.y0, box.z0);
+						pair.corner1 = _cubemeta.getGridPointIndex(box.x1, box.y1, box.z1);
+					}
+		}
+
 		OgreAssert(o == count, "Count and offset computation mismatch");
 	}
 
 	IsoSurfaceBuilder::MainVertexElements::~MainVertexElements()
 	{
-		delete [] remappings;
-		delete [] trmappings;
-		delete [] refinements;
 		delete [] cellindices;
 
 		delete [] _offsets.transition[2];
@@ -1875,12 +3834,7 @@ namespace Ogre
 		IsoVertexElements::clear();
 		trackFullOutsides.clear();
 		// Refinements and mappings doesn't get cleared here, it's state must be preserved
-
-		// Must be zero, operations are additive
-		memset(normals, 0, sizeof(Vector3) * count);
-#ifdef _DEBUG
-		memset(positions, ~0, sizeof(Vector3) * count);
-#endif
+		// Normals need not be zeroed, attributes are zeroed when they're first touched after the clear
 	}
 #ifdef _DEBUG
 #pragma optimize("gtpy", on)
@@ -1888,9 +3842,9 @@ namespace Ogre
 	void IsoSurfaceBuilder::MainVertexElements::clear()
 	{
 		rollback();
-		memset(refinements, ~0, sizeof(*refinements) * count);
-		memset(remappings, ~0, sizeof(*remappings) * count);	// DEPS: restoreTransitionVertexMappings
-		memset(trmappings, ~0, sizeof(*trmappings) * count);	// DEPS: restoreTransitionVertexMappings
+		refinements.clear();
+		remappings.clear();	// DEPS: restoreTransitionVertexMappings
+		trmappings.clear();	// DEPS: restoreTransitionVertexMappings
 	}
 
 #ifdef _DEBUG
@@ -1989,16 +3943,15 @@ namespace Ogre
 #endif
 	void IsoSurfaceBuilder::TransitionTriangleBuilder::operator << ( const NonTrivialTransitionCase & caze )
 	{
-		const signed char cTranCellClass = transitionCellClass[caze.casecode];
-		const TransitionCellData & oCase = transitionCellData[cTranCellClass & 0x7F];	// High-bit must be cleared
+		// One record holds everything needed, the winding order of inverse cases is already reversed
+		const TransitionCaseData & oCase = getCaseData(caze);
 
 		_tc = caze.cell;
-		_winder << caze;
 		_vcount = oCase.GetTriangleCount() * 3;
 		_indices = oCase.vertexIndex;
 
-		const unsigned short * vVertices = getVertexData(caze);
-		const unsigned int nVertCount = getVertexCount(caze);
+		const unsigned short * vVertices = oCase.vertexData;
+		const unsigned int nVertCount = oCase.GetVertexCount();
 		IsoVertexIndex coarse, refined, mapped;
 
 		for (unsigned int c = 0; c < nVertCount; ++c)
@@ -2021,14 +3974,14 @@ namespace Ogre
 #endif
 	void IsoSurfaceBuilder::RegularTriangleBuilder::operator << ( const NonTrivialRegularCase & caze )
 	{
-		const RegularCellData & oCase = regularCellData[regularCellClass[caze.casecode]];
+		const RegularCaseData & oCase = getCaseData(caze);
 
 		_gc = caze.cell;
 		_indices = oCase.vertexIndex;
 		_vcount = oCase.GetTriangleCount() * 3;
 
-		const unsigned short * vVerticies = getVertexData(caze);
-		const unsigned int nVertCount = getVertexCount(caze);
+		const unsigned short * vVerticies = oCase.vertexData;
+		const unsigned int nVertCount = oCase.GetVertexCount();
 		IsoVertexIndex coarse, refined, mapped;
 
 		for (unsigned int c = 0; c < nVertCount; ++c)
@@ -2182,6 +4135,187 @@ namespace Ogre
 		return *this;
 	}
 
+	IsoSurfaceBuilder::RegularCaseRowCompiler::RegularCaseRowCompiler( const Voxel::CubeDataRegionDescriptor & cdrd )
+		: _cdrd(cdrd)
+	{
+		OgreAssert(cdrd.coordsIndexTx.mx == 1, "Expected voxels to be contiguous along the x-axis");
+		OgreAssert(cdrd.dimensions <= Voxel::MAX_DIM, "Rows of cells are longer than the row buffers");
+	}
+
+	size_t IsoSurfaceBuilder::RegularCaseRowCompiler::compile( const FieldStrength * values, const DimensionType y, const DimensionType z, const unsigned short nLOD )
+	{
+		const size_t nCells = _cdrd.dimensions >> nLOD;
+		const FieldStrength * vRows[4];
+
+		// Rows of voxels at (y, z), (y + 1, z), (y, z + 1), and (y + 1, z + 1) in cell-space
+		for (unsigned r = 0; r < 4; ++r)
+			vRows[r] = values + _cdrd.getGridPointIndex(0, y + ((r & 1) << nLOD), z + ((r >> 1) << nLOD));
+
+		// Every 2^LOD'th voxel is a cell corner, gather them so that the kernel sees contiguous rows
+		if (nLOD > 0)
+		{
+			for (unsigned r = 0; r < 4; ++r)
+			{
+				for (size_t x = 0; x <= nCells; ++x)
+					_vSamples[r][x] = vRows[r][x << nLOD];
+
+				vRows[r] = _vSamples[r];
+			}
+		}
+
+		return compile(vRows[0], vRows[1], vRows[2], vRows[3], nCells, casecodes, nontrivials);
+	}
+
+#ifdef _DEBUG
+	#pragma optimize("gtpy", on)
+#endif
+	size_t IsoSurfaceBuilder::RegularCaseRowCompiler::compile( 
+		const FieldStrength * r00, 
+		const FieldStrength * r10, 
+		const FieldStrength * r01, 
+		const FieldStrength * r11, 
+		const size_t nCells, 
+		NonTrivialRegularCase::CodeType * vCaseCodes, 
+		DimensionType * vNonTrivials 
+	)
+	{
+		size_t c = 0, n = 0;
+
+#if defined(OHT_SIMD_AVX2)
+		{
+			const __m256i zero = _mm256_setzero_si256();
+
+			// Each block of 32 cells requires 33 voxels in each row
+			for (; c + 32 <= nCells; c += 32)
+			{
+#define OHT_RCRC_BIT(row, dx, corner) \
+	_mm256_and_si256(_mm256_cmpgt_epi8(zero, _mm256_loadu_si256(reinterpret_cast< const __m256i * > (row + c + dx))), _mm256_set1_epi8(char(1 << corner)))
+
+				const __m256i casecode = 
+					_mm256_or_si256(
+						_mm256_or_si256(
+							_mm256_or_si256(OHT_RCRC_BIT(r00, 0, 0), OHT_RCRC_BIT(r00, 1, 1)),
+							_mm256_or_si256(OHT_RCRC_BIT(r10, 0, 2), OHT_RCRC_BIT(r10, 1, 3))
+						),
+						_mm256_or_si256(
+							_mm256_or_si256(OHT_RCRC_BIT(r01, 0, 4), OHT_RCRC_BIT(r01, 1, 5)),
+							_mm256_or_si256(OHT_RCRC_BIT(r11, 0, 6), OHT_RCRC_BIT(r11, 1, 7))
+						)
+					);
+#undef OHT_RCRC_BIT
+
+				_mm256_storeu_si256(reinterpret_cast< __m256i * > (vCaseCodes + c), casecode);
+
+				// Trivial cells are either entirely solid (0xFF) or entirely empty (0x00)
+				uint32 nontrivial = ~uint32(_mm256_movemask_epi8(
+					_mm256_or_si256(
+						_mm256_cmpeq_epi8(casecode, zero), 
+						_mm256_cmpeq_epi8(casecode, _mm256_set1_epi8(-1))
+					)
+				));
+
+				for (DimensionType x = DimensionType(c); nontrivial != 0; nontrivial >>= 1, ++x)
+					if (nontrivial & 1)
+						vNonTrivials[n++] = x;
+			}
+		}
+#endif
+
+#if defined(OHT_SIMD_SSE2)
+		{
+			const __m128i zero = _mm_setzero_si128();
+
+			// Each block of 16 cells requires 17 voxels in each row
+			for (; c + 16 <= nCells; c += 16)
+			{
+#define OHT_RCRC_BIT(row, dx, corner) \
+	_mm_and_si128(_mm_cmplt_epi8(_mm_loadu_si128(reinterpret_cast< const __m128i * > (row + c + dx)), zero), _mm_set1_epi8(char(1 << corner)))
+
+				const __m128i casecode = 
+					_mm_or_si128(
+						_mm_or_si128(
+							_mm_or_si128(OHT_RCRC_BIT(r00, 0, 0), OHT_RCRC_BIT(r00, 1, 1)),
+							_mm_or_si128(OHT_RCRC_BIT(r10, 0, 2), OHT_RCRC_BIT(r10, 1, 3))
+						),
+						_mm_or_si128(
+							_mm_or_si128(OHT_RCRC_BIT(r01, 0, 4), OHT_RCRC_BIT(r01, 1, 5)),
+							_mm_or_si128(OHT_RCRC_BIT(r11, 0, 6), OHT_RCRC_BIT(r11, 1, 7))
+						)
+					);
+#undef OHT_RCRC_BIT
+
+				_mm_storeu_si128(reinterpret_cast< __m128i * > (vCaseCodes + c), casecode);
+
+				// Trivial cells are either entirely solid (0xFF) or entirely empty (0x00)
+				unsigned nontrivial = ~unsigned(_mm_movemask_epi8(
+					_mm_or_si128(
+						_mm_cmpeq_epi8(casecode, zero), 
+						_mm_cmpeq_epi8(casecode, _mm_set1_epi8(-1))
+					)
+				)) & 0xFFFF;
+
+				for (DimensionType x = DimensionType(c); nontrivial != 0; nontrivial >>= 1, ++x)
+					if (nontrivial & 1)
+						vNonTrivials[n++] = x;
+			}
+		}
+#endif
+
+		// Scalar fallback and the remainder of the row, same bit arithmetic as RegularCaseCodeCompiler::step
+		for (; c < nCells; ++c)
+		{
+			const NonTrivialRegularCase::CodeType casecode = NonTrivialRegularCase::CodeType(
+				((r00[c + 0] >> (8 - 1 - 0)) & (1 << 0)) |
+				((r00[c + 1] >> (8 - 1 - 1)) & (1 << 1)) |
+				((r10[c + 0] >> (8 - 1 - 2)) & (1 << 2)) |
+				((r10[c + 1] >> (8 - 1 - 3)) & (1 << 3)) |
+				((r01[c + 0] >> (8 - 1 - 4)) & (1 << 4)) |
+				((r01[c + 1] >> (8 - 1 - 5)) & (1 << 5)) |
+				((r11[c + 0] >> (8 - 1 - 6)) & (1 << 6)) |
+				((r11[c + 1] >> (8 - 1 - 7)) & (1 << 7))
+			);
+
+			vCaseCodes[c] = casecode;
+			if (casecode != 0x00 && casecode != 0xFF)
+				vNonTrivials[n++] = DimensionType(c);
+		}
+
+		return n;
+	}
+
+	size_t IsoSurfaceBuilder::RegularCaseRowCompiler::derive( const NonTrivialRegularCase::CodeType * vCaseCodes0, const DimensionType y, const DimensionType z, const unsigned short nLOD )
+	{
+		const size_t nDim = _cdrd.dimensions;
+		const DimensionType nFar = (1 << nLOD) - 1;
+		const size_t nCells = nDim >> nLOD;
+
+		// The finest cells holding the corners of the coarse cells, ordered as the corner bits (y, z), (y + 1, z), (y, z + 1), (y + 1, z + 1)
+		const NonTrivialRegularCase::CodeType * rows[4] =
+		{
+			vCaseCodes0 + ((z + 0) * nDim + (y + 0)) * nDim,
+			vCaseCodes0 + ((z + 0) * nDim + (y + nFar)) * nDim,
+			vCaseCodes0 + ((z + nFar) * nDim + (y + 0)) * nDim,
+			vCaseCodes0 + ((z + nFar) * nDim + (y + nFar)) * nDim
+		};
+		size_t n = 0;
+
+		for (size_t c = 0; c < nCells; ++c)
+		{
+			const size_t x0 = c << nLOD, x1 = x0 + nFar;
+			NonTrivialRegularCase::CodeType casecode = 0;
+
+			// Bits 2r and 2r + 1 are the near and far corners along X of the r'th row
+			for (unsigned r = 0; r < 4; ++r)
+				casecode |= (rows[r][x0] & (1 << (r * 2))) | (rows[r][x1] & (1 << (r * 2 + 1)));
+
+			casecodes[c] = casecode;
+			if (casecode != 0x00 && casecode != 0xFF)
+				nontrivials[n++] = DimensionType(c);
+		}
+
+		return n;
+	}
+
 	IsoSurfaceBuilder::iterator_GridCells::iterator_GridCells( const unsigned short nLOD, const Voxel::const_DataAccessor & vx, const Voxel::CubeDataRegionDescriptor & cdrd )
 		: _result(GridCell(cdrd, nLOD)), _cdrd(cdrd), _span(1 << nLOD), _ccc(nLOD, vx, cdrd)
 	{
@@ -0,0 +1,284 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#include "pch.h"
+
+#include "IsoSurfaceBuilderPool.h"
+#include "IsoSurfaceBuilder.h"
+#include "CubeDataRegionDescriptor.h"
+#include "BuildCache.h"
+#include "SlabWorkers.h"
+
+namespace Ogre
+{
+	using namespace boost::posix_time;
+
+	IsoSurfaceBuilderPool::IsoSurfaceBuilderPool( const Voxel::CubeDataRegionDescriptor & cubemeta, const OverhangTerrainOptions & opts, const size_t nCount )
+		: _pBuildCache(opts.buildCacheSize > 0 ? new BuildCache(opts.buildCacheSize) : NULL), _pSlabWorkers(NULL), _nPeak(0), _nBuilds(0), _nReplays(0), _nBusy(0), _nCacheTriangles(0), _nCacheMissesBefore(0), _nCacheMissesAfter(0), 
+			_nDecimationTrianglesBefore(0), _nDecimationTrianglesAfter(0), _nCollapses(0), _fCollapseMaxError(0), _fCollapseTotalError(0), 
+			_nSurfaces(0), _nCells(0), _nVertices(0), _nTriangles(0), 
+			_nCaseCodesTime(0), _nRefinementsTime(0), _nMarshalTime(0), _nTriangulateTime(0), _nQueueFillTime(0), _tmReset(microsec_clock::universal_time())
+	{
+		OgreAssert(nCount > 0, "Pool must contain at least one builder");
+
+		const Channel::Index< IsoSurfaceBuilder::ChannelParameters > chanparams (
+			opts.channels.descriptor,
+			[opts] (const Channel::Ident channel) -> IsoSurfaceBuilder::ChannelParameters *
+			{
+				const OverhangTerrainOptions::ChannelOptions & chanopts = opts.channels[channel];
+				return new IsoSurfaceBuilder::ChannelParameters(
+					chanopts.transitionCellWidthRatio,
+					IsoSurfaceBuilder::genSurfaceFlags(chanopts),
+					chanopts.maxGeoMipMapLevel,
+					chanopts.maxPixelError,
+					chanopts.flipNormals,
+					chanopts.normals,
+					chanopts.optimizeVertexCache,
+					chanopts.surfaceNetsLODBegin,
+					chanopts.surfaceNetsLODEnd,
+					chanopts.decimate ? chanopts.decimationLOD : IsoSurfaceBuilder::ChannelParameters::NoDecimation,
+					chanopts.decimationMaxError,
+					chanopts.indexType == HardwareIndexBuffer::IT_32BIT
+				);
+			}
+		);
+
+		// Builders and slab workers together are capped at the hardware concurrency, when every builder is busy the workers stay idle
+		const size_t nHardware = std::max(size_t(boost::thread::hardware_concurrency()), size_t(1));
+		const size_t nSlabThreads = opts.extractionSlabs > 1 ? std::min(nHardware - 1, (opts.extractionSlabs - 1) * nCount) : 0;
+
+		if (nSlabThreads > 0)
+			_pSlabWorkers = new SlabWorkers(nSlabThreads, nHardware);
+
+		// The channel parameters are immutable and shared by all builders in the pool
+		_vpBuilders.reserve(nCount);
+		for (size_t c = 0; c < nCount; ++c)
+			_vpBuilders.push_back(new IsoSurfaceBuilder(cubemeta, chanparams, _pSlabWorkers != NULL ? opts.extractionSlabs : 1, _pBuildCache, _pSlabWorkers));
+
+		_vpAvailable = _vpBuilders;
+	}
+
+	IsoSurfaceBuilderPool::~IsoSurfaceBuilderPool()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		OgreAssert(_vpAvailable.size() == _vpBuilders.size(), "Cannot deconstruct pool, there are still some builders checked-out");
+
+		for (std::vector< IsoSurfaceBuilder * >::iterator i = _vpBuilders.begin(); i != _vpBuilders.end(); ++i)
+			delete *i;
+
+		delete _pSlabWorkers;
+		delete _pBuildCache;
+	}
+
+	IsoSurfaceBuilderPool::Lease IsoSurfaceBuilderPool::lease()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		while (_vpAvailable.empty())
+			_cvRetired.wait(lock);
+
+		IsoSurfaceBuilder * pBuilder = _vpAvailable.back();
+		_vpAvailable.pop_back();
+
+		_nPeak = std::max(_nPeak, _vpBuilders.size() - _vpAvailable.size());
+
+		if (_pSlabWorkers != NULL)
+			_pSlabWorkers->occupy();
+
+		return Lease(this, pBuilder);
+	}
+
+	void IsoSurfaceBuilderPool::retire( IsoSurfaceBuilder * pBuilder, const ptime & tmStart )
+	{
+		const ptime tmNow = microsec_clock::universal_time();
+		size_t nCacheTriangles, nCacheMissesBefore, nCacheMissesAfter, nDecimationTrianglesBefore, nDecimationTrianglesAfter, nCollapses;
+		Real fCollapseMaxError, fCollapseTotalError;
+		IsoSurfaceBuilder::ExtractionStatistics extraction;
+
+		// The builder is still exclusively held here
+		pBuilder->takeVertexCacheStatistics(nCacheTriangles, nCacheMissesBefore, nCacheMissesAfter);
+		pBuilder->takeDecimationStatistics(nDecimationTrianglesBefore, nDecimationTrianglesAfter, nCollapses, fCollapseMaxError, fCollapseTotalError);
+		pBuilder->takeExtractionStatistics(extraction);
+
+		if (_pSlabWorkers != NULL)
+			_pSlabWorkers->vacate();
+
+		{ boost::mutex::scoped_lock lock(_mutex);
+			_vpAvailable.push_back(pBuilder);
+
+			if (tmStart >= _tmReset)
+			{
+				_nBusy += (tmNow - tmStart).total_microseconds();
+				// A lease that was served entirely from the build cache extracted nothing
+				if (extraction.builds > 0 || extraction.replays == 0)
+					++_nBuilds;
+				else
+					++_nReplays;
+				_nCacheTriangles += nCacheTriangles;
+				_nCacheMissesBefore += nCacheMissesBefore;
+				_nCacheMissesAfter += nCacheMissesAfter;
+				_nDecimationTrianglesBefore += nDecimationTrianglesBefore;
+				_nDecimationTrianglesAfter += nDecimationTrianglesAfter;
+				_nCollapses += nCollapses;
+				_fCollapseMaxError = std::max(_fCollapseMaxError, fCollapseMaxError);
+				_fCollapseTotalError += fCollapseTotalError;
+				_nSurfaces += extraction.builds;
+				_nCells += extraction.cells;
+				_nVertices += extraction.vertices;
+				_nTriangles += extraction.triangles;
+				_nCaseCodesTime += extraction.stages[IsoSurfaceBuilder::Stage_CaseCodes];
+				_nRefinementsTime += extraction.stages[IsoSurfaceBuilder::Stage_Refinements];
+				_nMarshalTime += extraction.stages[IsoSurfaceBuilder::Stage_Marshal];
+				_nTriangulateTime += extraction.stages[IsoSurfaceBuilder::Stage_Triangulate];
+				_nQueueFillTime += extraction.stages[IsoSurfaceBuilder::Stage_QueueFill];
+			}
+		}
+		_cvRetired.notify_one();
+	}
+
+	IsoSurfaceBuilderPool::Statistics IsoSurfaceBuilderPool::getStatistics() const
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		Statistics stats;
+
+		stats.capacity = _vpBuilders.size();
+		stats.peak = _nPeak;
+		stats.builds = _nBuilds;
+		stats.replays = _nReplays;
+		stats.busy = _nBusy;
+		stats.elapsed = (microsec_clock::universal_time() - _tmReset).total_microseconds();
+		stats.cacheTriangles = _nCacheTriangles;
+		stats.cacheMissesBefore = _nCacheMissesBefore;
+		stats.cacheMissesAfter = _nCacheMissesAfter;
+		stats.decimationTrianglesBefore = _nDecimationTrianglesBefore;
+		stats.decimationTrianglesAfter = _nDecimationTrianglesAfter;
+		stats.collapses = _nCollapses;
+		stats.collapseMaxError = _fCollapseMaxError;
+		stats.collapseTotalError = _fCollapseTotalError;
+		stats.surfaces = _nSurfaces;
+		stats.cells = _nCells;
+		stats.vertices = _nVertices;
+		stats.triangles = _nTriangles;
+		stats.caseCodesTime = _nCaseCodesTime;
+		stats.refinementsTime = _nRefinementsTime;
+		stats.marshalTime = _nMarshalTime;
+		stats.triangulateTime = _nTriangulateTime;
+		stats.queueFillTime = _nQueueFillTime;
+
+		if (_pBuildCache != NULL)
+			_pBuildCache->getStatistics(stats.buildCacheHits, stats.buildCacheMisses, stats.buildCacheEntries, stats.buildCacheBytes);
+		else
+			stats.buildCacheHits = stats.buildCacheMisses = stats.buildCacheEntries = stats.buildCacheBytes = 0;
+
+		return stats;
+	}
+
+	void IsoSurfaceBuilderPool::resetStatistics()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		_nPeak = _vpBuilders.size() - _vpAvailable.size();
+		_nBuilds = _nReplays = 0;
+		_nBusy = 0;
+		_nCacheTriangles = _nCacheMissesBefore = _nCacheMissesAfter = 0;
+		_nDecimationTrianglesBefore = _nDecimationTrianglesAfter = _nCollapses = 0;
+		_fCollapseMaxError = _fCollapseTotalError = 0;
+		_nSurfaces = _nCells = _nVertices = _nTriangles = 0;
+		_nCaseCodesTime = _nRefinementsTime = _nMarshalTime = _nTriangulateTime = _nQueueFillTime = 0;
+		if (_pBuildCache != NULL)
+			_pBuildCache->resetStatistics();
+		_tmReset = microsec_clock::universal_time();
+	}
+
+	void IsoSurfaceBuilderPool::Statistics::writeJSON( std::ostream & os ) const
+	{
+		os 
+			<< "{"
+			<< "\"capacity\":" << capacity << ','
+			<< "\"peak\":" << peak << ','
+			<< "\"builds\":" << builds << ','
+			<< "\"replays\":" << replays << ','
+			<< "\"busy\":" << busy << ','
+			<< "\"elapsed\":" << elapsed << ','
+			<< "\"throughput\":" << getThroughput() << ','
+			<< "\"concurrency\":" << getConcurrency() << ','
+			<< "\"latency\":" << getLatency() << ','
+			<< "\"surfaces\":" << surfaces << ','
+			<< "\"cells\":" << cells << ','
+			<< "\"vertices\":" << vertices << ','
+			<< "\"triangles\":" << triangles << ','
+			<< "\"cellsPerSecond\":" << getCellRate() << ','
+			<< "\"verticesPerSecond\":" << getVertexRate() << ','
+			<< "\"trianglesPerSecond\":" << getTriangleRate() << ','
+			<< "\"triangulatedPerSecond\":" << getTriangulationRate() << ','
+			<< "\"stages\":{"
+				<< "\"caseCodes\":" << caseCodesTime << ','
+				<< "\"refinements\":" << refinementsTime << ','
+				<< "\"marshal\":" << marshalTime << ','
+				<< "\"triangulate\":" << triangulateTime << ','
+				<< "\"queueFill\":" << queueFillTime
+			<< "},"
+			<< "\"vertexCache\":{"
+				<< "\"triangles\":" << cacheTriangles << ','
+				<< "\"acmrBefore\":" << getACMRBefore() << ','
+				<< "\"acmrAfter\":" << getACMRAfter()
+			<< "},"
+			<< "\"decimation\":{"
+				<< "\"trianglesBefore\":" << decimationTrianglesBefore << ','
+				<< "\"trianglesAfter\":" << decimationTrianglesAfter << ','
+				<< "\"collapses\":" << collapses << ','
+				<< "\"maxError\":" << collapseMaxError << ','
+				<< "\"meanError\":" << getMeanCollapseError()
+			<< "},"
+			<< "\"buildCache\":{"
+				<< "\"hits\":" << buildCacheHits << ','
+				<< "\"misses\":" << buildCacheMisses << ','
+				<< "\"hitRatio\":" << getBuildCacheHitRatio() << ','
+				<< "\"entries\":" << buildCacheEntries << ','
+				<< "\"bytes\":" << buildCacheBytes
+			<< "}"
+			<< "}";
+	}
+
+	IsoSurfaceBuilderPool::Lease::Lease( IsoSurfaceBuilderPool * pPool, IsoSurfaceBuilder * pBuilder )
+		: _pPool(pPool), _pBuilder(pBuilder), _tmStart(microsec_clock::universal_time())
+	{}
+
+	IsoSurfaceBuilderPool::Lease::Lease( Lease && move )
+		: _pPool(move._pPool), _pBuilder(move._pBuilder), _tmStart(move._tmStart)
+	{
+		move._pBuilder = NULL;
+	}
+
+	IsoSurfaceBuilderPool::Lease::~Lease()
+	{
+		if (_pBuilder != NULL)
+			_pPool->retire(_pBuilder, _tmStart);
+	}
+}
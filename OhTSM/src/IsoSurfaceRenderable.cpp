@@ -45,14 +45,22 @@ namespace Ogre
 
 	Ogre::String IsoSurfaceRenderable::TYPE = "IsoSurface";
 
-	IsoSurfaceRenderable::IsoSurfaceRenderable(RenderManager * pRendMan, VertexDeclaration * pVtxDecl, MetaFragment::Container * pMWF, const size_t nLODLevels, const Real fPixelError, const Ogre::String & sName /*= ""*/)
-	:	DynamicRenderable(pVtxDecl, RenderOperation::OT_TRIANGLE_LIST, true, nLODLevels, fPixelError, sName), 
+	IsoSurfaceRenderable::IsoSurfaceRenderable(RenderManager * pRendMan, VertexDeclaration * pVtxDecl, MetaFragment::Container * pMWF, const size_t nLODLevels, const Real fPixelError, const HardwareIndexBuffer::IndexType enIndexType, const Ogre::String & sName /*= ""*/)
+	:	DynamicRenderable(pVtxDecl, RenderOperation::OT_TRIANGLE_LIST, true, nLODLevels, fPixelError, enIndexType, sName), 
 		_pRendMan(pRendMan), _pMWF(pMWF), _bbox(pMWF->acquireBasicInterface().block->getBoxSize()), _pShadow(new HardwareIsoVertexShadow(nLODLevels)), 
 		_pMesh0(NULL), _t3df0(T3DS_None), _t3df(T3DS_None), _lod0(-1), _lod(-1), _pRange0(NULL)
 	{
 #ifdef _DISPDBG
 		_bBoxDisplay = false;
 #endif
+		// Positions of compact vertices are quantized relative to the centre of the cube, scale them back to its size
+		if (pMWF->factory->surfaceFlags & IsoVertexElements::GEN_COMPACT)
+		{
+			const MetaFragment::Interfaces::const_Basic basic = static_cast< const MetaFragment::Container * > (pMWF) ->acquireBasicInterface();
+			const Real fScale = BuilderQueue::CompactVertexElement::getPositionScale(basic.block->meta.dimensions, basic.block->meta.scale);
+
+			setWorldTransform(Matrix4::getScale(fScale, fScale, fScale));
+		}
 	}
 
 	IsoSurfaceRenderable::~IsoSurfaceRenderable()
@@ -69,77 +77,52 @@ namespace Ogre
 	{
 		oht_assert_threadmodel(ThrMdl_Main);
 
+		// The builder starts the vertex buffer over before it outgrows 16-bit indices, a surface it cannot fit never reaches here
+		if (getMesh()->indices.getIndexType() == HardwareIndexBuffer::IT_16BIT && queue.requiredVertexCount() > MaxHWVertices16)
+			OGRE_EXCEPT(Exception::ERR_INVALIDPARAMS, "Too many vertices for 16-bit indices, use 32-bit indices for this channel", __FUNCTION__);
+
 		// TODO: Check return value of prepare vertex buffer call
 		prepareVertexBuffer(queue.requiredVertexCount(), queue.resetVertexBuffer || queue.resetIndexBuffer);
-		prepareIndexBuffer(queue.meshOp.resolution->lod, queue.stitches, queue.indexQueue.size());
+		// Resizing the index buffer discards every configuration in it, make room for all configurations of the batch beforehand
+		reserveIndexBuffer(queue.batchIndexCount());
 
 		Mesh * pMesh = getMesh();
-		HardwareVertexBufferSharedPtr pVtxBuffer = pMesh->vertices.getVertexBuffer();
-		SurfaceIndexData::Resolution::Range * pIdxRange = pMesh->indices.range(queue.meshOp.resolution->lod, queue.stitches);
 		HardwareIndexBufferSharedPtr pIdxBuffer = pMesh->indices.getIndexBuffer();
 
-		const MetaVoxelFactory::VertexDeclarationElements * pVtxDeclElems = _pMWF->factory->getVertexDeclarationElements();
-		const size_t nVertexByteSize = _pMWF->factory->getVertexSize();
+		const StagingArena & staging = queue.staging;
 
-		if (!queue.vertexQueue.empty())
-		{
-			unsigned char * pOffset = static_cast< unsigned char * > (
-				pVtxBuffer->lock(
-					queue.vertexBufferOffset() * nVertexByteSize,
-					queue.vertexQueue.size() * nVertexByteSize,
-					HardwareBuffer::HBL_DISCARD
-				)
-			);
+		OgreAssert(staging.vertexSize == _pMWF->factory->getVertexSize(), "Staged vertices do not match the vertex declaration of the channel");
+		OgreAssert(staging.indexSize == pIdxBuffer->getIndexSize(), "Staged indices do not match the width of the hardware index buffer");
 
-			for (BuilderQueue::VertexElementList::const_iterator i = queue.vertexQueue.begin(); i != queue.vertexQueue.end(); ++i)
-			{
-				Real * pReal;
+		// Vertices were staged in the layout of the hardware buffer by the producer
+		copyStagedVertices(staging, queue.vertexBufferOffset(), queue.remapHWVI2IVIQueue, queue.resetVertexBuffer != 0);
 
-				pVtxDeclElems->position->baseVertexPointerToElement(pOffset, &pReal);
-				*pReal++ = i->position.x;
-				*pReal++ = i->position.y;
-				*pReal++ = i->position.z;
+		auto writeIndices = [&] (const unsigned nLOD, const Touch3DFlags enStitches, const BuilderQueue::IndexRange & range)
+		{
+			// A sibling configuration may have been built since the batch was requested
+			if (isConfigurationBuilt(nLOD, enStitches))
+				return;
 
-				if (pVtxDeclElems->normal != NULL)
-				{
-					pVtxDeclElems->normal->baseVertexPointerToElement(pOffset, &pReal);
-					*pReal++ = i->normal.x;
-					*pReal++ = i->normal.y;
-					*pReal++ = i->normal.z;
-				}
-				if (pVtxDeclElems->diffuse != NULL)
-				{
-					uint32 * uColour;
-					pVtxDeclElems->diffuse->baseVertexPointerToElement(pOffset, &uColour);
-					*uColour = i->colour;
-				}
-				if (pVtxDeclElems->texcoords != NULL)
-				{
-					pVtxDeclElems->texcoords->baseVertexPointerToElement(pOffset, &pReal);
-					*pReal++ = i->texcoord.x;
-					*pReal++ = i->texcoord.y;
-				}
-				pOffset += nVertexByteSize;
-			}
+			prepareIndexBuffer(nLOD, enStitches, range.count);
 
-			pVtxBuffer->unlock();
-		}
+			if (range.count > 0)
+			{
+				SurfaceIndexData::Resolution::Range * pIdxRange = pMesh->indices.range(nLOD, enStitches);
 
-		if (!queue.indexQueue.empty())
-		{
-			OgreAssert(pIdxRange->offset + pIdxRange->length < pIdxBuffer->getNumIndexes(), "Tried to lock unbounded range of index buffer");
-			HWVertexIndex * pIndex = static_cast< HWVertexIndex * > (
-				pIdxBuffer->lock(
-					pIdxRange->offset * sizeof(HWVertexIndex), 
-					pIdxRange->length * sizeof(HWVertexIndex), 
+				OgreAssert(pIdxRange->offset + pIdxRange->length < pIdxBuffer->getNumIndexes(), "Tried to lock unbounded range of index buffer");
+				void * pIndices = pIdxBuffer->lock(
+					pIdxRange->offset * pIdxBuffer->getIndexSize(), 
+					pIdxRange->length * pIdxBuffer->getIndexSize(), 
 					HardwareBuffer::HBL_DISCARD
-				)
-			);
-			for (BuilderQueue::IndexList::const_iterator i = queue.indexQueue.begin(); i != queue.indexQueue.end(); ++i)
-				*pIndex++ = *i;
+				);
+				memcpy(pIndices, staging.indices.data(range.offset * staging.indexSize), range.count * staging.indexSize);
+				pIdxBuffer->unlock();
+			}
+		};
 
-			pIdxBuffer->unlock();
-		}
+		writeIndices(queue.meshOp.resolution->lod, queue.stitches, queue.indexRange);
+		for (BuilderQueue::SiblingList::const_iterator i = queue.siblings.begin(); i != queue.siblings.end(); ++i)
+			writeIndices(i->resolution->lod, i->stitches, i->indices);
 
 		queue.consume();
 
@@ -150,99 +133,109 @@ namespace Ogre
 #endif
 	void IsoSurfaceRenderable::populateBuffers( 
 		IsoVertexElements *												pVtxElems, 
+		const StagingArena &											staging,
 		HardwareShadow::HardwareIsoVertexShadow::DirectAccess &			direct, 
 		const bool														bResetVertexBuffer, 
-		const bool														bResetIndexBuffer, 
-		const size_t													nNewVertexCount, 
-		const size_t													nIndexCount
+		const bool														bResetIndexBuffer
 	)
 	{
 		oht_assert_threadmodel(ThrMdl_Main);
+		if (getMesh()->indices.getIndexType() == HardwareIndexBuffer::IT_16BIT && staging.vertexCount() + direct.meshOp.nextVertexIndex() > MaxHWVertices16)
+			OGRE_EXCEPT(Exception::ERR_INVALIDPARAMS, "Too many vertices for 16-bit indices, use 32-bit indices for this channel", __FUNCTION__);
 
-		prepareVertexBuffer(nNewVertexCount + direct.meshOp.nextVertexIndex(), bResetVertexBuffer || bResetIndexBuffer);
-		prepareIndexBuffer(direct.meshOp.resolution->lod, direct.stitches, nIndexCount);
-		const MetaVoxelFactory::VertexDeclarationElements * const pVtxDeclElems = _pMWF->factory->getVertexDeclarationElements();
+		prepareVertexBuffer(staging.vertexCount() + direct.meshOp.nextVertexIndex(), bResetVertexBuffer || bResetIndexBuffer);
+		prepareIndexBuffer(direct.meshOp.resolution->lod, direct.stitches, staging.indexCount());
 		Mesh * pMesh = getMesh();
-		HardwareVertexBufferSharedPtr pVtxBuffer = pMesh->vertices.getVertexBuffer();
 		SurfaceIndexData::Resolution::Range * pIdxRange = pMesh->indices.range(direct.meshOp.resolution->lod, direct.stitches);
 		HardwareIndexBufferSharedPtr pIdxBuffer = pMesh->indices.getIndexBuffer();
 
-		const size_t nVertexByteSize = _pMWF->factory->getVertexSize();
-		const float fVertScale =
-			const_cast< const MetaFragment::Container * > (_pMWF)	// Enter "const" context
-			->acquire< MetaFragment::Interfaces::const_Basic > ()	// Acquire basic concurrent access
-			.block					// Retrieve the fragment's voxel cube region
-			->meta					// Access the cube region descriptor
-			.scale;					// Finally access the grid cell scale
+		OgreAssert(staging.vertexSize == _pMWF->factory->getVertexSize(), "Staged vertices do not match the vertex declaration of the channel");
+		OgreAssert(staging.indexSize == pIdxBuffer->getIndexSize(), "Staged indices do not match the width of the hardware index buffer");
 
-		if (!pVtxElems->vertexShipment.empty())
+		// Staged by the builder in the layout of the hardware buffers just as a batch is
+		copyStagedVertices(staging, direct.meshOp.nextVertexIndex(), pVtxElems->vertexRemaps, bResetVertexBuffer);
+
+		if (!staging.indices.empty())
 		{
-			unsigned char * pOffset = static_cast< unsigned char * > (
-				pVtxBuffer->lock(
-					direct.meshOp.nextVertexIndex() * nVertexByteSize,
-					pVtxElems->vertexShipment.size() * nVertexByteSize,
-					HardwareBuffer::HBL_DISCARD
-				)
+			OgreAssert(pIdxRange->length == staging.indexCount(), "Buffer range did not match vertex queue index length... thingy...");
+			void * pIndices = pIdxBuffer->lock(
+				pIdxRange->offset * pIdxBuffer->getIndexSize(), 
+				pIdxRange->length * pIdxBuffer->getIndexSize(), 
+				HardwareBuffer::HBL_DISCARD
 			);
+			memcpy(pIndices, staging.indices.data(), staging.indices.size());
+			pIdxBuffer->unlock();
+		}
 
-			for (IsoVertexVector::const_iterator i = pVtxElems->vertexShipment.begin(); i != pVtxElems->vertexShipment.end(); ++i)
-			{
-				Real * pReal;
-
-				const IsoFixVec3 & pt = pVtxElems->positions[*i];
-				pVtxDeclElems->position->baseVertexPointerToElement(pOffset, &pReal);
-				*pReal++ = Real(pt.x) * fVertScale;
-				*pReal++ = Real(pt.y) * fVertScale;
-				*pReal++ = Real(pt.z) * fVertScale;
+		direct.revmapIVI2HWVIQueue = pVtxElems->vertexShipment;
+		pVtxElems->vertexShipment.clear();
+		direct.remapHWVI2IVIQueue = pVtxElems->vertexRemaps;
+		pVtxElems->vertexRemaps.clear();
+	}
 
-				if (pVtxDeclElems->normal != NULL)
-				{
-					const Vector3 & n = pVtxElems->normals[*i];
-					pVtxDeclElems->normal->baseVertexPointerToElement(pOffset, &pReal);
-					*pReal++ = n.x;
-					*pReal++ = n.y;
-					*pReal++ = n.z;
-				}
-				if (pVtxDeclElems->diffuse != NULL)
-				{
-					uint32 * uColour;
-					pVtxDeclElems->diffuse->baseVertexPointerToElement(pOffset, &uColour);
-					Root::getSingleton().convertColourValue(pVtxElems->colours[*i], uColour);
-				}
-				if (pVtxDeclElems->texcoords != NULL)
-				{
-					pVtxDeclElems->texcoords->baseVertexPointerToElement(pOffset, &pReal);
-					*pReal++ = pVtxElems->texcoords[*i][0];
-					*pReal++ = pVtxElems->texcoords[*i][1];
-				}
-				pOffset += nVertexByteSize;
-			}
+	void IsoSurfaceRenderable::copyStagedVertices( const StagingArena & staging, const size_t nFirstVertex, const IsoVertexRemapVector & remaps, const bool bReset )
+	{
+		HardwareVertexBufferSharedPtr pVtxBuffer = getMesh()->vertices.getVertexBuffer();
+		const size_t nVertexByteSize = staging.vertexSize;
 
+		// New vertices follow one another in the hardware buffer, copy them in one go
+		if (!staging.vertices.empty())
+		{
+			void * pVertices = pVtxBuffer->lock(
+				nFirstVertex * nVertexByteSize,
+				staging.vertices.size(),
+				HardwareBuffer::HBL_DISCARD
+			);
+			memcpy(pVertices, staging.vertices.data(), staging.vertices.size());
 			pVtxBuffer->unlock();
 		}
 
-		if (!pVtxElems->triangles.empty())
+		if (!staging.patches.empty())
 		{
-			HWVertexIndex * pIndex = static_cast< HWVertexIndex * > (
-				pIdxBuffer->lock(
-					pIdxRange->offset * sizeof(HWVertexIndex), 
-					pIdxRange->length * sizeof(HWVertexIndex), 
-					HardwareBuffer::HBL_DISCARD
+			OgreAssert(!bReset, "Cannot patch vertices of a vertex buffer that was reset");
+
+			// Vertices are rewritten in-place, lock only the span they occupy and preserve the rest
+			HWVertexIndex nLowest = HWVertexIndex(~0), nHighest = 0;
+			for (IsoVertexRemapVector::const_iterator i = remaps.begin(); i != remaps.end(); ++i)
+				if (i->ivi != IsoVertexIndex(~0))
+				{
+					nLowest = std::min(nLowest, i->index);
+					nHighest = std::max(nHighest, i->index);
+				}
+
+			unsigned char * pBase = static_cast< unsigned char * > (
+				pVtxBuffer->lock(
+					nLowest * nVertexByteSize,
+					(nHighest - nLowest + 1) * nVertexByteSize,
+					HardwareBuffer::HBL_NORMAL
 				)
 			);
-			OgreAssert(pIdxRange->length == pVtxElems->indexCount(), "Buffer range did not match vertex queue index length... thingy...");
-			for (IsoTriangleVector::const_iterator i = pVtxElems->triangles.begin(); i != pVtxElems->triangles.end(); ++i)
+
+			// Staged patches follow the patching entries of the remaps, copy runs of consecutive hardware vertices at once
+			const unsigned char * pPatch = staging.patches.data();
+			IsoVertexRemapVector::const_iterator i = remaps.begin();
+			while (i != remaps.end())
 			{
-				*pIndex++ = pVtxElems->indices[i->vertices[0]];
-				*pIndex++ = pVtxElems->indices[i->vertices[1]];
-				*pIndex++ = pVtxElems->indices[i->vertices[2]];
+				if (i->ivi == IsoVertexIndex(~0))
+				{
+					++i;
+					continue;
+				}
+
+				const HWVertexIndex nFirst = i->index;
+				size_t nRun = 0;
+				do
+				{
+					++nRun;
+					++i;
+				} while (i != remaps.end() && i->ivi != IsoVertexIndex(~0) && i->index == nFirst + nRun);
+
+				memcpy(pBase + (nFirst - nLowest) * nVertexByteSize, pPatch, nRun * nVertexByteSize);
+				pPatch += nRun * nVertexByteSize;
 			}
 
-			pIdxBuffer->unlock();
+			pVtxBuffer->unlock();
 		}
-
-		direct.revmapIVI2HWVIQueue = pVtxElems->vertexShipment;
-		pVtxElems->vertexShipment.clear();
 	}
 
 	void IsoSurfaceRenderable::deleteGeometry()
@@ -253,6 +246,16 @@ namespace Ogre
 		_pShadow->clearBuffers(IBufferManager::BD_Shadow); // TODO: Can potentially block
 	}
 
+	void IsoSurfaceRenderable::invalidateRegion( const CellRegion & region )
+	{
+		oht_assert_threadmodel(ThrMdl_Main);
+
+		// Vertices remain in the hardware buffer to be patched, only the triangle lists of every configuration are stale.
+		// The shadow waits for a build in progress since the batch it produces is stale and must be discarded with the others
+		getMesh()->indices.reset();
+		_pShadow->invalidateRegion(region);
+	}
+
 	void /*SimpleRenderable::*/ IsoSurfaceRenderable::getRenderOperation( RenderOperation& op )
 	{
 		oht_assert_threadmodel(ThrMdl_Main);
@@ -33,35 +33,53 @@ http://www.gnu.org/copyleft/lesser.txt.
 
 namespace Ogre
 {
-	IsoVertexElements::IsoVertexElements( const size_t nNumElements )
+	IsoVertexElements::IsoVertexElements( const size_t nNumElements, const bool bWideIndices )
 		: 
 		count(nNumElements),
 
-		indices( new HWVertexIndex[nNumElements] ),
-		positions( new IsoFixVec3[nNumElements] ),
+		_slots( nNumElements, ~0U ),
+		_nAttributes( 0 ),
 
-		normals( new Vector3[nNumElements] ),
-		colours( new ColourValue[nNumElements] ),
-		texcoords( new TexCoords[nNumElements] )
+		indices( nNumElements, bWideIndices ),
+		positions( *this ),
+
+		normals( *this ),
+		colours( *this ),
+		texcoords( *this )
 	{
 	}
 
 	IsoVertexElements::~IsoVertexElements()
 	{
-		delete[] indices;
-		delete[] positions;
-		delete[] normals;
-		delete[] colours;
-		delete[] texcoords;
+		for (std::vector< Attributes * >::iterator i = _vpAttributePages.begin(); i != _vpAttributePages.end(); ++i)
+			delete [] *i;
 	}
 
 	void IsoVertexElements::clear()
 	{
-		memset(indices, ~0, sizeof(HWVertexIndex) * count);
+		// Attribute pages are kept for the next build, they only grow as large as the largest surface extracted
+		indices.clear();
+		_slots.clear();
+		_nAttributes = 0;
 		vertexShipment.clear();
+		vertexRemaps.clear();
 		triangles.clear();
 	}
 
+	unsigned int IsoVertexElements::allocateAttributes()
+	{
+		const unsigned int slot = static_cast< unsigned int > (_nAttributes++);
+
+		if ((slot >> AttributePageShift) >= _vpAttributePages.size())
+			_vpAttributePages.push_back(new Attributes[1 << AttributePageShift]);
+
+		Attributes & attrs = _vpAttributePages[slot >> AttributePageShift][slot & ((1 << AttributePageShift) - 1)];
+		// Must be zero, normals are additive
+		attrs.normal = Vector3::ZERO;
+
+		return slot;
+	}
+
 	size_t IsoVertexElements::indexCount() const
 	{
 		return triangles.size();
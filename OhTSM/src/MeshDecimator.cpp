@@ -0,0 +1,294 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#include "pch.h"
+
+#include "MeshDecimator.h"
+
+#include <algorithm>
+
+namespace Ogre
+{
+	void MeshDecimator::Quadric::add( const double a, const double b, const double c, const double d )
+	{
+		m[0] += a*a;	m[1] += a*b;	m[2] += a*c;	m[3] += a*d;
+						m[4] += b*b;	m[5] += b*c;	m[6] += b*d;
+										m[7] += c*c;	m[8] += c*d;
+														m[9] += d*d;
+	}
+
+	void MeshDecimator::Quadric::add( const Quadric & other )
+	{
+		for (unsigned i = 0; i < 10; ++i)
+			m[i] += other.m[i];
+	}
+
+	double MeshDecimator::Quadric::evaluate( const Vector3 & v ) const
+	{
+		const double x = v.x, y = v.y, z = v.z;
+
+		return 
+			m[0]*x*x + 2*m[1]*x*y + 2*m[2]*x*z + 2*m[3]*x
+					 +   m[4]*y*y + 2*m[5]*y*z + 2*m[6]*y
+								  +   m[7]*z*z + 2*m[8]*z
+											   +   m[9];
+	}
+
+	MeshDecimator::Result MeshDecimator::decimate( const Vector3 * pPositions, const std::vector< bool > & vLocked, std::vector< size_t > & vIndices, const Real fMaxError )
+	{
+		const size_t 
+			nVertexCount = vLocked.size(),
+			nTriangleCount = vIndices.size() / 3;
+		const Quadric zero = { { 0 } };
+		Result result = { 0, 0, 0 };
+
+		_vQuadrics.assign(nVertexCount, zero);
+		_vVersions.assign(nVertexCount, 0);
+		_vMovable.assign(vLocked.begin(), vLocked.end());
+		_vMovable.flip();
+		_vRemoved.assign(nTriangleCount, false);
+		_vHeap.clear();
+
+		_vTriangles.resize(nVertexCount);
+		for (size_t v = 0; v < nVertexCount; ++v)
+			_vTriangles[v].clear();
+
+		// Accumulate the plane of every triangle into the quadrics of its vertices
+		for (size_t t = 0; t < nTriangleCount; ++t)
+		{
+			const size_t * const tri = &vIndices[t * 3];
+			Vector3 normal = (pPositions[tri[1]] - pPositions[tri[0]]).crossProduct(pPositions[tri[2]] - pPositions[tri[0]]);
+
+			for (unsigned c = 0; c < 3; ++c)
+				_vTriangles[tri[c]].push_back(t);
+
+			if (normal.normalise() == Real(0))
+				continue;
+
+			const double d = -normal.dotProduct(pPositions[tri[0]]);
+			for (unsigned c = 0; c < 3; ++c)
+				_vQuadrics[tri[c]].add(normal.x, normal.y, normal.z, d);
+		}
+
+		// Vertices on the border of the mesh or along non-manifold edges are not collapsed so that the outline is preserved
+		for (size_t v = 0; v < nVertexCount; ++v)
+		{
+			collectNeighbours(vIndices, v, _vNeighbours);
+			for (NeighbourVector::const_iterator i = _vNeighbours.begin(); i != _vNeighbours.end(); ++i)
+				if (i->second != 2)
+				{
+					_vMovable[v] = false;
+					break;
+				}
+		}
+
+		for (size_t v = 0; v < nVertexCount; ++v)
+			enqueue(pPositions, vIndices, v);
+
+		while (!_vHeap.empty())
+		{
+			const Collapse collapse = _vHeap.front();
+
+			std::pop_heap(_vHeap.begin(), _vHeap.end());
+			_vHeap.pop_back();
+
+			if (collapse.error > fMaxError)
+				break;
+
+			// Skip candidates evaluated before the neighbourhood of either vertex changed
+			if (collapse.vfrom != _vVersions[collapse.from] || collapse.vto != _vVersions[collapse.to] || !_vMovable[collapse.from])
+				continue;
+
+			if (!isValid(pPositions, vIndices, collapse.from, collapse.to))
+				continue;
+
+			std::vector< size_t > & from = _vTriangles[collapse.from], & to = _vTriangles[collapse.to];
+
+			for (std::vector< size_t >::const_iterator i = from.begin(); i != from.end(); ++i)
+			{
+				if (_vRemoved[*i])
+					continue;
+
+				size_t * const tri = &vIndices[*i * 3];
+
+				if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+					_vRemoved[*i] = true;
+				else
+				{
+					for (unsigned c = 0; c < 3; ++c)
+						if (tri[c] == collapse.from)
+							tri[c] = collapse.to;
+
+					to.push_back(*i);
+				}
+			}
+			from.clear();
+
+			// Forget the triangles just removed from the survivor
+			size_t n = 0;
+			for (size_t i = 0; i < to.size(); ++i)
+				if (!_vRemoved[to[i]])
+					to[n++] = to[i];
+			to.resize(n);
+
+			_vQuadrics[collapse.to].add(_vQuadrics[collapse.from]);
+			_vMovable[collapse.from] = false;
+			++_vVersions[collapse.from];
+			++_vVersions[collapse.to];
+
+			++result.collapses;
+			result.maxError = std::max(result.maxError, Real(collapse.error));
+			result.totalError += Real(collapse.error);
+
+			enqueue(pPositions, vIndices, collapse.to);
+		}
+
+		// Compact the surviving triangles
+		size_t n = 0;
+		for (size_t t = 0; t < nTriangleCount; ++t)
+			if (!_vRemoved[t])
+			{
+				for (unsigned c = 0; c < 3; ++c)
+					vIndices[n * 3 + c] = vIndices[t * 3 + c];
+				++n;
+			}
+		vIndices.resize(n * 3);
+
+		return result;
+	}
+
+	void MeshDecimator::collectNeighbours( const std::vector< size_t > & vIndices, const size_t v, NeighbourVector & vNeighbours )
+	{
+		vNeighbours.clear();
+
+		const std::vector< size_t > & triangles = _vTriangles[v];
+		for (std::vector< size_t >::const_iterator i = triangles.begin(); i != triangles.end(); ++i)
+		{
+			if (_vRemoved[*i])
+				continue;
+
+			const size_t * const tri = &vIndices[*i * 3];
+			for (unsigned c = 0; c < 3; ++c)
+			{
+				if (tri[c] == v)
+					continue;
+
+				NeighbourVector::iterator j = vNeighbours.begin();
+				while (j != vNeighbours.end() && j->first != tri[c])
+					++j;
+
+				if (j == vNeighbours.end())
+					vNeighbours.push_back(NeighbourVector::value_type(tri[c], 1));
+				else
+					++j->second;
+			}
+		}
+	}
+
+	void MeshDecimator::enqueue( const Vector3 * pPositions, const std::vector< size_t > & vIndices, const size_t v )
+	{
+		Collapse collapse;
+
+		collectNeighbours(vIndices, v, _vNeighbours);
+		for (NeighbourVector::const_iterator i = _vNeighbours.begin(); i != _vNeighbours.end(); ++i)
+		{
+			// Evaluate the collapse in either direction, the combined quadric is measured at the position of the survivor
+			for (unsigned d = 0; d < 2; ++d)
+			{
+				collapse.from = d ? i->first : v;
+				collapse.to = d ? v : i->first;
+
+				if (!_vMovable[collapse.from])
+					continue;
+
+				Quadric q = _vQuadrics[collapse.from];
+				q.add(_vQuadrics[collapse.to]);
+
+				collapse.error = std::max(q.evaluate(pPositions[collapse.to]), 0.0);
+				collapse.vfrom = _vVersions[collapse.from];
+				collapse.vto = _vVersions[collapse.to];
+
+				_vHeap.push_back(collapse);
+				std::push_heap(_vHeap.begin(), _vHeap.end());
+			}
+		}
+	}
+
+	bool MeshDecimator::isValid( const Vector3 * pPositions, const std::vector< size_t > & vIndices, const size_t from, const size_t to )
+	{
+		// Link condition, the vertices may only share the neighbours opposite the edge between them
+		collectNeighbours(vIndices, from, _vNeighbours);
+		collectNeighbours(vIndices, to, _vLink);
+
+		unsigned nShared = 0, nCommon = 0;
+		for (NeighbourVector::const_iterator i = _vNeighbours.begin(); i != _vNeighbours.end(); ++i)
+		{
+			if (i->first == to)
+				nShared = i->second;
+			else
+				for (NeighbourVector::const_iterator j = _vLink.begin(); j != _vLink.end(); ++j)
+					if (j->first == i->first)
+					{
+						++nCommon;
+						break;
+					}
+		}
+
+		if (nShared == 0 || nCommon != nShared)
+			return false;
+
+		// No remaining triangle may fold over when its vertex moves
+		const std::vector< size_t > & triangles = _vTriangles[from];
+		for (std::vector< size_t >::const_iterator i = triangles.begin(); i != triangles.end(); ++i)
+		{
+			if (_vRemoved[*i])
+				continue;
+
+			const size_t * const tri = &vIndices[*i * 3];
+			if (tri[0] == to || tri[1] == to || tri[2] == to)
+				continue;
+
+			Vector3 p[3];
+			for (unsigned c = 0; c < 3; ++c)
+				p[c] = pPositions[tri[c]];
+
+			const Vector3 before = (p[1] - p[0]).crossProduct(p[2] - p[0]);
+
+			for (unsigned c = 0; c < 3; ++c)
+				if (tri[c] == from)
+					p[c] = pPositions[to];
+
+			const Vector3 after = (p[1] - p[0]).crossProduct(p[2] - p[0]);
+
+			if (before.dotProduct(after) <= 0)
+				return false;
+		}
+
+		return true;
+	}
+}
@@ -61,13 +61,20 @@ namespace Ogre
 			const VertexElement * pPos, * pNorm, * pDiffuse, * pTexC;
 			pPos = pNorm = pDiffuse = pTexC = NULL;
 
-			pPos = &_pVtxDecl->addElement(0, offset, VET_FLOAT3, VES_POSITION);
-			offset += VertexElement::getTypeSize(VET_FLOAT3);
+			// The compact format quantizes positions relative to the cube and octahedral-encodes normals
+			const bool bCompact = (surfaceFlags & IsoVertexElements::GEN_COMPACT) != 0;
+			const VertexElementType
+				enPosType = bCompact ? VET_SHORT4 : VET_FLOAT3,
+				enNormType = bCompact ? VET_SHORT2 : VET_FLOAT3,
+				enTexCType = bCompact ? VET_SHORT2 : VET_FLOAT2;
+
+			pPos = &_pVtxDecl->addElement(0, offset, enPosType, VES_POSITION);
+			offset += VertexElement::getTypeSize(enPosType);
 
 			if (surfaceFlags & IsoVertexElements::GEN_NORMALS)
 			{
-				pNorm = &_pVtxDecl->addElement(0, offset, VET_FLOAT3, VES_NORMAL);
-				offset += VertexElement::getTypeSize(VET_FLOAT3);
+				pNorm = &_pVtxDecl->addElement(0, offset, enNormType, VES_NORMAL);
+				offset += VertexElement::getTypeSize(enNormType);
 			}
 			if (surfaceFlags & IsoVertexElements::GEN_VERTEX_COLOURS)
 			{
@@ -76,8 +83,8 @@ namespace Ogre
 			}
 			if (surfaceFlags & IsoVertexElements::GEN_TEX_COORDS)
 			{
-				pTexC = &_pVtxDecl->addElement(0, offset, VET_FLOAT2, VES_TEXTURE_COORDINATES);
-				offset += VertexElement::getTypeSize(VET_FLOAT2);
+				pTexC = &_pVtxDecl->addElement(0, offset, enTexCType, VES_TEXTURE_COORDINATES);
+				offset += VertexElement::getTypeSize(enTexCType);
 			}
 
 			_pVtxDeclElems = new VertexDeclarationElements(pPos, pNorm, pDiffuse, pTexC);
@@ -104,10 +111,15 @@ namespace Ogre
 			return new MetaFragment::Container(this->base->renderman, this, pTile, createDataGrid(bbox), yl);
 		}
 
+		bool MetaVoxelFactory::samplesNeighbors() const
+		{
+			return (surfaceFlags & IsoVertexElements::GEN_NORMALS) && _chanopts.normalsType == NT_CentralDifference;
+		}
+
 		IsoSurfaceRenderable * MetaVoxelFactory::createIsoSurfaceRenderable( MetaFragment::Container * const pMWF, const String & sName ) const
 		{
 			oht_assert_threadmodel(ThrMdl_Single);
-			IsoSurfaceRenderable * pISR = new IsoSurfaceRenderable(base->renderman, _pVtxDecl, pMWF, _chanopts.maxGeoMipMapLevel, _chanopts.maxPixelError, sName);
+			IsoSurfaceRenderable * pISR = new IsoSurfaceRenderable(base->renderman, _pVtxDecl, pMWF, _chanopts.maxGeoMipMapLevel, _chanopts.maxPixelError, _chanopts.indexType, sName);
 			pISR->setCastShadows(true);
 			return pISR;
 		}
@@ -131,26 +143,14 @@ namespace Ogre
 			_pCubeMeta(new Voxel::CubeDataRegionDescriptor(opts.tileSize, opts.cellScale)),
 			_options(opts), 
 			_pManRsrcLoader(pManRsrcLoader),
+			_pDBCache(opts.voxelCacheSize > 0 ? new Voxel::DataBaseCache(opts.voxelCacheSize) : NULL),
 			_pVoxelFacts(NULL)
 	{
-		_pISB = new IsoSurfaceBuilder(
-			*_pCubeMeta, 
-			Channel::Index< IsoSurfaceBuilder::ChannelParameters >(
-				opts.channels.descriptor,
-				[opts] (const Channel::Ident channel) -> IsoSurfaceBuilder::ChannelParameters *
-				{
-					const OverhangTerrainOptions::ChannelOptions & chanopts = opts.channels[channel];
-					return new IsoSurfaceBuilder::ChannelParameters(
-						chanopts.transitionCellWidthRatio,
-						IsoSurfaceBuilder::genSurfaceFlags(chanopts),
-						chanopts.maxGeoMipMapLevel,
-						chanopts.maxPixelError,
-						chanopts.flipNormals,
-						chanopts.normals
-					);
-				}
-			)
-		);
+		const DefaultWorkQueueBase * pWorkQueue = dynamic_cast< const DefaultWorkQueueBase * > (Root::getSingleton().getWorkQueue());
+		const size_t nWorkers = pWorkQueue != NULL ? pWorkQueue->getWorkerThreadCount() : boost::thread::hardware_concurrency();
+
+		// One builder for each background worker and one for the main thread (synchronous builds and ray queries)
+		_pISBPool = new IsoSurfaceBuilderPool(*_pCubeMeta, opts, nWorkers + 1);
 
 		MetaBaseFactory * self = this;
 
@@ -165,9 +165,10 @@ namespace Ogre
 
 	MetaBaseFactory::~MetaBaseFactory()
 	{
-		delete _pISB;
+		delete _pISBPool;
 		delete _pCubeMeta;
 		delete _pVoxelFacts;
+		delete _pDBCache;
 	}
 
 	MetaBall * MetaBaseFactory::createMetaBall( const Vector3 & position /*= Vector3::ZERO*/, const Real radius /*= 0.0*/, const bool excavating /*= true*/ ) const
@@ -193,7 +194,7 @@ namespace Ogre
 
 	Voxel::CubeDataRegion * MetaBaseFactory::createCubeDataRegion (const size_t nVRFlags, Voxel::DataBasePool * pPool, const AxisAlignedBox & bbox /*= AxisAlignedBox::BOX_NULL */)
 	{
-		return new Voxel::CubeDataRegion(nVRFlags, pPool, *_pCubeMeta, bbox);
+		return new Voxel::CubeDataRegion(nVRFlags, pPool, *_pCubeMeta, bbox, _pDBCache);
 	}
 
 }
@@ -63,7 +63,7 @@ namespace Ogre
 				Post(pBlock, ylevel),
 
 			factory(pFactory),
-			_pMatInfo(NULL), _nLOD_Requested0(~0), _enStitches_Requested0((Touch3DFlags)~0), _ridBuilderLast(~0)
+			_pMatInfo(NULL), _ridBuilderLast(~0)
 		{
 			memset(_vpNeighbors, 0, sizeof(Container *) * 6);
 		}
@@ -108,6 +108,7 @@ namespace Ogre
 		{ 
 			oht_assert_threadmodel(ThrMdl_Single);
 			_vMetaObjects.push_back(mo); 
+			invalidateMetaObject(mo);
 		}
 
 		bool Core::removeMetaObject( const MetaObject * const mo )
@@ -116,6 +117,8 @@ namespace Ogre
 				if (*i == mo)
 				{
 					_vMetaObjects.erase(i);
+					invalidateMetaObject(mo);
+					_sampled.erase(mo);
 					return true;
 				}
 			return false;
@@ -125,6 +128,102 @@ namespace Ogre
 		{
 			oht_assert_threadmodel(ThrMdl_Single);
 			_vMetaObjects.clear();
+			_sampled.clear();
+
+			const signed int nDim = block->meta.dimensions;
+			_dirty.merge(CellRegion(-1, -1, -1, nDim + 1, nDim + 1, nDim + 1));
+		}
+
+		void Core::invalidateMetaObject( const MetaObject * const mo )
+		{
+			std::map< const MetaObject *, AxisAlignedBox >::const_iterator i = _sampled.find(mo);
+
+			invalidateBox(mo->getAABB());
+			if (i != _sampled.end())
+				invalidateBox(i->second);
+		}
+
+		void Core::invalidateBox( const AxisAlignedBox & bbox )
+		{
+			WorldCellCoords gp0, gpN;
+
+			if (block->mapRegion(bbox, gp0, gpN))
+				_dirty.merge(CellRegion(gp0.i, gp0.j, gp0.k, gpN.i, gpN.j, gpN.k));
+		}
+
+		void Core::resetSurface()
+		{
+			const signed int nDim = block->meta.dimensions;
+
+			// The voxel grid was resampled but no meta-object changed that accounts for it, the whole surface is suspect
+			if (_dirty.isNull())
+			{
+				surface->deleteGeometry();
+				invalidateNeighborHalos(CellRegion(0, 0, 0, nDim, nDim, nDim));
+			}
+			else
+			{
+				surface->invalidateRegion(_dirty);
+				invalidateNeighborHalos(_dirty);
+			}
+
+			_dirty.setNull();
+			_bResetting = false;
+			resetHalo();
+		}
+
+		void Core::resetHalo()
+		{
+			if (!_dirtyHalo.isNull())
+				surface->invalidateRegion(_dirtyHalo);
+
+			_dirtyHalo.setNull();
+		}
+
+		void Core::invalidateNeighborHalos( const CellRegion & voxels )
+		{
+			// Sides of the cube at the low and high end of each axis respectively
+			static const OrthogonalNeighbor sides[3][2] =
+			{
+				{ OrthoN_WEST, OrthoN_EAST },
+				{ OrthoN_BELOW, OrthoN_ABOVE },
+				{ OrthoN_NORTH, OrthoN_SOUTH }
+			};
+
+			if (!factory->samplesNeighbors())
+				return;
+
+			const signed int 
+				nDim = block->meta.dimensions,
+				lo[3] = { voxels.x0, voxels.y0, voxels.z0 },
+				hi[3] = { voxels.xN, voxels.yN, voxels.zN };
+
+			for (unsigned a = 0; a < 3; ++a)
+				for (unsigned h = 0; h < 2; ++h)
+				{
+					Core * pNeighbor = _vpNeighbors[sides[a][h]];
+
+					if (pNeighbor == NULL || pNeighbor->surface == NULL)
+						continue;
+
+					// The neighbour samples the layer of voxels next to the side they share, one layer into this fragment
+					const signed int nLayer = h == 0 ? 1 : nDim - 1;
+
+					if (lo[a] > nLayer || hi[a] < nLayer)
+						continue;
+
+					// Only the central differences at the voxels of its side are affected
+					signed int r0[3], rN[3];
+
+					for (unsigned i = 0; i < 3; ++i)
+					{
+						r0[i] = std::max(lo[i], 0);
+						rN[i] = std::min(hi[i], nDim);
+					}
+					r0[a] = rN[a] = h == 0 ? nDim : 0;
+
+					pNeighbor->_dirtyHalo.merge(CellRegion(r0[0], r0[1], r0[2], rN[0], rN[1], rN[2]));
+				}
 		}
 
 		///Updates IsoSurface
@@ -133,14 +232,12 @@ namespace Ogre
 			oht_assert_threadmodel(ThrMdl_Main);
 			OgreAssert(surface != NULL, "Surface not initialized");
 
-			surface->deleteGeometry();
-			_bResetting = false;
+			resetSurface();
 			if (_ridBuilderLast != ~0)
 				static_cast< Container * > (this) ->tile->page->slot->group->cancelRequest(_ridBuilderLast);
 
 			_ridBuilderLast = ~0;
-			_nLOD_Requested0 = ~0;
-			_enStitches_Requested0 = (Touch3DFlags)~0;
+			_vRequested0.clear();
 		}
 
 		bool Core::generateConfiguration( const unsigned nLOD, const Touch3DFlags enStitches )
@@ -149,19 +246,17 @@ namespace Ogre
 			OgreAssert(surface != NULL, "Surface not initialized");
 
 			if (_bResetting)
-			{
-				surface->deleteGeometry();
-				_bResetting = false;
-			}
+				resetSurface();
+			else
+				resetHalo();
 
 			if (!surface->isConfigurationBuilt(nLOD, enStitches))
 			{
 				OHTDD_Translate(-surface->getWorldBoundingBox(true).getCenter());
 				OHTDD_Coords(OCS_World, OCS_DataGrid);
 
-				factory->base->getIsoSurfaceBuilder()->build(block, surface, nLOD, enStitches);
-				_nLOD_Requested0 = nLOD;
-				_enStitches_Requested0 = enStitches;
+				factory->base->getIsoSurfaceBuilderPool()->lease()->build(block, surface, nLOD, enStitches);
+				_vRequested0.assign(1, HardwareShadow::Configuration(nLOD, enStitches));
 			}
 			return true;
 		}
@@ -172,18 +267,20 @@ namespace Ogre
 			OgreAssert(surface != NULL, "Surface not initialized");
 			Container * self = static_cast< Container * > (this);
 
-			if (_bResetting)
+			// Neighbours that changed beyond the sides leave the normals along those sides stale as well
+			if (_bResetting || !_dirtyHalo.isNull())
 			{
 				OverhangTerrainGroup * grp = self->tile->page->slot->group;
 
-				surface->deleteGeometry();
-				_bResetting = false;
+				if (_bResetting)
+					resetSurface();
+				else
+					resetHalo();
 				if (_ridBuilderLast != ~0)
 					grp->cancelRequest(_ridBuilderLast);
 
 				_ridBuilderLast = ~0;
-				_nLOD_Requested0 = ~0;
-				_enStitches_Requested0 = (Touch3DFlags)~0;
+				_vRequested0.clear();
 			}
 
 			if (!surface->isConfigurationBuilt(nLOD, enStitches))
@@ -193,12 +290,22 @@ namespace Ogre
 				if (lock)
 				{
 					surface->populateBuffers(lock.openQueue());
+					// Configurations of the batch that did not fit are requested again on their own
+					_vRequested0.clear();
 					return true;
 				} else
-				if (_nLOD_Requested0 != nLOD || _enStitches_Requested0 != enStitches)	// IsoSurfaceBuilder is busy, no data available yet
+				if (std::find(_vRequested0.begin(), _vRequested0.end(), HardwareShadow::Configuration(nLOD, enStitches)) == _vRequested0.end())	// IsoSurfaceBuilder is busy, no data available yet
 				{
 					OverhangTerrainGroup * grp = self->tile->page->slot->group;
-					const WorkQueue::RequestID rid = grp->generateSurfaceConfiguration(self, surface, nLOD, enStitches);
+					// Nothing was requested since the surface was loaded or reset, build the adjacent levels of detail from the same lease
+					const HardwareShadow::ConfigurationList configs = 
+						_ridBuilderLast == ~0 
+							? batchConfigurations(nLOD, enStitches) 
+							: HardwareShadow::ConfigurationList(1, HardwareShadow::Configuration(nLOD, enStitches));
+					const WorkQueue::RequestID rid = 
+						configs.size() > 1
+							? grp->generateSurfaceConfigurations(self, surface, configs)
+							: grp->generateSurfaceConfiguration(self, surface, nLOD, enStitches);
 
 					if (rid)
 					{
@@ -206,8 +313,7 @@ namespace Ogre
 							grp->cancelRequest(_ridBuilderLast);
 
 						_ridBuilderLast = rid;
-						_nLOD_Requested0 = nLOD;
-						_enStitches_Requested0 = enStitches;
+						_vRequested0 = configs;
 					}
 				}
 
@@ -216,6 +322,18 @@ namespace Ogre
 				return true;
 		}
 
+		HardwareShadow::ConfigurationList Core::batchConfigurations( const unsigned nLOD, const Touch3DFlags enStitches ) const
+		{
+			HardwareShadow::ConfigurationList configs (1, HardwareShadow::Configuration(nLOD, enStitches));
+
+			if (nLOD + 1 < surface->getNumLevels())
+				configs.push_back(HardwareShadow::Configuration(nLOD + 1, getNeighborFlags(nLOD + 1)));
+			if (nLOD > 0)
+				configs.push_back(HardwareShadow::Configuration(nLOD - 1, getNeighborFlags(nLOD - 1)));
+
+			return configs;
+		}
+
 		DataAccessor::EmptySet Core::updateGrid()
 		{
 			oht_assert_threadmodel(ThrMdl_Background);
@@ -225,7 +343,15 @@ namespace Ogre
 			access.reset();
 			for(MetaObjsList::iterator it = _vMetaObjects.begin(); it != _vMetaObjects.end(); ++it)
 			{
+				const AxisAlignedBox bbox = (*it)->getAABB();
+				std::map< const MetaObject *, AxisAlignedBox >::iterator i = _sampled.find(*it);
+
+				// Meta-objects moved or resized since they were last sampled leave stale voxels at their previous bounds as well as their current ones
+				if (i == _sampled.end() || i->second != bbox)
+					invalidateMetaObject(*it);
+
 				(*it)->updateDataGrid(block, &access);
+				_sampled[*it] = bbox;
 			}
 
 			if (block->hasGradient())
@@ -383,15 +509,20 @@ namespace Ogre
 			return Touch3DFlags(nTransitionFlags);
 		}
 
-		std::pair< bool, Real > Core::rayQuery( const Ray & ray, const Real limit )
+		std::pair< bool, Real > Core::rayQuery( const Ray & ray, const Real limit, const RayQueryMode mode /*= RQM_Triangles*/, const Real tolerance /*= 0*/ )
 		{
 			oht_assert_threadmodel(ThrMdl_Main);
 			OgreAssert(surface != NULL, "Must be initialised before performing a ray query");
 
 			const unsigned nLOD = surface->getEffectiveRenderLevel();
+
+			// The voxel field is interrogated directly without leasing a builder
+			if (mode == RQM_Field)
+				return IsoSurfaceBuilder::rayQueryField(limit, block, ray, nLOD, tolerance);
+
 			const Touch3DFlags t3dFlags = getNeighborFlags(nLOD);
 
-			return factory->base->getIsoSurfaceBuilder()
+			return factory->base->getIsoSurfaceBuilderPool()->lease()
 				->rayQuery(
 					limit,
 					factory->channel,
@@ -31,6 +31,8 @@ http://www.gnu.org/copyleft/lesser.txt.
 
 #include <OgreDataStream.h>
 
+#include <algorithm>
+
 #include "OverhangTerrainGroup.h"
 #include "MetaWorldFragment.h"
 #include "MetaBall.h"
@@ -332,6 +334,12 @@ namespace Ogre
 		case BuildSurface:
 			pOrigin = any_cast< SurfaceGenRequest > (req->getData()).origin;
 			break;
+		case BuildSurfaces:
+			pOrigin = any_cast< SurfaceBatchGenRequest > (req->getData()).origin;
+			break;
+		case QueryRays:
+			pOrigin = any_cast< RayBatchRequest > (req->getData()).origin;
+			break;
 		default:
 			pOrigin = any_cast< WorkRequest > (req->getData()) .origin;
 			break;
@@ -402,12 +410,32 @@ namespace Ogre
 					using namespace HardwareShadow;
 
 					SurfaceGenRequest reqdata = any_cast<SurfaceGenRequest>(req->getData());
-					IsoSurfaceBuilder * pISB = _factory.getIsoSurfaceBuilder();
+					IsoSurfaceBuilderPool::Lease builder = _factory.getIsoSurfaceBuilderPool()->lease();
 
-					pISB->queueBuild(reqdata.mf, reqdata.shadow, reqdata.channel, reqdata.lod, reqdata.surfaceFlags, reqdata.stitches, reqdata.vertexBufferCapacity);
+					builder->queueBuild(reqdata.mf, reqdata.shadow, reqdata.channel, reqdata.lod, reqdata.surfaceFlags, reqdata.stitches, reqdata.vertexBufferCapacity);
 					response  = new WorkQueue::Response(req, true, Any());				
 				}
 				break;
+			case BuildSurfaces:
+				{
+					using namespace HardwareShadow;
+
+					SurfaceBatchGenRequest reqdata = any_cast<SurfaceBatchGenRequest>(req->getData());
+					IsoSurfaceBuilderPool::Lease builder = _factory.getIsoSurfaceBuilderPool()->lease();
+
+					builder->queueBuild(reqdata.mf, reqdata.shadow, reqdata.channel, reqdata.configs, reqdata.surfaceFlags, reqdata.vertexBufferCapacity);
+					response  = new WorkQueue::Response(req, true, Any());				
+				}
+				break;
+			case QueryRays:
+				{
+					RayBatchRequest reqdata = any_cast<RayBatchRequest>(req->getData());
+					RayBatchResponseData respdata;
+					respdata.results = new RayResultList();
+					rayIntersects_worker(reqdata, respdata);
+					response = new WorkQueue::Response(req, true, Any(respdata));
+				}
+				break;
 			}
 		} catch (Exception& e)
 		{
@@ -431,6 +459,12 @@ namespace Ogre
 		case BuildSurface:
 			pOrigin = any_cast< SurfaceGenRequest > (res->getRequest()->getData()) .origin;
 			break;
+		case BuildSurfaces:
+			pOrigin = any_cast< SurfaceBatchGenRequest > (res->getRequest()->getData()) .origin;
+			break;
+		case QueryRays:
+			pOrigin = any_cast< RayBatchRequest > (res->getRequest()->getData()) .origin;
+			break;
 		default:
 			pOrigin = any_cast< WorkRequest > (res->getRequest()->getData()) .origin;
 			break;
@@ -493,9 +527,42 @@ namespace Ogre
 		case BuildSurface:
 			{
 				SurfaceGenRequest lreq = any_cast<SurfaceGenRequest>(res->getRequest()->getData());
+				if (!res->succeeded())
+					LogManager::getSingleton().stream(LML_CRITICAL) <<
+						"We failed to build the surface of terrain at (" << lreq.slot->x << ", " <<
+						lreq.slot->y <<") with the error '" << res->getMessages() << "'";
+				lreq.slot->doneQuery();
+			}
+			break;
+		case BuildSurfaces:
+			{
+				SurfaceBatchGenRequest lreq = any_cast<SurfaceBatchGenRequest>(res->getRequest()->getData());
+				if (!res->succeeded())
+					LogManager::getSingleton().stream(LML_CRITICAL) <<
+						"We failed to build the surfaces of terrain at (" << lreq.slot->x << ", " <<
+						lreq.slot->y <<") with the error '" << res->getMessages() << "'";
 				lreq.slot->doneQuery();
 			}
 			break;
+		case QueryRays:
+			{
+				RayBatchRequest lreq = any_cast<RayBatchRequest>(res->getRequest()->getData());
+				if (res->succeeded())
+				{
+					RayBatchResponseData data = any_cast< RayBatchResponseData > (res->getData());
+					rayIntersects_response(lreq, data.results);
+
+					delete data.results;
+					data.results = NULL;
+				} else
+				{
+					LogManager::getSingleton().stream(LML_CRITICAL) <<
+						"We failed to query rays in terrain at (" << lreq.slot->x << ", " <<
+						lreq.slot->y <<") with the error '" << res->getMessages() << "'";
+					rayIntersects_response(lreq, NULL);
+				}
+			}
+			break;
 		case DestroyAll:
 			clear_response();
 			break;
@@ -547,6 +614,20 @@ namespace Ogre
 				lreq.slot->doneQuery();
 			}
 			break;
+
+		case BuildSurfaces:
+			{
+				SurfaceBatchGenRequest lreq = any_cast<SurfaceBatchGenRequest>(req->getData());
+				lreq.slot->doneQuery();
+			}
+			break;
+
+		case QueryRays:
+			{
+				RayBatchRequest lreq = any_cast<RayBatchRequest>(req->getData());
+				rayIntersects_response(lreq, NULL);
+			}
+			break;
 		}
 	}
 
@@ -943,6 +1024,151 @@ namespace Ogre
 		return result;		
 	}
 
+	OverhangTerrainGroup::RayBatch::RayBatch( const RayList & rays, const OverhangTerrainManager::RayQueryParams & params, IRayQueryListener * pListener )
+		:	rays(rays), params(params), listener(pListener),
+			results(rays.size(), RayResult(false, Vector3::ZERO, NULL)),
+			steps(rays.size(), ~size_t(0)),
+			pending(0)
+	{}
+
+	void OverhangTerrainGroup::rayIntersects( const RayList & rays, const OverhangTerrainManager::RayQueryParams & params, IRayQueryListener * pListener )
+	{
+		oht_assert_threadmodel(ThrMdl_Main);
+		OgreAssert(pListener != NULL, "A listener is required to receive the results of the batch");
+
+		typedef std::map< OverhangTerrainSlot *, RayBatchRequest > RequestMap;
+
+		SharedPtr< RayBatch > pBatch (new RayBatch(rays, params, pListener));
+		RequestMap requests;
+
+		const float fTolerance = std::numeric_limits< Real >::epsilon() * 10000.0f;
+		const Real
+			fTileWorldSize = options.getTileWorldSize(),
+			fPageOffset = options.getPageWorldSize() / 2.0f;
+		const size_t nTPP = options.getTilesPerPage();
+
+		for (size_t r = 0; r < rays.size(); ++r)
+		{
+			Ray ray = rays[r];
+			clamp(ray, fTolerance);
+
+			int16 py, px;
+			OverhangTerrainSlot * pSlot0 = NULL, * pSlot;
+			size_t nStep = 0;
+
+			toSlotPosition(ray.getOrigin(), px, py);
+
+			for (DiscreteRayIterator i = DiscreteRayIterator::from(ray, options.getPageWorldSize(), -Vector3(1, 0, 1) * fPageOffset);
+				i < params.limit;
+				++i
+			)
+			{
+				switch (i.neighbor)
+				{
+				case VonN_NORTH:	++py; break;	// Page-space has y-coordinate flipped
+				case VonN_EAST:		++px; break;
+				case VonN_SOUTH:	--py; break;	// Page-space has y-coordinate flipped
+				case VonN_WEST:		--px; break;
+				default:
+					break;
+				}
+				pSlot = getTerrainSlot(px, py);
+
+				if (pSlot == NULL || pSlot == pSlot0 || pSlot->instance == NULL || !pSlot->canRead())
+					continue;
+
+				RequestMap::iterator j = requests.find(pSlot);
+				if (j == requests.end())
+				{
+					j = requests.insert(RequestMap::value_type(pSlot, RayBatchRequest())).first;
+
+					j->second.origin = this;
+					j->second.slot = pSlot;
+					j->second.batch = pBatch;
+					pSlot->query();
+				}
+
+				RaySegment seg;
+				seg.ray = r;
+				seg.step = nStep++;
+				seg.local = Ray(i.intersection(fTolerance) - pSlot->instance->getPosition(), ray.getDirection());
+				seg.distance = i.distance;
+				{
+					const Vector3 & origin = seg.local.getOrigin();
+					const size_t
+						tx = static_cast< size_t > (std::max(Real(0), std::min(Real(nTPP - 1), floor((origin.x + fPageOffset) / fTileWorldSize)))),
+						tz = static_cast< size_t > (std::max(Real(0), std::min(Real(nTPP - 1), floor((origin.z + fPageOffset) / fTileWorldSize))));
+
+					seg.tile = tz * nTPP + tx;
+				}
+				j->second.segments.push_back(seg);
+
+				pSlot0 = pSlot;
+			}
+		}
+
+		pBatch->pending = requests.size();
+		if (requests.empty())
+		{
+			pListener->rayQueriesFinished(pBatch->rays, pBatch->results);
+			return;
+		}
+
+		for (RequestMap::iterator j = requests.begin(); j != requests.end(); ++j)
+		{
+			std::stable_sort(j->second.segments.begin(), j->second.segments.end());
+
+			Root::getSingleton().getWorkQueue()->addRequest(
+				_nWorkQChannel, static_cast <uint16> (QueryRays), 
+				Any(j->second), 0, false);
+		}
+	}
+
+	void OverhangTerrainGroup::rayIntersects_worker( const RayBatchRequest & reqdata, RayBatchResponseData & respdata )
+	{
+		oht_assert_threadmodel(ThrMdl_Background);
+
+		// Consecutive segments enter the same tiles, keep the voxels of the last few meta-fragments decompressed between them
+		Voxel::ValuesCache copies (8);
+		const OverhangTerrainManager::RayQueryParams & params = reqdata.batch->params;
+
+		respdata.results->reserve(reqdata.segments.size());
+		for (std::vector< RaySegment >::const_iterator i = reqdata.segments.begin(); i != reqdata.segments.end(); ++i)
+		{
+			RayResult result(false, Vector3::ZERO, NULL);
+
+			reqdata.slot->instance->rayIntersects(result, i->local, params, i->distance, &copies);
+			respdata.results->push_back(result);
+		}
+	}
+
+	void OverhangTerrainGroup::rayIntersects_response( const RayBatchRequest & reqdata, const RayResultList * results )
+	{
+		oht_assert_threadmodel(ThrMdl_Main);
+
+		RayBatch & batch = *reqdata.batch;
+
+		if (results != NULL)
+		{
+			for (size_t c = 0; c < reqdata.segments.size(); ++c)
+			{
+				const RaySegment & seg = reqdata.segments[c];
+				const RayResult & result = (*results)[c];
+
+				if (result.hit && seg.step < batch.steps[seg.ray])
+				{
+					batch.results[seg.ray] = result;
+					batch.steps[seg.ray] = seg.step;
+				}
+			}
+		}
+
+		reqdata.slot->doneQuery();
+
+		if (--batch.pending == 0)
+			batch.listener->rayQueriesFinished(batch.rays, batch.results);
+	}
+
 	void OverhangTerrainGroup::toSlotPosition( const Vector3 & pt, int16 & x, int16 & y, const OverhangCoordinateSpace encsPt /*= OCS_World*/ ) const
 	{
 		const Real nPWS = options.getPageWorldSize();
@@ -1075,6 +1301,35 @@ namespace Ogre
 			return 0;
 	}
 
+	WorkQueue::RequestID OverhangTerrainGroup::generateSurfaceConfigurations( MetaFragment::Container * pMF, const IsoSurfaceRenderable * pISR, const HardwareShadow::ConfigurationList & configs )
+	{
+		oht_assert_threadmodel(ThrMdl_Main);
+		OgreAssert(!configs.empty(), "Expected at least one configuration to generate");
+		SurfaceBatchGenRequest reqdata;
+
+		reqdata.origin = this;
+		reqdata.slot = pMF->tile->page->slot;
+
+		if (reqdata.slot->canRead())
+		{
+			reqdata.slot->query();
+
+			reqdata.mf = pMF;
+			const Voxel::MetaVoxelFactory * pFactory = pMF->factory;
+			reqdata.shadow = pISR->getShadow();
+			reqdata.channel = pFactory->channel;
+			reqdata.configs = configs;
+			reqdata.surfaceFlags = pFactory->surfaceFlags;
+			reqdata.vertexBufferCapacity = pISR->getVertexBufferCapacity();
+
+			return 
+				Root::getSingleton().getWorkQueue()->addRequest(
+				_nWorkQChannel, static_cast <uint16> (BuildSurfaces), 
+				Any(reqdata), 0, false);
+		} else
+			return 0;
+	}
+
 	void OverhangTerrainGroup::defineTerrain_dispose( OverhangTerrainSlot* slot )
 	{
 		slot->freeLoadData();
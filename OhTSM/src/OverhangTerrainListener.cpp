@@ -61,7 +61,11 @@ namespace Ogre
 	bool OverhangTerrainMetaCube::hasGradient() const { return _pDataGrid->hasGradient(); }
 	size_t OverhangTerrainMetaCube::getDimensions() const { return _pDataGrid->getDimensions(); }
 
-	Voxel::ColourChannelSet & OverhangTerrainMetaCube::getColours() { return _pDataGridAccess->colours; }
+	Voxel::ColourChannelSet & OverhangTerrainMetaCube::getColours() 
+	{ 
+		_pDataGridAccess->touch(Voxel::DataBase::DBC_Colours);
+		return _pDataGridAccess->colours; 
+	}
 	const Voxel::ColourChannelSet & OverhangTerrainMetaCube::getColours() const { return _pDataGridAccess->colours; }
 	Vector3 OverhangTerrainMetaCube::getCubeSize() const { return _pDataGrid->getBoxSize().getSize(); }
 
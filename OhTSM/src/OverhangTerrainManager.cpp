@@ -282,6 +282,13 @@ namespace Ogre
 			array[c++] = *i;
 	}
 
+	OverhangTerrainManager::RayQueryParams::Channels::Channels( const Channels & copy )
+		: array(copy.array != NULL ? new Channel::Ident[copy.size] : NULL), size(copy.size)
+	{
+		for (size_t c = 0; c < size; ++c)
+			array[c] = copy.array[c];
+	}
+
 	OverhangTerrainManager::RayQueryParams::Channels::~Channels()
 	{
 		delete [] array;
@@ -289,13 +296,13 @@ namespace Ogre
 
 
 	OverhangTerrainManager::RayQueryParams::RayQueryParams( const Real nLimit, const Channels & channels )
-		: limit(nLimit), channels(channels)
+		: limit(nLimit), mode(RQM_Triangles), tolerance(0.01f), channels(channels)
 	{
 
 	}
 
 	OverhangTerrainManager::RayQueryParams::RayQueryParams( const Real nLimit )
-		: limit(nLimit)
+		: limit(nLimit), mode(RQM_Triangles), tolerance(0.01f)
 	{
 
 	}
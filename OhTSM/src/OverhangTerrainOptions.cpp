@@ -93,6 +93,10 @@ namespace Ogre
 		heightScale(1.0f),
 		primaryCamera(NULL),
 		autoSave(true),
+		extractionSlabs(1),
+		buildCacheSize(0),
+		persistMeshes(false),
+		voxelCacheSize(0),
 		materialPerTile(true),
 		channels(Channel::Descriptor(1))
 	{
@@ -105,6 +109,14 @@ namespace Ogre
 		flipNormals(false),
 		transitionCellWidthRatio(0.5f),
 		voxelRegionFlags(VRF_Gradient),
+		optimizeVertexCache(false),
+		compactVertices(false),
+		indexType(HardwareIndexBuffer::IT_16BIT),
+		surfaceNetsLODBegin(0),
+		surfaceNetsLODEnd(0),
+		decimate(false),
+		decimationLOD(2),
+		decimationMaxError(0.05f),
 		qid(RENDER_QUEUE_MAIN)
 	{
 	}
@@ -213,9 +213,13 @@ namespace Ogre
 		const Vector3& dir = mRay.getDirection();
 		const Vector3& origin = mRay.getOrigin();
 
+		// Picking need not be exact to the triangle, the voxel field is intersected directly
+		OverhangTerrainManager::RayQueryParams params = OverhangTerrainManager::RayQueryParams::from(100000);
+		params.mode = RQM_Field;
+
 		OverhangTerrainManager::RayResult result = 
 			static_cast< OverhangTerrainSceneManager* >( mParentSceneMgr ) 
-			-> getTerrainManager() ->rayIntersects(mRay, OverhangTerrainManager::RayQueryParams::from(100000));
+			-> getTerrainManager() ->rayIntersects(mRay, params);
 
 		if (result.hit)
 		{
@@ -42,6 +42,8 @@ Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
 #include "MetaWorldFragment.h"
 #include "MetaBall.h"
 #include "MetaHeightMap.h"
+#include "IsoSurfaceBuilderPool.h"
+#include "BuildCache.h"
 #include "OverhangTerrainManager.h"
 #include "Util.h"
 #include "DebugTools.h"
@@ -49,7 +51,9 @@ Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
 namespace Ogre
 {
 	const uint32 PageSection::CHUNK_ID = StreamSerialiser::makeIdentifier("OHPS");
-	const uint16 PageSection::VERSION = 1;
+	const uint16 PageSection::VERSION = 2;
+	const uint32 PageSection::MESH_CHUNK_ID = StreamSerialiser::makeIdentifier("OHPM");
+	const uint16 PageSection::MESH_VERSION = 2;
 
 	//-------------------------------------------------------------------------
 	PageSection::PageSection(const OverhangTerrainManager * mgr, OverhangTerrainSlot * pSlot, MetaBaseFactory * const pMetaFactory, const Channel::Descriptor & descchann)
@@ -431,11 +435,11 @@ namespace Ogre
 		}
 	}
 
-	bool PageSection::rayIntersects( OverhangTerrainManager::RayResult & result, const Ray& rayPageLocalWorldSpace, const OverhangTerrainManager::RayQueryParams & params, const Real distance ) const
+	bool PageSection::rayIntersects( OverhangTerrainManager::RayResult & result, const Ray& rayPageLocalWorldSpace, const OverhangTerrainManager::RayQueryParams & params, const Real distance, Voxel::ValuesCache * pCopies /*= NULL*/ ) const
 	{
 		OHT_DBGTRACE("\t\tPage BBox test=" << getBoundingBox());
 
-		oht_assert_threadmodel(ThrMdl_Main);
+		oht_assert_threadmodel(pCopies == NULL ? ThrMdl_Main : ThrMdl_Background);
 
 		const TerrainTile * pTile;
 		{
@@ -452,7 +456,7 @@ namespace Ogre
 
 		DiscreteRayIterator i = DiscreteRayIterator(rayPageLocalWorldSpace, manager->options.getTileWorldSize());
 
-		if (pTile->rayIntersects(result, params, distance, i))
+		if (pTile->rayIntersects(result, params, distance, i, pCopies))
 		{
 			OHTDD_Color(DebugDisplay::MC_Turquoise);
 			OHTDD_Line(rayPageLocalWorldSpace.getOrigin(), result.position);
@@ -567,6 +571,41 @@ namespace Ogre
 			output.write(&enmot);
 		}
 
+		// Finished builds of the voxels are stored along with them so that they are replayed instead of extracted when the page is loaded
+		BuildCache * const pBuildCache = _pFactory->getIsoSurfaceBuilderPool()->getBuildCache();
+		const bool bMeshes = manager->options.persistMeshes && pBuildCache != NULL;
+
+		output.write(&bMeshes);
+		if (bMeshes)
+		{
+			BuildCache::EntryVector vEntries;
+
+			for (Channel::Descriptor::iterator j = _descchann.begin(); j != _descchann.end(); ++j)
+				for (MetaFragmentIterator i = MetaFragmentIterator(*j, _pPrivate); i; ++i)
+				{
+					const MetaFragment::Container & mf = *i;
+					auto fragment = mf.acquire< MetaFragment::Interfaces::const_Basic > ();
+
+					// Homogeneous voxels yield no surface and are never cached
+					if (!fragment.block->getOccupancy().homogeneous())
+						pBuildCache->collect(fragment.block->getContentHash(), *j, vEntries);
+				}
+
+			const uint32 
+				nLayout = BuildCache::Entry::getLayout(),
+				nCount = static_cast< uint32 > (vEntries.size());
+
+			output.writeChunkBegin(MESH_CHUNK_ID, MESH_VERSION);
+			output.write(&nLayout);
+			output.write(&nCount);
+			for (BuildCache::EntryVector::const_iterator i = vEntries.begin(); i != vEntries.end(); ++i)
+			{
+				i->first >> output;
+				*i->second >> output;
+			}
+			output.writeChunkEnd(MESH_CHUNK_ID);
+		}
+
 		output.writeChunkEnd(CHUNK_ID);
 
 		return output;
@@ -607,6 +646,40 @@ namespace Ogre
 			this->loadMetaObjects(*j, vMetaObjs);
 		}
 
+		bool bMeshes = false;
+
+		if (input.getCurrentChunk()->version >= 2)
+			input.read(&bMeshes);
+
+		if (bMeshes)
+		{
+			if (!input.readChunkBegin(MESH_CHUNK_ID, MESH_VERSION))
+				OGRE_EXCEPT(Exception::ERR_ITEM_NOT_FOUND, "Stream does not contain PageSection mesh data", __FUNCTION__);
+
+			uint32 nLayout, nCount;
+			BuildCache * const pBuildCache = _pFactory->getIsoSurfaceBuilderPool()->getBuildCache();
+
+			input.read(&nLayout);
+			input.read(&nCount);
+
+			// The builds are retained in the build cache keyed by the content hash of the voxels they were extracted from, so any that 
+			// became stale are never replayed and configurations that were not saved are extracted as usual.  Meta data records 
+			// are read verbatim, builds saved by a binary with another layout are skipped altogether by the end of the chunk.  Keys
+			// saved before the neighbouring voxels were hashed on their own cannot be matched and are skipped as well.
+			if (pBuildCache != NULL && nLayout == BuildCache::Entry::getLayout() && input.getCurrentChunk()->version >= 2)
+				for (uint32 c = 0; c < nCount; ++c)
+				{
+					BuildCache::Key key;
+					BuildCache::EntryPtr pEntry (new BuildCache::Entry);
+
+					key << input;
+					*pEntry << input;
+					pBuildCache->insert(key, pEntry);
+				}
+
+			input.readChunkEnd(MESH_CHUNK_ID);
+		}
+
 		input.readChunkEnd(CHUNK_ID);
 
 		return input;
@@ -27,57 +27,110 @@ Torus Knot Software Ltd.
 */
 #include "pch.h"
 
+#include "OverhangTerrainPrerequisites.h"
+
 #include "RLE.h"
 #include "Util.h"
 
+#include <algorithm>
+
+#if defined(OHT_SIMD_SSE2)
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 namespace Ogre
 {
 	namespace RLE
 	{
+#if defined(OHT_SIMD_SSE2)
+		/// @returns The position of the lowest set bit of a non-zero mask
+		inline static
+		unsigned int lowestBit (const unsigned int mask)
+		{
+#ifdef _MSC_VER
+			unsigned long n;
+			_BitScanForward(&n, mask);
+			return n;
+#else
+			return __builtin_ctz(mask);
+#endif
+		}
+
+		/** Scans for the first position where three equal consecutive bytes begin or cease to begin
+		@remarks This is the test the encoder applies at every position, positions that pass it extend a homogeneous run and 
+			positions that fail it extend a heterogeneous run, so the encoder can skip straight to where the current run may end.
+		@param pcSrc The data being compressed
+		@param nDecompSize Size of the data being compressed
+		@param c Position to begin scanning from
+		@param bTriple True to scan for the first position beginning three equal bytes, false for the first position that doesn't
+		@returns The first such position or the position where the remaining data became too short to scan 16 positions at a time */
+		static
+		size_t scanTriples (const unsigned char * pcSrc, const size_t nDecompSize, size_t c, const bool bTriple)
+		{
+			const unsigned int nInverse = bTriple ? 0 : 0xFFFF;
+
+			// Each block of 16 positions requires 18 bytes
+			for (; c + 18 <= nDecompSize; c += 16)
+			{
+				const __m128i
+					a = _mm_loadu_si128(reinterpret_cast< const __m128i * > (pcSrc + c)),
+					b = _mm_loadu_si128(reinterpret_cast< const __m128i * > (pcSrc + c + 1)),
+					d = _mm_loadu_si128(reinterpret_cast< const __m128i * > (pcSrc + c + 2));
+
+				const unsigned int mask = nInverse ^ static_cast< unsigned int > (
+					_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, b), _mm_cmpeq_epi8(b, d)))
+				);
+
+				if (mask != 0)
+					return c + lowestBit(mask);
+			}
+			return c;
+		}
+#endif
+
 #ifdef _RLECHECK
 	#pragma optimize("", off)
 #endif
 		void Channel::decompress (const size_t nDecompSize, unsigned char * pDest) const
 		{
-			register unsigned int i, j, fb, fh;
+			unsigned int i, fh;
 
 			if (_buffer == NULL)
 				return;
 
-			register unsigned char * pB = _buffer, * pD = pDest;
-			const register unsigned char * pDN = &pDest[nDecompSize];
+			const unsigned char * pB = _buffer;
+			unsigned char * pD = pDest;
+			const unsigned char 
+				* const pBN = &_buffer[_zsize],
+				* const pDN = &pDest[nDecompSize];
 
 			while (pD < pDN)
 			{
-				j = *pB++;
-				fh = j & Flag_Heterogenous;
-				fb = j & Flag_Bigger;
-				j ^= fb;
-				i = j;
+				pB = readRun(pB, i, fh);
 
-				if (fb != 0)
+#if defined(OHT_SIMD_SSE2)
+				// Short runs are written as a whole vector, the excess is overwritten by the runs that follow
+				if (i <= 16 && pDN - pD >= 16)
 				{
-					j = *pB++;
-					fb = j & Flag_Bigger;
-					j ^= fb;
-					i |= j << PRECISION;
-
-					if (fb != 0)
+					if (fh == 0)
 					{
-						j = *pB++;
-						fb = j & Flag_Bigger;
-						j ^= fb;
-						i |= j << PRECISION * 2;
-
-						if (fb != 0)
-						{
-							j = *pB++;
-							i |= j << PRECISION * 3;
-						}
+						_mm_storeu_si128(reinterpret_cast< __m128i * > (pD), _mm_set1_epi8(static_cast< char > (*pB++)));
+						pD += i;
+						continue;
+					} else
+					if (pBN - pB >= 16)
+					{
+						_mm_storeu_si128(reinterpret_cast< __m128i * > (pD), _mm_loadu_si128(reinterpret_cast< const __m128i * > (pB)));
+						pB += i;
+						pD += i;
+						continue;
 					}
 				}
+#endif
 
-				i >>= 1;
 				if (fh != 0)
 				{
 #ifdef _RLECHECK
@@ -145,10 +198,20 @@ namespace Ogre
 			size_t d = 0, c = 0;
 
 			i = 0;
-			_zsize = nDecompSize / 10;
+			// Never start empty, the single-byte append can't grow an empty buffer by doubling it
+			_zsize = std::max< size_t > (nDecompSize / 10, 16);
 			_buffer = reinterpret_cast< unsigned char * > (realloc(_buffer, _zsize));
 			while (c < nDecompSize)
 			{
+#if defined(OHT_SIMD_SSE2)
+				// Skip the positions that merely extend the current run, the scalar test below only sees those that may end it
+				if (enfMode != Flag_Neither)
+				{
+					const size_t cN = scanTriples(pcSrc, nDecompSize, c, enfMode == Flag_Heterogenous);
+					i += static_cast< unsigned int > (cN - c);
+					c = cN;
+				}
+#endif
 				const size_t
 					c1 = c+1, 
 					c2 = c+2;
@@ -203,10 +266,87 @@ namespace Ogre
 
 			_zsize = d;
 			_buffer = reinterpret_cast< unsigned char * > (realloc(_buffer, _zsize));
+
+			buildIndex();
 		}
 
-		Channel::Channel() 
-		: _buffer(NULL), _zsize(0)
+		void Channel::decompress( const size_t nDecompSize, const size_t nFirst, const size_t nCount, unsigned char * pDest ) const
+		{
+#ifdef _RLECHECK
+			if (nFirst + nCount > nDecompSize)
+				throw BufferOverflowEx("Range exceeds the decompressed size");
+#endif
+			if (_buffer == NULL || nCount == 0)
+				return;
+
+			const unsigned char * pB = _buffer;
+			const size_t nLast = nFirst + nCount;
+			size_t d = 0;
+
+			// Resume from the last indexed run that starts at or before the range
+			if (!_index.empty())
+			{
+				Index::const_iterator i = std::upper_bound(_index.begin(), _index.end(), nFirst, 
+					[] (const size_t nOffset, const IndexEntry & entry) { return nOffset < entry.decompressed; }
+				);
+
+				if (i != _index.begin())
+				{
+					--i;
+					pB += i->compressed;
+					d = i->decompressed;
+				}
+			}
+
+			unsigned int nLength, fh;
+			while (d < nLast)
+			{
+				pB = readRun(pB, nLength, fh);
+
+				const size_t dN = d + nLength;
+				if (dN > nFirst)
+				{
+					const size_t
+						a = std::max(d, nFirst),
+						b = std::min(dN, nLast);
+
+					if (fh != 0)
+						memcpy(&pDest[a - nFirst], &pB[a - d], b - a);
+					else
+						memset(&pDest[a - nFirst], *pB, b - a);
+				}
+
+				pB += fh != 0 ? nLength : 1;
+				d = dN;
+			}
+		}
+
+		void Channel::buildIndex()
+		{
+			_index.clear();
+
+			if (_nIndexInterval == 0 || _buffer == NULL)
+				return;
+
+			const unsigned char 
+				* pB = _buffer,
+				* const pBN = &_buffer[_zsize];
+			size_t d = 0, nRun = 0;
+			unsigned int nLength, fh;
+
+			while (pB < pBN)
+			{
+				if (nRun++ % _nIndexInterval == 0)
+					_index.push_back(IndexEntry(static_cast< uint32 > (d), static_cast< uint32 > (pB - _buffer)));
+
+				pB = readRun(pB, nLength, fh);
+				pB += fh != 0 ? nLength : 1;
+				d += nLength;
+			}
+		}
+
+		Channel::Channel(const size_t nIndexInterval /*= 0*/) 
+		: _buffer(NULL), _zsize(0), _nIndexInterval(nIndexInterval)
 			{}
 
 		Channel::~Channel()
@@ -214,6 +354,21 @@ namespace Ogre
 			free(_buffer);
 		}
 
+		unsigned long long Channel::computeCRC() const
+		{
+			const size_t nQWords = _zsize / sizeof(unsigned long long);
+			unsigned long long v = _zsize;
+
+			if (nQWords > 0)
+				v += ::computeCRC(reinterpret_cast< const unsigned long long * > (_buffer), nQWords);
+
+			// Trailing bytes that do not fill a QWord
+			for (size_t i = nQWords * sizeof(unsigned long long); i < _zsize; ++i)
+				v = v * 31 + _buffer[i];
+
+			return v;
+		}
+
 		StreamSerialiser & Channel::operator>>( StreamSerialiser & outs ) const
 		{
 			outs.write(&_zsize);
@@ -228,6 +383,8 @@ namespace Ogre
 			_buffer = (unsigned char *)realloc(_buffer, _zsize);
 			ins.read(_buffer, _zsize);
 
+			buildIndex();
+
 			return ins;
 		}
 
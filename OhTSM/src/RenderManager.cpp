@@ -65,20 +65,26 @@ namespace Ogre
 	bool RenderManager::checkBuffers( const IndexData * pIdxData, const HardwareVertexBufferSharedPtr pHWVtxB, VertexDeclaration * pVtxDecl, const float fScale )
 	{
 		const VertexElement * pElemPos = pVtxDecl->findElementBySemantic(VES_POSITION);
+
+		// Compact positions are quantized, there is nothing to check
+		if (pElemPos->getType() != VET_FLOAT3)
+			return true;
+
 		const size_t nVtxSize = pVtxDecl->getVertexSize(0);
 		float * pf;
 		const float fMaxDist = sqrtf(3*fScale*fScale)*4;
 
 		unsigned char * pVtxB = (unsigned char *)pHWVtxB->lock(HardwareBuffer::HBL_READ_ONLY);
-		uint16 * pIdxB = (uint16*)pIdxData->indexBuffer->lock(HardwareBuffer::HBL_READ_ONLY);
+		void * pIdxB = pIdxData->indexBuffer->lock(HardwareBuffer::HBL_READ_ONLY);
+		const bool b32Bit = pIdxData->indexBuffer->getType() == HardwareIndexBuffer::IT_32BIT;
 		bool bResult = true;
 
 		for (size_t i = pIdxData->indexStart; i < pIdxData->indexCount; i += 3)
 		{
-			const uint16 
-				a = pIdxB[i+0],
-				b = pIdxB[i+1],
-				c = pIdxB[i+2];
+			const uint32 
+				a = b32Bit ? static_cast< uint32 * > (pIdxB)[i+0] : static_cast< uint16 * > (pIdxB)[i+0],
+				b = b32Bit ? static_cast< uint32 * > (pIdxB)[i+1] : static_cast< uint16 * > (pIdxB)[i+1],
+				c = b32Bit ? static_cast< uint32 * > (pIdxB)[i+2] : static_cast< uint16 * > (pIdxB)[i+2];
 
 			Vector3 va;
 			pElemPos->baseVertexPointerToElement(pVtxB + a * nVtxSize, &pf);
@@ -0,0 +1,147 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#include "pch.h"
+
+#include "SlabWorkers.h"
+
+#include <algorithm>
+
+namespace Ogre
+{
+	SlabWorkers::SlabWorkers( const size_t nThreads, const size_t nConcurrency )
+		: _nBusy(0), _nConcurrency(std::max(nConcurrency, size_t(1))), _bStop(false)
+	{
+		for (size_t c = 0; c < nThreads; ++c)
+			_threads.create_thread([this] () { work(); });
+	}
+
+	SlabWorkers::~SlabWorkers()
+	{
+		{ boost::mutex::scoped_lock lock(_mutex);
+			OgreAssert(_jobs.empty(), "Cannot deconstruct slab workers, there are still slabs in progress");
+			_bStop = true;
+		}
+		_cvWork.notify_all();
+		_threads.join_all();
+	}
+
+	void SlabWorkers::run( const size_t nSlabs, const SlabFunction & fn )
+	{
+		Job job (fn, nSlabs);
+		size_t s;
+
+		{ boost::mutex::scoped_lock lock(_mutex);
+			if (nSlabs > 1)
+			{
+				_jobs.push_back(&job);
+				_cvWork.notify_all();
+			}
+		}
+
+		// The calling thread runs whatever the workers do not claim, it is already counted as busy
+		for (;;)
+		{
+			{ boost::mutex::scoped_lock lock(_mutex);
+				if (!claim(&job, s))
+					break;
+			}
+
+			fn(s);
+
+			{ boost::mutex::scoped_lock lock(_mutex);
+				finish(&job);
+			}
+		}
+
+		boost::mutex::scoped_lock lock(_mutex);
+		while (job.done < job.count)
+			job.cvDone.wait(lock);
+	}
+
+	void SlabWorkers::occupy()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		++_nBusy;
+	}
+
+	void SlabWorkers::vacate()
+	{
+		{ boost::mutex::scoped_lock lock(_mutex);
+			--_nBusy;
+		}
+		_cvWork.notify_one();
+	}
+
+	bool SlabWorkers::claim( Job * pJob, size_t & s )
+	{
+		if (pJob->next >= pJob->count)
+			return false;
+
+		s = pJob->next++;
+		if (pJob->next == pJob->count && pJob->count > 1)
+			_jobs.remove(pJob);
+
+		return true;
+	}
+
+	void SlabWorkers::finish( Job * pJob )
+	{
+		if (++pJob->done == pJob->count)
+			pJob->cvDone.notify_all();
+	}
+
+	void SlabWorkers::work()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+
+		for (;;)
+		{
+			while (!_bStop && (_jobs.empty() || _nBusy >= _nConcurrency))
+				_cvWork.wait(lock);
+
+			if (_bStop)
+				break;
+
+			Job * pJob = _jobs.front();
+			size_t s;
+
+			claim(pJob, s);
+			++_nBusy;
+
+			lock.unlock();
+			pJob->fn(s);
+			lock.lock();
+
+			--_nBusy;
+			finish(pJob);
+			// Another worker may now fit under the concurrency limit
+			_cvWork.notify_one();
+		}
+	}
+}
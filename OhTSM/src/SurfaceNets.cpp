@@ -0,0 +1,111 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#include "pch.h"
+
+#include "SurfaceNets.h"
+
+namespace Ogre
+{
+	SurfaceNets::SurfaceNets( const Voxel::CubeDataRegionDescriptor & cubemeta )
+		: _cubemeta(cubemeta)
+	{
+		size_t o = 0;
+
+		_vOffsets.push_back(o);
+		for (unsigned l = 0; (cubemeta.dimensions >> l) > 0; ++l)
+		{
+			o += span(l) * span(l) * span(l);
+			_vOffsets.push_back(o);
+		}
+	}
+
+	size_t SurfaceNets::computeTotalElements( const Voxel::CubeDataRegionDescriptor & cubemeta )
+	{
+		size_t nTotal = 0;
+
+		for (unsigned l = 0; (cubemeta.dimensions >> l) > 0; ++l)
+		{
+			const size_t n = (cubemeta.dimensions >> l) + 2;
+			nTotal += n*n*n;
+		}
+
+		return nTotal;
+	}
+
+	SurfaceNets::Box SurfaceNets::box( const unsigned nLOD, const Cell & cell ) const
+	{
+		const signed short 
+			n = static_cast< signed short >(_cubemeta.dimensions >> nLOD),
+			s = static_cast< signed short >(1 << nLOD);
+		const signed short coords[3] = { cell.x, cell.y, cell.z };
+		DimensionType lo[3], hi[3];
+
+		for (unsigned a = 0; a < 3; ++a)
+		{
+			OgreAssert(coords[a] >= -1 && coords[a] <= n, "Cell out of bounds");
+
+			// Virtual cells beyond either side collapse onto it
+			if (coords[a] < 0)
+				lo[a] = hi[a] = 0;
+			else if (coords[a] >= n)
+				lo[a] = hi[a] = _cubemeta.dimensions;
+			else
+			{
+				lo[a] = DimensionType(coords[a] * s);
+				hi[a] = DimensionType(lo[a] + s);
+			}
+		}
+
+		const Box result = { lo[0], lo[1], lo[2], hi[0], hi[1], hi[2] };
+		return result;
+	}
+
+	SurfaceNets::Cell SurfaceNets::coarsen( const unsigned nLOD, const Cell & cell ) const
+	{
+		const signed short 
+			n = static_cast< signed short >(_cubemeta.dimensions >> nLOD),
+			n1 = static_cast< signed short >(_cubemeta.dimensions >> (nLOD + 1));
+		const signed short coords[3] = { cell.x, cell.y, cell.z };
+		signed short q[3];
+
+		OgreAssert(nLOD + 1 < lodCount(), "Level of detail exceeds lowest allowed");
+		for (unsigned a = 0; a < 3; ++a)
+		{
+			if (coords[a] < 0)
+				q[a] = -1;
+			else if (coords[a] >= n)
+				q[a] = n1;
+			else
+				q[a] = coords[a] >> 1;
+		}
+
+		const Cell result = { q[0], q[1], q[2] };
+		return result;
+	}
+}
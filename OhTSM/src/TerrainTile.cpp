@@ -34,6 +34,7 @@ http://www.gnu.org/copyleft/lesser.txt.
 #include "TerrainTile.h"
 #include "PageSection.h"
 #include "IsoSurfaceRenderable.h"
+#include "IsoSurfaceBuilder.h"
 #include "MetaBall.h"
 #include "MetaHeightmap.h"
 #include "MetaWorldFragment.h"
@@ -213,9 +214,9 @@ namespace Ogre
 		}
 	}
 
-	bool TerrainTile::rayIntersects( OverhangTerrainManager::RayResult & result, const OverhangTerrainManager::RayQueryParams & params, const Real distance, DiscreteRayIterator & i) const
+	bool TerrainTile::rayIntersects( OverhangTerrainManager::RayResult & result, const OverhangTerrainManager::RayQueryParams & params, const Real distance, DiscreteRayIterator & i, Voxel::ValuesCache * pCopies /*= NULL*/ ) const
 	{
-		oht_assert_threadmodel(ThrMdl_Main);
+		oht_assert_threadmodel(pCopies == NULL ? ThrMdl_Main : ThrMdl_Background);
 		const int nCellsPerCube = (int)_options.tileSize-1;
 		struct Registers
 		{
@@ -243,8 +244,6 @@ namespace Ogre
 		);
 		const Voxel::CubeDataRegionDescriptor * pMeta = _pPage->getFactory().getCubeDataRegionDescriptor();
 		const Real fHalfCellSize = (Real)pMeta->scale / 2.0f;
-		const Real fHalfCubeDimension = (Real)pMeta->dimensions / 2.0f;
-		const Real fLittleBitty = 1.0f / (Real)Voxel::FS_Span;
 
 		do
 		{
@@ -280,50 +279,56 @@ namespace Ogre
 				// Can only perform query step if there is a meta-fragment for the current ray iteration
 				if (r.mf != NULL)
 				{
-					// Lock the meta-fragment for query
-					auto fragment = r.mf->acquire < MetaFragment::Interfaces::Unique > ();
-
-					// Test the intersection on the current fragment
+					std::pair< bool, Real > intersection2;
+					MetaFragment::Container * pNext = NULL;
+					
+					if (pCopies == NULL)
+					{
+						// Lock the meta-fragment for query
+						auto fragment = r.mf->acquire < MetaFragment::Interfaces::Unique > ();
+
+						// Test the intersection on the current fragment
+						rayCubeRelDataGridSpace.setOrigin(computeFragmentOrigin(fragment.ylevel, i0.intersection));
+						intersection2 =
+							fragment.rayQuery(
+								rayCubeRelDataGridSpace,
+								(params.limit - i0.distance) / _options.cellScale,
+								params.mode,
+								params.tolerance / _options.cellScale
+							);
+
+						if (!(i.neighbor < CountVonNeumannNeighbors))
+							pNext = fragment.neighbor(i.neighbor);
+					} else
 					{
-						Vector3
-							// Terrain-tile BBox intersection point relative to page
-							origin = i0.intersection;
-
-						// Translate the intersection point so it's relative to the first would-be meta-cube
-						const Vector3 base = getYLevelBounds(fragment.ylevel, OCS_World).getCenter();
-						origin -= base;
-						OverhangTerrainManager::transformSpace(OCS_World, _options.alignment, OCS_DataGrid, origin, _options.cellScale);
-
-						OHTDD_Cube(getYLevelBounds(fragment.ylevel, OCS_World));
-						OHTDD_Color(DebugDisplay::MC_Yellow);
-
-						// Clamp intersection point start to boundaries
-						origin.makeFloor(Vector3::ZERO + fHalfCubeDimension - fLittleBitty);
-						origin.makeCeil(Vector3::ZERO - fHalfCubeDimension + fLittleBitty);
-
-						// Update ray origin in data-grid space with origin relative to the first would-be meta-cube intersected
-						rayCubeRelDataGridSpace.setOrigin(origin);
-
-						OHTDD_Translate(-base);
-						OHTDD_Scale(1.0f / _options.cellScale);
-
-						std::pair< bool, Real >
-							intersection2 =
-								fragment.rayQuery(
-									rayCubeRelDataGridSpace,
-									(params.limit - i0.distance) / _options.cellScale
-								);
-
-						result.hit = intersection2.first;
-						result.position = i0.intersection(intersection2.second * _options.cellScale);
-						result.mwf = const_cast< MetaFragment::Container * > (r.mf);
+						// Batched queries only read the voxels, they share the lock on the meta-fragment with one another
+						auto fragment = r.mf->acquire < MetaFragment::Interfaces::Shared > ();
+
+						// Batched queries always intersect the voxel field at full resolution, they do not depend on the current level of detail
+						rayCubeRelDataGridSpace.setOrigin(computeFragmentOrigin(fragment.ylevel, i0.intersection));
+						intersection2 =
+							IsoSurfaceBuilder::rayQueryField(
+								(params.limit - i0.distance) / _options.cellScale,
+								fragment.block,
+								rayCubeRelDataGridSpace,
+								0,
+								params.tolerance / _options.cellScale,
+								fragment.block->getOccupancy().homogeneous() ? NULL : pCopies->values(fragment.block)
+							);
+
+						if (!(i.neighbor < CountVonNeumannNeighbors))
+							pNext = const_cast< MetaFragment::Container * > (fragment.neighbor(i.neighbor));
 					}
 
+					result.hit = intersection2.first;
+					result.position = i0.intersection(intersection2.second * _options.cellScale);
+					result.mwf = const_cast< MetaFragment::Container * > (r.mf);
+
 					if (result.hit)
 						return true;
 
 					if (!(i.neighbor < CountVonNeumannNeighbors))
-						r.mf = fragment.neighbor(i.neighbor);
+						r.mf = pNext;
 				} else
 				{
 					OHTDD_Color(DebugDisplay::MC_Yellow);
@@ -335,7 +340,7 @@ namespace Ogre
 			{
 				const TerrainTile * pNeighbor = _vpInternalNeighbors[i.neighbor];
 				if (pNeighbor != NULL)
-					return pNeighbor->rayIntersects(result, params, distance, i);
+					return pNeighbor->rayIntersects(result, params, distance, i, pCopies);
 				else
 					return false;
 			}
@@ -352,6 +357,34 @@ namespace Ogre
 		return result.hit;
 	}
 
+	Vector3 TerrainTile::computeFragmentOrigin( const YLevel yl, const Vector3 & intersection ) const
+	{
+		const Voxel::CubeDataRegionDescriptor * pMeta = _pPage->getFactory().getCubeDataRegionDescriptor();
+		const Real fHalfCubeDimension = (Real)pMeta->dimensions / 2.0f;
+		const Real fLittleBitty = 1.0f / (Real)Voxel::FS_Span;
+
+		Vector3
+			// Terrain-tile BBox intersection point relative to page
+			origin = intersection;
+
+		// Translate the intersection point so it's relative to the first would-be meta-cube
+		const Vector3 base = getYLevelBounds(yl, OCS_World).getCenter();
+		origin -= base;
+		OverhangTerrainManager::transformSpace(OCS_World, _options.alignment, OCS_DataGrid, origin, _options.cellScale);
+
+		OHTDD_Cube(getYLevelBounds(yl, OCS_World));
+		OHTDD_Color(DebugDisplay::MC_Yellow);
+
+		// Clamp intersection point start to boundaries
+		origin.makeFloor(Vector3::ZERO + fHalfCubeDimension - fLittleBitty);
+		origin.makeCeil(Vector3::ZERO - fHalfCubeDimension + fLittleBitty);
+
+		OHTDD_Translate(-base);
+		OHTDD_Scale(1.0f / _options.cellScale);
+
+		return origin;
+	}
+
 	MetaFragment::Container * TerrainTile::acquireMetaWorldFragment( const Channel::Ident channel, const YLevel yl )
 	{
 		oht_assert_threadmodel(ThrMdl_Single);
@@ -0,0 +1,231 @@
+/*
+-----------------------------------------------------------------------------
+This source file is part of the OverhangTerrainSceneManager
+Plugin for OGRE
+For the latest info, see http://www.ogre3d.org/
+
+Copyright (c) 2007 Martin Enge
+martin.enge@gmail.com
+
+Modified (2013) by Jonathan Neufeld (http://www.extollit.com) to implement Transvoxel
+Transvoxel conceived by Eric Lengyel (http://www.terathon.com/voxels/)
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU Lesser General Public License as published by the Free Software
+Foundation; either version 2 of the License, or (at your option) any later
+version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with
+this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+Place - Suite 330, Boston, MA 02111-1307, USA, or go to
+http://www.gnu.org/copyleft/lesser.txt.
+
+-----------------------------------------------------------------------------
+*/
+#include "pch.h"
+
+#include "VertexCacheOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Ogre
+{
+	float VertexCacheOptimizer::score( const int nCachePosition, const unsigned nRemaining )
+	{
+		static const float
+			CacheDecayPower = 1.5f,
+			LastTriangleScore = 0.75f,
+			ValenceBoostScale = 2.0f,
+			ValenceBoostPower = 0.5f;
+
+		// No triangles left, the vertex no longer matters
+		if (nRemaining == 0)
+			return -1.0f;
+
+		float fScore = 0.0f;
+
+		if (nCachePosition >= 0)
+		{
+			// Vertices of the triangle just emitted are scored the same regardless of their order so there is no favoured direction
+			if (nCachePosition < 3)
+				fScore = LastTriangleScore;
+			else
+			{
+				OgreAssert(nCachePosition < int(CacheSize), "Cache position out of bounds");
+				const float fScaler = 1.0f / float(CacheSize - 3);
+				fScore = std::pow(1.0f - float(nCachePosition - 3) * fScaler, CacheDecayPower);
+			}
+		}
+
+		// Vertices with few triangles left are favoured so that they are retired and do not linger as lone triangles
+		return fScore + ValenceBoostScale * std::pow(float(nRemaining), -ValenceBoostPower);
+	}
+
+	void VertexCacheOptimizer::optimize( const HWVertexIndex * pIndices, const size_t nTriangleCount, const size_t nVertexCount, std::vector< size_t > & vOrder )
+	{
+		vOrder.clear();
+		if (nTriangleCount == 0)
+			return;
+
+		vOrder.reserve(nTriangleCount);
+
+		const size_t nIndexCount = nTriangleCount * 3;
+
+		// The vertex state only grows, only the vertices referenced by the triangle list are initialized
+		if (_vVertices.size() < nVertexCount)
+			_vVertices.resize(nVertexCount);
+
+		for (size_t i = 0; i < nIndexCount; ++i)
+		{
+			Vertex & v = _vVertices[pIndices[i]];
+			v.remaining = 0;
+			v.cached = -1;
+		}
+		for (size_t i = 0; i < nIndexCount; ++i)
+			++_vVertices[pIndices[i]].remaining;
+
+		// Adjacency ranges of the vertices in the order they are first referenced
+		size_t nOffset = 0;
+		for (size_t i = 0; i < nIndexCount; ++i)
+		{
+			Vertex & v = _vVertices[pIndices[i]];
+
+			if (v.cached == -1)
+			{
+				v.adjacency = nOffset;
+				nOffset += v.remaining;
+				v.score = score(-1, v.remaining);
+				v.remaining = 0;
+				v.cached = -2;	// Visited
+			}
+		}
+
+		_vAdjacency.resize(nIndexCount);
+		for (size_t t = 0; t < nTriangleCount; ++t)
+			for (unsigned c = 0; c < 3; ++c)
+			{
+				Vertex & v = _vVertices[pIndices[t * 3 + c]];
+				_vAdjacency[v.adjacency + v.remaining++] = t;
+			}
+
+		_vTriangleScores.resize(nTriangleCount);
+		_vEmitted.assign(nTriangleCount, false);
+
+		size_t nBest = 0;
+		for (size_t t = 0; t < nTriangleCount; ++t)
+		{
+			for (unsigned c = 0; c < 3; ++c)
+				_vVertices[pIndices[t * 3 + c]].cached = -1;
+
+			_vTriangleScores[t] = 
+				_vVertices[pIndices[t * 3 + 0]].score + 
+				_vVertices[pIndices[t * 3 + 1]].score + 
+				_vVertices[pIndices[t * 3 + 2]].score;
+
+			if (_vTriangleScores[t] > _vTriangleScores[nBest])
+				nBest = t;
+		}
+
+		// Simulated LRU cache, it overflows by up to three entries while the vertices of a triangle are pushed to the front
+		HWVertexIndex vCache[CacheSize + 3];
+		size_t nCached = 0;
+		// Triangles that are not emitted yet lie beyond this point when looking for a new start after a dead-end
+		size_t nCursor = 0;
+
+		while (vOrder.size() < nTriangleCount)
+		{
+			if (nBest == size_t(~0))
+			{
+				// Dead-end, none of the cached vertices have any triangles left
+				while (_vEmitted[nCursor])
+					++nCursor;
+				nBest = nCursor;
+			}
+
+			vOrder.push_back(nBest);
+			_vEmitted[nBest] = true;
+
+			const HWVertexIndex * pTriangle = &pIndices[nBest * 3];
+			HWVertexIndex vNext[CacheSize + 3];
+			size_t nNext = 0;
+
+			for (unsigned c = 0; c < 3; ++c)
+			{
+				Vertex & v = _vVertices[pTriangle[c]];
+
+				// Retire the triangle from the vertex's adjacency range
+				size_t * pBegin = &_vAdjacency[v.adjacency], * pEnd = pBegin + v.remaining;
+				std::iter_swap(std::find(pBegin, pEnd, nBest), pEnd - 1);
+				--v.remaining;
+
+				vNext[nNext++] = pTriangle[c];
+			}
+			for (size_t i = 0; i < nCached; ++i)
+				if (vCache[i] != pTriangle[0] && vCache[i] != pTriangle[1] && vCache[i] != pTriangle[2])
+					vNext[nNext++] = vCache[i];
+
+			// Re-score every vertex whose cache position changed, including those evicted from the cache
+			for (size_t i = 0; i < nNext; ++i)
+			{
+				Vertex & v = _vVertices[vNext[i]];
+
+				v.cached = i < CacheSize ? int(i) : -1;
+				v.score = score(v.cached, v.remaining);
+			}
+
+			nBest = size_t(~0);
+			float fBestScore = -1.0f;
+			for (size_t i = 0; i < nNext; ++i)
+			{
+				const Vertex & v = _vVertices[vNext[i]];
+
+				for (size_t j = v.adjacency; j < v.adjacency + v.remaining; ++j)
+				{
+					const size_t t = _vAdjacency[j];
+					const float fScore = 
+						_vVertices[pIndices[t * 3 + 0]].score + 
+						_vVertices[pIndices[t * 3 + 1]].score + 
+						_vVertices[pIndices[t * 3 + 2]].score;
+
+					_vTriangleScores[t] = fScore;
+					if (fScore > fBestScore)
+					{
+						fBestScore = fScore;
+						nBest = t;
+					}
+				}
+			}
+
+			nCached = std::min(nNext, size_t(CacheSize));
+			std::copy(vNext, vNext + nCached, vCache);
+		}
+	}
+
+	size_t VertexCacheOptimizer::countCacheMisses( const HWVertexIndex * pIndices, const size_t nTriangleCount, const size_t nCacheSize /*= 16*/ )
+	{
+		std::vector< HWVertexIndex > vFIFO (nCacheSize, HWVertexIndex(~0));
+		size_t nHead = 0, nMisses = 0;
+
+		for (const HWVertexIndex * pIndex = pIndices, * pEnd = pIndices + nTriangleCount * 3; pIndex != pEnd; ++pIndex)
+		{
+			if (std::find(vFIFO.begin(), vFIFO.end(), *pIndex) == vFIFO.end())
+			{
+				vFIFO[nHead] = *pIndex;
+				nHead = (nHead + 1) % nCacheSize;
+				++nMisses;
+			}
+		}
+
+		return nMisses;
+	}
+
+	Real VertexCacheOptimizer::computeACMR( const HWVertexIndex * pIndices, const size_t nTriangleCount, const size_t nCacheSize /*= 16*/ )
+	{
+		return nTriangleCount > 0 ? Real(countCacheMisses(pIndices, nTriangleCount, nCacheSize)) / Real(nTriangleCount) : 0;
+	}
+}
@@ -0,0 +1,42 @@
+#ifndef __TESTHARNESS_H__
+#define __TESTHARNESS_H__
+
+#include <OverhangTerrainPrerequisites.h>
+
+#include <vector>
+
+using namespace Ogre;
+
+/** A named group of checks registered with the harness during static initialization, 
+	every registered test is run once in the order it was registered */
+class TestCase
+{
+public:
+	typedef void (* Function) ();
+
+	/// Name of the test reported with its failures
+	const char * const name;
+	/// Performs the checks of the test
+	const Function function;
+
+	TestCase(const char * szName, const Function fn);
+
+	/// Retrieves all registered tests
+	static std::vector< TestCase * > & getRegistry();
+};
+
+/// Records the outcome of a single check, failures are reported along with the source location of the check
+void check(const bool bPassed, const char * szExpression, const char * szFile, const int nLine);
+
+/// Defines and registers a test
+#define OHT_TEST(name) \
+	static void name (); \
+	static TestCase name##_case (#name, &name); \
+	static void name ()
+
+/// Checks that an expression holds
+#define OHT_CHECK(expr) check((expr), #expr, __FILE__, __LINE__)
+/// Checks that two real values differ by no more than the specified tolerance
+#define OHT_CHECK_CLOSE(a, b, tolerance) check(Math::Abs(Real(a) - Real(b)) <= Real(tolerance), #a " == " #b, __FILE__, __LINE__)
+
+#endif
@@ -0,0 +1,195 @@
+#include <OverhangTerrainPageInitParams.h>
+#include <MetaFactory.h>
+#include <MetaWorldFragment.h>
+#include <MetaBall.h>
+#include <CubeDataRegion.h>
+#include <CubeDataRegionDescriptor.h>
+#include <HardwareIsoVertexShadow.h>
+#include <IsoSurfaceBuilder.h>
+#include <IsoSurfaceBuilderPool.h>
+#include <BuildCache.h>
+
+#include <OgreDataStream.h>
+#include <OgreStreamSerialiser.h>
+
+#include "TestHarness.h"
+
+using namespace Ogre::HardwareShadow;
+
+namespace
+{
+	/// Options of small pages of a single tile with three levels of detail and a build cache
+	OverhangTerrainOptions createOptions ()
+	{
+		OverhangTerrainOptions options;
+
+		options.pageSize = options.tileSize = 17;
+		options.channels[TERRAIN_ENTITY_CHANNEL].maxGeoMipMapLevel = 3;
+		options.buildCacheSize = 16 * 1024 * 1024;
+		return options;
+	}
+
+	/// A cube of the terrain channel with a single ball of solid in the middle
+	MetaFragment::Container * createBall (MetaBaseFactory & factory)
+	{
+		const Voxel::CubeDataRegionDescriptor & cubemeta = *factory.getCubeDataRegionDescriptor();
+		const Real fExtent = Real(cubemeta.dimensions) * cubemeta.scale;
+		MetaFragment::Container * pMF = factory.getVoxelFactory(TERRAIN_ENTITY_CHANNEL) ->createMetaFragment(
+			NULL,
+			AxisAlignedBox(Vector3(-fExtent / 2), Vector3(fExtent / 2))
+		);
+		Voxel::CubeDataRegion * pBlock = pMF->acquire< MetaFragment::Interfaces::Basic >().block;
+		Voxel::DataAccessor data = pBlock->lease();
+		MetaBall ball (Vector3::ZERO, fExtent * 0.3f, false);
+
+		data.reset();
+		ball.updateDataGrid(pBlock, &data);
+		if (pBlock->hasGradient())
+			data.updateGradient();
+
+		return pMF;
+	}
+
+	/// Batches the pending configuration of the shadow the way the renderable does, without any hardware buffers
+	void consume (HardwareIsoVertexShadow & shadow, const unsigned nLOD)
+	{
+		HardwareIsoVertexShadow::ConsumerLock lock = shadow.requestConsumerLock(nLOD, T3DS_None);
+
+		OHT_CHECK(lock);
+		if (lock)
+			lock.openQueue().consume();
+	}
+
+	/// Retrieves the number of vertices in the hardware vertex buffer of the shadow
+	size_t countVertices (HardwareIsoVertexShadow & shadow)
+	{
+		return shadow.requestReadOnlyAccess(0).meshOp.nextVertexIndex();
+	}
+}
+
+OHT_TEST(BuildCacheReplaysAfterReloadAndLODPingPong)
+{
+	MetaBaseFactory factory (NULL, createOptions(), NULL);
+	IsoSurfaceBuilderPool * pPool = factory.getIsoSurfaceBuilderPool();
+	MetaFragment::Container * pMF = createBall(factory);
+	const size_t 
+		nCapacity = factory.getCubeDataRegionDescriptor()->gpcount * 3,
+		nSurfaceFlags = pMF->factory->surfaceFlags;
+	ConfigurationList batch;
+
+	batch.push_back(Configuration(0, T3DS_None));
+	batch.push_back(Configuration(1, T3DS_None));
+
+	// The first request after a page is loaded builds adjacent levels of detail from the same lease
+	{
+		SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(3));
+
+		pPool->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, batch, nSurfaceFlags, nCapacity);
+		consume(*pShadow, 0);
+
+		const IsoSurfaceBuilderPool::Statistics stats = pPool->getStatistics();
+
+		OHT_CHECK(stats.builds == 1);
+		OHT_CHECK(stats.replays == 0);
+		OHT_CHECK(stats.buildCacheEntries == 2);
+	}
+
+	// The page is reloaded, every configuration of the batch is replayed on its own without extracting anything
+	pPool->resetStatistics();
+	{
+		SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(3));
+
+		pPool->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 1, nSurfaceFlags, T3DS_None, nCapacity);
+		consume(*pShadow, 1);
+
+		const size_t nCoarse = countVertices(*pShadow);
+
+		OHT_CHECK(nCoarse > 0);
+
+		// Switching to the finer level of detail and back appends to the vertices of the coarser one rather than starting over
+		pPool->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 0, nSurfaceFlags, T3DS_None, nCapacity);
+		consume(*pShadow, 0);
+
+		const size_t nBoth = countVertices(*pShadow);
+
+		OHT_CHECK(nBoth > nCoarse);
+
+		pPool->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 1, nSurfaceFlags, T3DS_None, nCapacity);
+		consume(*pShadow, 1);
+
+		// Every iso-vertex of the coarser level of detail is already in the vertex buffer
+		OHT_CHECK(countVertices(*pShadow) == nBoth);
+
+		const IsoSurfaceBuilderPool::Statistics stats = pPool->getStatistics();
+
+		OHT_CHECK(stats.builds == 0);
+		OHT_CHECK(stats.replays == 3);
+		OHT_CHECK(stats.buildCacheHits == 3);
+		OHT_CHECK(stats.buildCacheMisses == 0);
+	}
+
+	delete pMF;
+}
+
+OHT_TEST(BuildCacheRoundTripsWithThePage)
+{
+	DataStreamPtr stream (OGRE_NEW MemoryDataStream(4 * 1024 * 1024));
+	uint32 nCount = 0;
+
+	// The meshes of the page are saved along with its voxels the way the page section does
+	{
+		MetaBaseFactory factory (NULL, createOptions(), NULL);
+		IsoSurfaceBuilderPool * pPool = factory.getIsoSurfaceBuilderPool();
+		MetaFragment::Container * pMF = createBall(factory);
+		SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(3));
+		BuildCache::EntryVector vEntries;
+		StreamSerialiser output (stream);
+
+		pPool->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 0, pMF->factory->surfaceFlags, T3DS_None, factory.getCubeDataRegionDescriptor()->gpcount * 3);
+		pPool->getBuildCache()->collect(pMF->acquire< MetaFragment::Interfaces::const_Basic >().block->getContentHash(), TERRAIN_ENTITY_CHANNEL, vEntries);
+
+		OHT_CHECK(vEntries.size() == 1);
+
+		nCount = static_cast< uint32 > (vEntries.size());
+		for (BuildCache::EntryVector::const_iterator i = vEntries.begin(); i != vEntries.end(); ++i)
+		{
+			i->first >> output;
+			*i->second >> output;
+		}
+
+		delete pMF;
+	}
+
+	// The page is loaded by another session and its mesh is replayed without extracting anything
+	stream->seek(0);
+	{
+		MetaBaseFactory factory (NULL, createOptions(), NULL);
+		IsoSurfaceBuilderPool * pPool = factory.getIsoSurfaceBuilderPool();
+		StreamSerialiser input (stream);
+
+		for (uint32 c = 0; c < nCount; ++c)
+		{
+			BuildCache::Key key;
+			BuildCache::EntryPtr pEntry (new BuildCache::Entry);
+
+			key << input;
+			*pEntry << input;
+			pPool->getBuildCache()->insert(key, pEntry);
+		}
+
+		MetaFragment::Container * pMF = createBall(factory);
+		SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(3));
+
+		pPool->resetStatistics();
+		pPool->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 0, pMF->factory->surfaceFlags, T3DS_None, factory.getCubeDataRegionDescriptor()->gpcount * 3);
+		consume(*pShadow, 0);
+
+		const IsoSurfaceBuilderPool::Statistics stats = pPool->getStatistics();
+
+		OHT_CHECK(stats.builds == 0);
+		OHT_CHECK(stats.replays == 1);
+		OHT_CHECK(countVertices(*pShadow) > 0);
+
+		delete pMF;
+	}
+}
@@ -0,0 +1,128 @@
+#include <OgreMath.h>
+
+#include <CubeDataRegionDescriptor.h>
+#include <HardwareIsoVertexShadow.h>
+
+#include "TestHarness.h"
+
+using namespace Ogre::Voxel;
+using namespace Ogre::HardwareShadow;
+
+namespace
+{
+	/// Decodes an octahedral-encoded normal the way a vertex program would
+	Vector3 decodeNormal (const BuilderQueue::CompactVertexElement & vtxelem)
+	{
+		const Real
+			u = Real(vtxelem.normal[0]) / Real(32767),
+			v = Real(vtxelem.normal[1]) / Real(32767),
+			z = 1 - Math::Abs(u) - Math::Abs(v);
+		Vector3 n (u, v, z);
+
+		if (z < 0)
+		{
+			n.x = (1 - Math::Abs(v)) * (u < 0 ? -1 : +1);
+			n.y = (1 - Math::Abs(u)) * (v < 0 ? -1 : +1);
+		}
+		n.normalise();
+		return n;
+	}
+}
+
+OHT_TEST(CompactPositionsRestoreEveryGridPoint)
+{
+	const CubeDataRegionDescriptor cubemeta (17, 2.5f);
+	const Real 
+		fCompactScale = Real(1) / Real(cubemeta.dimensions),
+		fPositionScale = BuilderQueue::CompactVertexElement::getPositionScale(cubemeta.dimensions, cubemeta.scale);
+
+	// Grid points span the entire cube from its minimal corner to its maximal one
+	const IsoFixVec3 * pVertices = cubemeta.getVertices();
+	for (size_t i = 0; i < cubemeta.gpcount; ++i)
+	{
+		const IsoFixVec3 & pt = pVertices[i];
+		const Vector3 vExpected = Vector3(Real(pt.x), Real(pt.y), Real(pt.z)) * cubemeta.scale;
+
+		BuilderQueue::CompactVertexElement vtxelem;
+		vtxelem.setPosition(Vector3(Real(pt.x), Real(pt.y), Real(pt.z)) * fCompactScale);
+
+		// Restored the way the renderable's world transform does, within one quantization step
+		OHT_CHECK_CLOSE(Real(vtxelem.position[0]) * fPositionScale, vExpected.x, fPositionScale);
+		OHT_CHECK_CLOSE(Real(vtxelem.position[1]) * fPositionScale, vExpected.y, fPositionScale);
+		OHT_CHECK_CLOSE(Real(vtxelem.position[2]) * fPositionScale, vExpected.z, fPositionScale);
+		OHT_CHECK(vtxelem.position[3] == 1);
+	}
+}
+
+OHT_TEST(CompactPositionsSpanTheSignedRange)
+{
+	BuilderQueue::CompactVertexElement vtxelem;
+	const int16 nRange = BuilderQueue::CompactVertexElement::PositionRange;
+
+	vtxelem.setPosition(Vector3(-0.5f, 0, +0.5f));
+	OHT_CHECK(vtxelem.position[0] == -nRange);
+	OHT_CHECK(vtxelem.position[1] == 0);
+	OHT_CHECK(vtxelem.position[2] == +nRange);
+	OHT_CHECK(vtxelem.getPosition() == Vector3(-0.5f, 0, +0.5f));
+
+	// Vertices of the negative half of the cube keep their sign
+	vtxelem.setPosition(Vector3(-0.25f, -0.125f, -1.0f / 32767));
+	OHT_CHECK(vtxelem.position[0] < 0 && vtxelem.position[1] < 0 && vtxelem.position[2] < 0);
+	OHT_CHECK(vtxelem.position[0] < vtxelem.position[1] && vtxelem.position[1] < vtxelem.position[2]);
+
+	// Positions beyond the cube are clamped to its faces
+	vtxelem.setPosition(Vector3(-4, +4, 0));
+	OHT_CHECK(vtxelem.position[0] == -nRange);
+	OHT_CHECK(vtxelem.position[1] == +nRange);
+}
+
+OHT_TEST(CompactNormalsDecodeOctahedrally)
+{
+	const Vector3 vNormals[] = 
+	{
+		Vector3::UNIT_X, Vector3::NEGATIVE_UNIT_X,
+		Vector3::UNIT_Y, Vector3::NEGATIVE_UNIT_Y,
+		Vector3::UNIT_Z, Vector3::NEGATIVE_UNIT_Z,
+		Vector3(1, 1, 1).normalisedCopy(), Vector3(-1, 2, -3).normalisedCopy(), Vector3(3, -1, -2).normalisedCopy()
+	};
+
+	for (size_t i = 0; i < sizeof(vNormals) / sizeof(vNormals[0]); ++i)
+	{
+		BuilderQueue::CompactVertexElement vtxelem;
+		vtxelem.setNormal(vNormals[i]);
+
+		const Vector3 n = decodeNormal(vtxelem);
+		OHT_CHECK(n.dotProduct(vNormals[i]) > 0.9999f);
+	}
+}
+
+OHT_TEST(CompactGridPositionsRestoreTheCubeExtents)
+{
+	const CubeDataRegionDescriptor cubemeta (33, 0.75f);
+	const Real 
+		fPositionScale = BuilderQueue::CompactVertexElement::getPositionScale(cubemeta.dimensions, cubemeta.scale),
+		fHalfSize = Real(cubemeta.dimensions) * cubemeta.scale / 2;
+
+	// Encoded from grid positions the way the builder stages vertices and the renderable writes them
+	const IsoFixVec3 
+		& vfMin = cubemeta.getVertices()[0],
+		& vfMax = cubemeta.getVertices()[cubemeta.gpcount - 1];
+	const IsoFixVec3 vfExtent = IsoFixVec3(signed short(1), signed short(1), signed short(1)) * signed short (cubemeta.dimensions) / signed short (2);
+
+	OHT_CHECK(Vector3(vfMin) == -Vector3(vfExtent));
+	OHT_CHECK(Vector3(vfMax) == Vector3(vfExtent));
+
+	BuilderQueue::CompactVertexElement vtxelem;
+
+	vtxelem.setPosition(vfMin, cubemeta.dimensions);
+	for (unsigned c = 0; c < 3; ++c)
+		OHT_CHECK_CLOSE(Real(vtxelem.position[c]) * fPositionScale, -fHalfSize, 1e-4f);
+
+	vtxelem.setPosition(vfMax, cubemeta.dimensions);
+	for (unsigned c = 0; c < 3; ++c)
+		OHT_CHECK_CLOSE(Real(vtxelem.position[c]) * fPositionScale, +fHalfSize, 1e-4f);
+
+	// The decoded cube agrees with the bounding box of the region descriptor
+	OHT_CHECK_CLOSE(cubemeta.getBoxSize().getMinimum().x, -fHalfSize, 1e-4f);
+	OHT_CHECK_CLOSE(cubemeta.getBoxSize().getMaximum().x, +fHalfSize, 1e-4f);
+}
@@ -0,0 +1,145 @@
+#include <CubeDataRegion.h>
+#include <CubeDataRegionDescriptor.h>
+#include <DataBase.h>
+
+#include <vector>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+using namespace Ogre::Voxel;
+
+namespace
+{
+	/// Deterministic voxel values of either sign that differ from one seed to the next
+	FieldStrength pattern (const size_t i, const size_t nSeed)
+	{
+		return FieldStrength(signed int((i * 37 + nSeed * 101) % 255) - 127);
+	}
+
+	/// Writes the pattern to every voxel of the region through a lease and flags the values as modified
+	void write (CubeDataRegion & region, const size_t nSeed)
+	{
+		DataAccessor data = region.lease();
+
+		for (size_t i = 0; i < data.count; ++i)
+			data.values[i] = pattern(i, nSeed);
+		data.touch(DataBase::DBC_Values);
+	}
+
+	/// Whether the values of the region read without leasing it match the pattern
+	bool matches (const CubeDataRegion & region, const size_t nSeed)
+	{
+		const DimensionType d = region.meta.dimensions;
+		std::vector< FieldStrength > values (region.meta.gpcount);
+
+		region.extractValues(0, 0, 0, d, d, d, &values[0]);
+		for (size_t i = 0; i < values.size(); ++i)
+			if (values[i] != pattern(i, nSeed))
+				return false;
+
+		return true;
+	}
+}
+
+OHT_TEST(DataBaseCacheCommitsDirtyResidentsWhenEvicted)
+{
+	const CubeDataRegionDescriptor cubemeta (17, 1.0f);
+	DataBasePool pool (cubemeta.gpcount, 0);
+	const size_t nBytes = DataBase(cubemeta.gpcount, 0).size();
+
+	// Room for one resident region only
+	DataBaseCache cache (nBytes + nBytes / 2);
+	CubeDataRegion
+		a (0, &pool, cubemeta, AxisAlignedBox::BOX_NULL, &cache),
+		b (0, &pool, cubemeta, AxisAlignedBox::BOX_NULL, &cache);
+	size_t nHits, nMisses, nEvictions, nResidents, nCached;
+
+	// The modifications stay resident and uncompressed but are read back all the same
+	write(a, 1);
+	OHT_CHECK(matches(a, 1));
+	cache.getStatistics(nHits, nMisses, nEvictions, nResidents, nCached);
+	OHT_CHECK(nMisses == 1 && nResidents == 1 && nEvictions == 0);
+
+	write(a, 2);
+	cache.getStatistics(nHits, nMisses, nEvictions, nResidents, nCached);
+	OHT_CHECK(nHits == 1 && nMisses == 1);
+
+	// Admitting the other region evicts the first one, which must compress its last modifications on the way out
+	write(b, 3);
+	cache.getStatistics(nHits, nMisses, nEvictions, nResidents, nCached);
+	OHT_CHECK(nEvictions == 1 && nResidents == 1 && nCached == nBytes);
+	OHT_CHECK(matches(a, 2));
+	OHT_CHECK(matches(b, 3));
+	OHT_CHECK(a.getValue(16, 16, 16) == pattern(cubemeta.gpcount - 1, 2));
+}
+
+OHT_TEST(DataBaseCacheCommitsDirtyResidentsForTheContentHash)
+{
+	const CubeDataRegionDescriptor cubemeta (17, 1.0f);
+	DataBasePool pool (cubemeta.gpcount, 0);
+	DataBaseCache cache (1 << 20);
+	CubeDataRegion
+		resident (0, &pool, cubemeta, AxisAlignedBox::BOX_NULL, &cache),
+		transient (0, &pool, cubemeta);
+
+	// The transient region compresses its modifications on release, the resident one only once its compressed form is needed
+	write(resident, 4);
+	write(transient, 4);
+	OHT_CHECK(resident.getContentHash() == transient.getContentHash());
+
+	write(resident, 5);
+	OHT_CHECK(resident.getContentHash() != transient.getContentHash());
+	write(transient, 5);
+	OHT_CHECK(resident.getContentHash() == transient.getContentHash());
+}
+
+OHT_TEST(DataBaseCachePassesOverLeasedResidents)
+{
+	const CubeDataRegionDescriptor cubemeta (17, 1.0f);
+	DataBasePool pool (cubemeta.gpcount, 0);
+	const size_t nBytes = DataBase(cubemeta.gpcount, 0).size();
+	DataBaseCache cache (nBytes + nBytes / 2);
+	CubeDataRegion
+		a (0, &pool, cubemeta, AxisAlignedBox::BOX_NULL, &cache),
+		b (0, &pool, cubemeta, AxisAlignedBox::BOX_NULL, &cache);
+	size_t nHits, nMisses, nEvictions, nResidents, nCached;
+
+	write(a, 6);
+	{
+		// The cache overflows rather than evict a region that is still leased
+		DataAccessor data = a.lease();
+		write(b, 7);
+		cache.getStatistics(nHits, nMisses, nEvictions, nResidents, nCached);
+		OHT_CHECK(nEvictions == 0 && nResidents == 2 && nCached == 2 * nBytes);
+	}
+
+	write(b, 8);
+	cache.getStatistics(nHits, nMisses, nEvictions, nResidents, nCached);
+	OHT_CHECK(nEvictions == 1 && nResidents == 1);
+	OHT_CHECK(matches(a, 6));
+	OHT_CHECK(matches(b, 8));
+}
+
+OHT_TEST(DataBaseCacheLeasesOnlyTheRequestedChannels)
+{
+	const CubeDataRegionDescriptor cubemeta (17, 1.0f);
+	DataBasePool pool (cubemeta.gpcount, VRF_Colours);
+	CubeDataRegion region (VRF_Colours, &pool, cubemeta);
+
+	write(region, 9);
+	{
+		// Channels that were not requested are withheld rather than left undefined
+		const const_DataAccessor data = static_cast< const CubeDataRegion & > (region).lease(DataBase::DBC_Values);
+
+		OHT_CHECK(data.channels == DataBase::DBC_Values);
+		OHT_CHECK(data.colours.r == NULL);
+		OHT_CHECK(data.values[0] == pattern(0, 9));
+	}
+	{
+		const const_DataAccessor data = static_cast< const CubeDataRegion & > (region).lease(DataBase::DBC_Colours);
+
+		OHT_CHECK(data.channels == (DataBase::DBC_Values | DataBase::DBC_Colours));
+		OHT_CHECK(data.colours.r != NULL);
+	}
+}
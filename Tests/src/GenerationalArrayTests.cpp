@@ -0,0 +1,37 @@
+#include <Util.h>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+
+OHT_TEST(GenerationalArrayReadsNeverTag)
+{
+	GenerationalArray< unsigned int > array (8, ~0U);
+
+	// Reading through a non-const array must not make the element current
+	OHT_CHECK(array[3] == ~0U);
+	array.touch(3) = 7;
+	OHT_CHECK(array[3] == 7);
+	OHT_CHECK(array[4] == ~0U);
+
+	array.clear();
+	OHT_CHECK(array[3] == ~0U);
+
+	// Touching a stale element resets it to the default value before handing it out
+	OHT_CHECK(array.touch(3) == ~0U);
+	array.set(5, 11);
+	OHT_CHECK(array[5] == 11);
+	OHT_CHECK(array.touch(5) == 11);
+}
+
+OHT_TEST(GenerationalArraySurvivesGenerationWrapAround)
+{
+	GenerationalArray< int > array (4, -1);
+
+	array.set(2, 42);
+	for (size_t c = 0; c < 0x10000; ++c)
+		array.clear();
+
+	for (size_t i = 0; i < array.count; ++i)
+		OHT_CHECK(array[i] == -1);
+}
@@ -0,0 +1,103 @@
+#include <OverhangTerrainPageInitParams.h>
+#include <MetaFactory.h>
+#include <MetaWorldFragment.h>
+#include <CubeDataRegion.h>
+#include <CubeDataRegionDescriptor.h>
+#include <HardwareIsoVertexShadow.h>
+#include <IsoSurfaceBuilder.h>
+#include <IsoSurfaceBuilderPool.h>
+
+#include "TestHarness.h"
+
+using namespace Ogre::HardwareShadow;
+
+namespace
+{
+	/// Options of pages of a single tile of 64^3 cells with hardware indices of the specified width
+	OverhangTerrainOptions createOptions (const HardwareIndexBuffer::IndexType enIndexType)
+	{
+		OverhangTerrainOptions options;
+
+		options.pageSize = options.tileSize = 65;
+		options.channels[TERRAIN_ENTITY_CHANNEL].maxGeoMipMapLevel = 1;
+		options.channels[TERRAIN_ENTITY_CHANNEL].indexType = enIndexType;
+		return options;
+	}
+
+	/// A cube of the terrain channel filled with noise, nearly every cell has a surface
+	MetaFragment::Container * createNoise (MetaBaseFactory & factory)
+	{
+		const Voxel::CubeDataRegionDescriptor & cubemeta = *factory.getCubeDataRegionDescriptor();
+		const Real fExtent = Real(cubemeta.dimensions) * cubemeta.scale;
+		MetaFragment::Container * pMF = factory.getVoxelFactory(TERRAIN_ENTITY_CHANNEL) ->createMetaFragment(
+			NULL,
+			AxisAlignedBox(Vector3(-fExtent / 2), Vector3(fExtent / 2))
+		);
+		Voxel::CubeDataRegion * pBlock = pMF->acquire< MetaFragment::Interfaces::Basic >().block;
+		Voxel::DataAccessor data = pBlock->lease();
+		uint32 nSeed = 0x2545F491;
+
+		for (size_t i = 0; i < data.count; ++i)
+		{
+			nSeed = nSeed * 1664525 + 1013904223;
+			data.values[i] = Voxel::FieldStrength(signed int((nSeed >> 16) % 255) - 127);
+		}
+		data.touch(Voxel::DataBase::DBC_Values);
+		if (pBlock->hasGradient())
+			data.updateGradient();
+
+		return pMF;
+	}
+}
+
+OHT_TEST(LargeCubeAddressesEveryGridPoint)
+{
+	MetaBaseFactory factory (NULL, createOptions(HardwareIndexBuffer::IT_32BIT), NULL);
+	const Voxel::CubeDataRegionDescriptor & cubemeta = *factory.getCubeDataRegionDescriptor();
+
+	OHT_CHECK(cubemeta.gpcount == 65 * 65 * 65);
+	OHT_CHECK(cubemeta.getGridPointIndex(64, 64, 64) == cubemeta.gpcount - 1);
+
+	GridPointCoords gpc;
+	cubemeta.computeGridPoint(gpc, VoxelIndex(uint32(cubemeta.gpcount - 1)));
+	OHT_CHECK(gpc.i == 64 && gpc.j == 64 && gpc.k == 64);
+}
+
+OHT_TEST(LargeCubeBuildsPastSixteenBitIndices)
+{
+	MetaBaseFactory factory (NULL, createOptions(HardwareIndexBuffer::IT_32BIT), NULL);
+	MetaFragment::Container * pMF = createNoise(factory);
+	SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(1));
+
+	factory.getIsoSurfaceBuilderPool()->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 0, pMF->factory->surfaceFlags, T3DS_None, factory.getCubeDataRegionDescriptor()->gpcount * 3);
+	{
+		HardwareIsoVertexShadow::ConsumerLock lock = pShadow->requestConsumerLock(0, T3DS_None);
+
+		OHT_CHECK(lock);
+		if (lock)
+			lock.openQueue().consume();
+	}
+	OHT_CHECK(pShadow->requestReadOnlyAccess(0).meshOp.nextVertexIndex() > MaxHWVertices16);
+
+	delete pMF;
+}
+
+OHT_TEST(LargeCubeRefusesToOverflowSixteenBitIndices)
+{
+	MetaBaseFactory factory (NULL, createOptions(HardwareIndexBuffer::IT_16BIT), NULL);
+	MetaFragment::Container * pMF = createNoise(factory);
+	SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(1));
+	bool bThrown = false;
+
+	try
+	{
+		factory.getIsoSurfaceBuilderPool()->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, 0, pMF->factory->surfaceFlags, T3DS_None, factory.getCubeDataRegionDescriptor()->gpcount * 3);
+	}
+	catch (const Exception &)
+	{
+		bThrown = true;
+	}
+	OHT_CHECK(bThrown);
+
+	delete pMF;
+}
@@ -0,0 +1,87 @@
+#include <OgreVector3.h>
+
+#include <MeshDecimator.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+
+namespace
+{
+	/// Number of quads along either side of the grid
+	const size_t GridQuads = 8;
+
+	/// A flat grid of quads two triangles each in the xz-plane, vertices are numbered row by row
+	void createGrid (std::vector< Vector3 > & vPositions, std::vector< size_t > & vIndices)
+	{
+		const size_t nRow = GridQuads + 1;
+
+		for (size_t j = 0; j < nRow; ++j)
+			for (size_t i = 0; i < nRow; ++i)
+				vPositions.push_back(Vector3(Real(i), 0, Real(j)));
+
+		for (size_t j = 0; j < GridQuads; ++j)
+			for (size_t i = 0; i < GridQuads; ++i)
+			{
+				const size_t v0 = j * nRow + i;
+				const size_t triangles[6] = { v0, v0 + nRow, v0 + 1, v0 + 1, v0 + nRow, v0 + nRow + 1 };
+
+				vIndices.insert(vIndices.end(), triangles, triangles + 6);
+			}
+	}
+
+	/// Whether the vertex lies on the outline of the grid
+	bool isBorder (const size_t v)
+	{
+		const size_t i = v % (GridQuads + 1), j = v / (GridQuads + 1);
+
+		return i == 0 || j == 0 || i == GridQuads || j == GridQuads;
+	}
+}
+
+OHT_TEST(MeshDecimatorCollapsesFlatGrid)
+{
+	std::vector< Vector3 > vPositions;
+	std::vector< size_t > vIndices;
+
+	createGrid(vPositions, vIndices);
+
+	const size_t nTriangles = vIndices.size() / 3;
+	const std::vector< bool > vLocked (vPositions.size(), false);
+	MeshDecimator decimator;
+	const MeshDecimator::Result result = decimator.decimate(&vPositions[0], vLocked, vIndices, Real(1e-4));
+
+	// Every interior vertex of a plane collapses without error
+	OHT_CHECK(vIndices.size() % 3 == 0);
+	OHT_CHECK(vIndices.size() / 3 < nTriangles);
+	OHT_CHECK(result.collapses > 0);
+	OHT_CHECK(result.maxError < Real(1e-4));
+}
+
+OHT_TEST(MeshDecimatorKeepsLockedAndBorderVertices)
+{
+	std::vector< Vector3 > vPositions;
+	std::vector< size_t > vIndices;
+
+	createGrid(vPositions, vIndices);
+
+	// The centre of the grid is locked as the vertices on the sides of a cube are
+	const size_t nCentre = (GridQuads / 2) * (GridQuads + 1) + GridQuads / 2;
+	std::vector< bool > vLocked (vPositions.size(), false);
+	vLocked[nCentre] = true;
+
+	MeshDecimator decimator;
+	decimator.decimate(&vPositions[0], vLocked, vIndices, Real(1e-4));
+
+	// Collapses never move a vertex, those retained are still referenced by the triangles that remain
+	for (size_t v = 0; v < vPositions.size(); ++v)
+		if (isBorder(v) || vLocked[v])
+			OHT_CHECK(std::find(vIndices.begin(), vIndices.end(), v) != vIndices.end());
+
+	// No triangle degenerates
+	for (size_t t = 0; t < vIndices.size(); t += 3)
+		OHT_CHECK(vIndices[t] != vIndices[t + 1] && vIndices[t + 1] != vIndices[t + 2] && vIndices[t] != vIndices[t + 2]);
+}
@@ -0,0 +1,183 @@
+#include <RLE.h>
+
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+
+namespace
+{
+	typedef std::vector< unsigned char > Bytes;
+
+	/// Appends a run header the way the encoder does, seven bits at a time with the high bit flagging another byte
+	void referenceCounter (Bytes & out, unsigned int i, const unsigned int fInverse)
+	{
+		i = (i << 1) | fInverse;
+		for (unsigned c = 0; c < 4; ++c)
+		{
+			const unsigned int j = i >> 7;
+
+			out.push_back(static_cast< unsigned char > ((i & 0x7F) | (j != 0 ? 0x80 : 0)));
+			if (j == 0)
+				break;
+			i = j;
+		}
+	}
+
+	/// Portable scalar encoder of the original release, the vectorized encoder must produce exactly the same bytes
+	Bytes referenceCompress (const Bytes & src)
+	{
+		enum { Homogenous = 0, Heterogenous = 1, Neither = 2 } mode = Neither;
+		const size_t n = src.size();
+		unsigned int i = 0;
+		size_t c = 0;
+		Bytes out;
+
+		while (c < n)
+		{
+			if (c + 1 >= n || src[c] != src[c + 1] || c + 2 >= n || src[c + 1] != src[c + 2])
+			{
+				if (mode == Homogenous && c > 0)
+				{
+					referenceCounter(out, i, Homogenous);
+					i = 0;
+					--c;
+					out.push_back(src[c]);
+					c += 3;
+					if (c >= n)
+						--c;
+				}
+				mode = Heterogenous;
+			} else
+			{
+				if (mode == Heterogenous && c > 0)
+				{
+					referenceCounter(out, i, Heterogenous);
+					out.insert(out.end(), src.begin() + (c - i), src.begin() + c);
+					i = 0;
+				}
+				if (mode != Homogenous)
+					i += 2;
+				mode = Homogenous;
+			}
+			++i;
+			++c;
+		}
+		if (mode == Homogenous)
+		{
+			referenceCounter(out, i, Homogenous);
+			out.push_back(src[c - 1]);
+		} else if (mode == Heterogenous)
+		{
+			referenceCounter(out, i, Heterogenous);
+			out.insert(out.end(), src.begin() + (c - i), src.begin() + c);
+		}
+		return out;
+	}
+
+	/// Generates data mixing homogeneous and heterogeneous runs of random lengths up to the specified one
+	Bytes generate (const size_t n, const size_t nMaxRun)
+	{
+		Bytes src (n);
+		size_t i = 0;
+
+		while (i < n)
+		{
+			const size_t nRun = 1 + rand() % nMaxRun;
+			const unsigned char v = static_cast< unsigned char > (rand() % 3);
+			const bool bHeterogenous = rand() % 2 != 0;
+
+			for (size_t k = 0; k < nRun && i < n; ++k, ++i)
+				src[i] = bHeterogenous ? static_cast< unsigned char > (rand() % 4) : v;
+		}
+		return src;
+	}
+
+	/// Checks that the channel encodes exactly like the reference and restores the data without writing past its end
+	void checkRoundTrip (const Bytes & src)
+	{
+		static const size_t Guard = 32;
+		RLE::Channel channel;
+
+		channel.compress(src.size(), &src[0]);
+
+		const Bytes expected = referenceCompress(src);
+		OHT_CHECK(channel.getCompressedSize() == expected.size());
+		OHT_CHECK(channel.getCompressedSize() == expected.size() && memcmp(channel.getCompressedData(), &expected[0], expected.size()) == 0);
+
+		Bytes restored (src.size() + Guard, 0xCD);
+		channel.decompress(src.size(), &restored[0]);
+		OHT_CHECK(std::equal(src.begin(), src.end(), restored.begin()));
+
+		// The vectorized decoder may only overwrite bytes of the same buffer that later runs write again
+		size_t nIntact = 0;
+		for (size_t g = src.size(); g < restored.size(); ++g)
+			nIntact += restored[g] == 0xCD;
+		OHT_CHECK(nIntact == Guard);
+	}
+}
+
+OHT_TEST(RLEEncodesOddLengthsLikeTheScalarReference)
+{
+	srand(7);
+
+	// Every length up to several vector widths, so the scan leaves every possible tail
+	for (size_t n = 1; n <= 300; ++n)
+	{
+		checkRoundTrip(generate(n, 1 + n % 40));
+		checkRoundTrip(Bytes(n, static_cast< unsigned char > (n)));
+
+		Bytes alternating (n);
+		for (size_t i = 0; i < n; ++i)
+			alternating[i] = static_cast< unsigned char > (i & 1);
+		checkRoundTrip(alternating);
+	}
+
+	// Runs ending exactly at and around the end of the data
+	for (size_t nTail = 1; nTail <= 20; ++nTail)
+	{
+		Bytes src = generate(257, 7);
+		src.insert(src.end(), nTail, 0x55);
+		checkRoundTrip(src);
+	}
+
+	// Long runs need every byte of the run header
+	for (size_t n = 1000; n <= 300000; n *= 7)
+		checkRoundTrip(generate(n, 400));
+}
+
+OHT_TEST(RLEDecompressesArbitraryRanges)
+{
+	srand(11);
+
+	const size_t vIntervals[] = { 0, 1, 4, 64 };
+	for (size_t t = 0; t < sizeof(vIntervals) / sizeof(vIntervals[0]); ++t)
+		for (size_t trial = 0; trial < 20; ++trial)
+		{
+			const size_t n = 1 + rand() % 5000;
+			const Bytes src = generate(n, 1 + rand() % 100);
+			RLE::Channel channel (vIntervals[t]);
+
+			channel.compress(n, &src[0]);
+
+			for (size_t r = 0; r < 50; ++r)
+			{
+				const size_t 
+					nFirst = rand() % n,
+					nCount = 1 + rand() % (n - nFirst);
+				Bytes range (nCount);
+
+				channel.decompress(n, nFirst, nCount, &range[0]);
+				OHT_CHECK(std::equal(range.begin(), range.end(), src.begin() + nFirst));
+			}
+
+			// Single bytes at both ends and in between
+			OHT_CHECK(channel.at(n, 0) == src[0]);
+			OHT_CHECK(channel.at(n, n - 1) == src[n - 1]);
+			OHT_CHECK(channel.at(n, n / 2) == src[n / 2]);
+		}
+}
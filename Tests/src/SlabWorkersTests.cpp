@@ -0,0 +1,47 @@
+#include <SlabWorkers.h>
+
+#include <vector>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+
+OHT_TEST(SlabWorkersRunEverySlabOnce)
+{
+	SlabWorkers workers (3, 4);
+	boost::mutex mutex;
+
+	workers.occupy();
+	for (size_t nSlabs = 1; nSlabs <= 9; ++nSlabs)
+	{
+		std::vector< size_t > runs (nSlabs, 0);
+
+		workers.run(nSlabs, [&] (const size_t s)
+		{
+			boost::mutex::scoped_lock lock(mutex);
+			++runs[s];
+		});
+
+		for (size_t s = 0; s < nSlabs; ++s)
+			OHT_CHECK(runs[s] == 1);
+	}
+	workers.vacate();
+}
+
+OHT_TEST(SlabWorkersStayIdleAtTheConcurrencyLimit)
+{
+	SlabWorkers workers (2, 1);
+	const boost::thread::id idCaller = boost::this_thread::get_id();
+	size_t nForeign = 0;
+
+	// The calling builder already occupies the only slot, so it must run every slab itself
+	workers.occupy();
+	workers.run(8, [&] (const size_t s)
+	{
+		if (boost::this_thread::get_id() != idCaller)
+			++nForeign;
+	});
+	workers.vacate();
+
+	OHT_CHECK(nForeign == 0);
+}
@@ -0,0 +1,136 @@
+#include <OverhangTerrainPageInitParams.h>
+#include <MetaFactory.h>
+#include <MetaWorldFragment.h>
+#include <CubeDataRegion.h>
+#include <CubeDataRegionDescriptor.h>
+#include <HardwareIsoVertexShadow.h>
+#include <IsoSurfaceBuilder.h>
+#include <IsoSurfaceBuilderPool.h>
+#include <SurfaceNets.h>
+
+#include "TestHarness.h"
+
+using namespace Ogre::HardwareShadow;
+
+namespace
+{
+	/// Options of small pages of a single tile with three levels of detail, those from nNetsBegin onwards extracted with Surface Nets
+	OverhangTerrainOptions createOptions (const unsigned short nNetsBegin)
+	{
+		OverhangTerrainOptions options;
+
+		options.pageSize = options.tileSize = 17;
+		options.channels[TERRAIN_ENTITY_CHANNEL].maxGeoMipMapLevel = 3;
+		options.channels[TERRAIN_ENTITY_CHANNEL].surfaceNetsLODBegin = nNetsBegin;
+		options.channels[TERRAIN_ENTITY_CHANNEL].surfaceNetsLODEnd = 3;
+		return options;
+	}
+
+	/// A cube of the terrain channel solid beneath a horizontal plane just above the middle, no voxel is zero
+	MetaFragment::Container * createPlane (MetaBaseFactory & factory)
+	{
+		const Voxel::CubeDataRegionDescriptor & cubemeta = *factory.getCubeDataRegionDescriptor();
+		const Real fExtent = Real(cubemeta.dimensions) * cubemeta.scale;
+		MetaFragment::Container * pMF = factory.getVoxelFactory(TERRAIN_ENTITY_CHANNEL) ->createMetaFragment(
+			NULL,
+			AxisAlignedBox(Vector3(-fExtent / 2), Vector3(fExtent / 2))
+		);
+		Voxel::CubeDataRegion * pBlock = pMF->acquire< MetaFragment::Interfaces::Basic >().block;
+		Voxel::DataAccessor data = pBlock->lease();
+		const DimensionType d = cubemeta.dimensions;
+
+		for (DimensionType k = 0; k <= d; ++k)
+			for (DimensionType j = 0; j <= d; ++j)
+				for (DimensionType i = 0; i <= d; ++i)
+					data.values[cubemeta.getGridPointIndex(i, j, k)] = Voxel::FieldStrength(2 * signed int(j) - signed int(d) - 1);
+
+		data.touch(Voxel::DataBase::DBC_Values);
+		if (pBlock->hasGradient())
+			data.updateGradient();
+
+		return pMF;
+	}
+
+	/// Builds a configuration of the level of detail and batches it, returns the number of vertices in the hardware vertex buffer
+	size_t build (MetaBaseFactory & factory, const MetaFragment::Container * pMF, const SharedPtr< HardwareIsoVertexShadow > & pShadow, const unsigned nLOD, const Touch3DFlags enStitches)
+	{
+		factory.getIsoSurfaceBuilderPool()->lease()->queueBuild(pMF, pShadow, TERRAIN_ENTITY_CHANNEL, nLOD, pMF->factory->surfaceFlags, enStitches, factory.getCubeDataRegionDescriptor()->gpcount * 3);
+		{
+			HardwareIsoVertexShadow::ConsumerLock lock = pShadow->requestConsumerLock(nLOD, enStitches);
+
+			OHT_CHECK(lock);
+			if (lock)
+				lock.openQueue().consume();
+		}
+		return pShadow->requestReadOnlyAccess(nLOD).meshOp.nextVertexIndex();
+	}
+
+	/// Stitches the west side of the coarser level of detail, the seam adds the vertices the finer neighbour meets it at
+	void checkSeamAddsVertices (const unsigned short nNetsBegin)
+	{
+		MetaBaseFactory factory (NULL, createOptions(nNetsBegin), NULL);
+		MetaFragment::Container * pMF = createPlane(factory);
+		SharedPtr< HardwareIsoVertexShadow > pShadow (new HardwareIsoVertexShadow(3));
+		const size_t nUnstitched = build(factory, pMF, pShadow, 1, T3DS_None);
+
+		OHT_CHECK(nUnstitched > 0);
+		OHT_CHECK(build(factory, pMF, pShadow, 1, T3DS_West) > nUnstitched);
+
+		delete pMF;
+	}
+}
+
+OHT_TEST(SurfaceNetsSeamVisitsEveryCrossedEdgeOfTheSide)
+{
+	MetaBaseFactory factory (NULL, createOptions(0), NULL);
+	MetaFragment::Container * pMF = createPlane(factory);
+	const Voxel::CubeDataRegionDescriptor & cubemeta = *factory.getCubeDataRegionDescriptor();
+	const SurfaceNets nets (cubemeta);
+	const Voxel::const_DataAccessor data = pMF->acquire< MetaFragment::Interfaces::const_Basic >().block->lease();
+	size_t nEdges = 0, nVertical = 0, nAcross = 0;
+
+	// The plane crosses one vertical edge of every vertical line of the side
+	nets.seam(data.values, 1, 0, false, [&] (const SurfaceNets::Cell (& cells)[4], const DimensionType (& p)[3], const unsigned e, const bool bInside0)
+	{
+		unsigned nVirtual = 0;
+
+		for (unsigned c = 0; c < 4; ++c)
+			nVirtual += cells[c].x < 0 ? 1 : 0;
+
+		++nEdges;
+		nVertical += e == 1 ? 1 : 0;
+		nAcross += p[0] == 0 && nVirtual == 2 && bInside0 ? 1 : 0;
+	});
+
+	OHT_CHECK(nEdges == (cubemeta.dimensions >> 1) + 1);
+	OHT_CHECK(nVertical == nEdges);
+	OHT_CHECK(nAcross == nEdges);
+
+	delete pMF;
+}
+
+OHT_TEST(SurfaceNetsCoarsensCells)
+{
+	MetaBaseFactory factory (NULL, createOptions(0), NULL);
+	const SurfaceNets nets (*factory.getCubeDataRegionDescriptor());
+	const signed short n = static_cast< signed short > (factory.getCubeDataRegionDescriptor()->dimensions);
+	const SurfaceNets::Cell
+		real = { 5, 0, n - 1 },
+		beyond = { -1, n, 3 };
+	const SurfaceNets::Cell
+		coarseReal = nets.coarsen(0, real),
+		coarseBeyond = nets.coarsen(0, beyond);
+
+	OHT_CHECK(coarseReal.x == 2 && coarseReal.y == 0 && coarseReal.z == n / 2 - 1);
+	OHT_CHECK(coarseBeyond.x == -1 && coarseBeyond.y == n / 2 && coarseBeyond.z == 1);
+}
+
+OHT_TEST(SurfaceNetsSeamsMeetFinerSurfaceNets)
+{
+	checkSeamAddsVertices(0);
+}
+
+OHT_TEST(SurfaceNetsSeamsMeetFinerTransvoxel)
+{
+	checkSeamAddsVertices(1);
+}
@@ -0,0 +1,87 @@
+#include <VertexCacheOptimizer.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+
+namespace
+{
+	/// Triangle list of a regular grid of quads two triangles each, the quads of a row follow one another and rows follow one another
+	std::vector< HWVertexIndex > createGrid (const size_t nQuads)
+	{
+		std::vector< HWVertexIndex > vIndices;
+		const HWVertexIndex nRow = HWVertexIndex(nQuads + 1);
+
+		for (HWVertexIndex j = 0; j < nQuads; ++j)
+			for (HWVertexIndex i = 0; i < nQuads; ++i)
+			{
+				const HWVertexIndex v0 = j * nRow + i;
+				const HWVertexIndex triangles[6] = { v0, v0 + nRow, v0 + 1, v0 + 1, v0 + nRow, v0 + nRow + 1 };
+
+				vIndices.insert(vIndices.end(), triangles, triangles + 6);
+			}
+
+		return vIndices;
+	}
+
+	/// Shuffles the triangles of a triangle list by a fixed linear congruential sequence
+	void shuffleTriangles (std::vector< HWVertexIndex > & vIndices)
+	{
+		uint32 nSeed = 0x2545F491;
+
+		for (size_t t = vIndices.size() / 3; t > 1; --t)
+		{
+			nSeed = nSeed * 1664525 + 1013904223;
+			const size_t u = (nSeed >> 8) % t;
+
+			for (unsigned c = 0; c < 3; ++c)
+				std::swap(vIndices[(t - 1) * 3 + c], vIndices[u * 3 + c]);
+		}
+	}
+
+	/// Reorders the triangles of the list as optimized, checks that every triangle is emitted exactly once, and returns the ACMR of the result
+	Real optimize (const std::vector< HWVertexIndex > & vIndices)
+	{
+		const size_t nTriangles = vIndices.size() / 3;
+		VertexCacheOptimizer vco;
+		std::vector< size_t > vOrder, vSorted;
+		std::vector< HWVertexIndex > vReordered;
+
+		vco.optimize(&vIndices[0], nTriangles, *std::max_element(vIndices.begin(), vIndices.end()) + 1, vOrder);
+
+		vSorted = vOrder;
+		std::sort(vSorted.begin(), vSorted.end());
+		OHT_CHECK(vSorted.size() == nTriangles);
+		for (size_t t = 0; t < vSorted.size(); ++t)
+			OHT_CHECK(vSorted[t] == t);
+
+		for (std::vector< size_t >::const_iterator i = vOrder.begin(); i != vOrder.end(); ++i)
+			vReordered.insert(vReordered.end(), vIndices.begin() + *i * 3, vIndices.begin() + *i * 3 + 3);
+
+		return VertexCacheOptimizer::computeACMR(&vReordered[0], nTriangles);
+	}
+}
+
+OHT_TEST(VertexCacheOptimizerReducesACMROfRowMajorGrid)
+{
+	// Rows longer than the cache is large, every vertex of a row is transformed again for the row that follows it
+	const std::vector< HWVertexIndex > vIndices = createGrid(32);
+	const Real fBefore = VertexCacheOptimizer::computeACMR(&vIndices[0], vIndices.size() / 3);
+
+	OHT_CHECK(optimize(vIndices) < fBefore);
+}
+
+OHT_TEST(VertexCacheOptimizerReducesACMROfShuffledGrid)
+{
+	std::vector< HWVertexIndex > vIndices = createGrid(32);
+	shuffleTriangles(vIndices);
+
+	const Real fBefore = VertexCacheOptimizer::computeACMR(&vIndices[0], vIndices.size() / 3);
+	const Real fAfter = optimize(vIndices);
+
+	OHT_CHECK(fBefore > Real(2));
+	OHT_CHECK(fAfter < Real(1));
+}
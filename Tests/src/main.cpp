@@ -0,0 +1,66 @@
+#include <Ogre.h>
+#include <OgreDefaultHardwareBufferManager.h>
+
+#include <iostream>
+
+#include "TestHarness.h"
+
+using namespace Ogre;
+
+namespace
+{
+	/// Number of checks performed and failed respectively
+	size_t gnChecks = 0, gnFailures = 0;
+	/// The test currently running
+	const TestCase * gpCurrent = NULL;
+}
+
+TestCase::TestCase( const char * szName, const Function fn )
+	: name(szName), function(fn)
+{
+	getRegistry().push_back(this);
+}
+
+std::vector< TestCase * > & TestCase::getRegistry()
+{
+	static std::vector< TestCase * > registry;
+	return registry;
+}
+
+void check( const bool bPassed, const char * szExpression, const char * szFile, const int nLine )
+{
+	++gnChecks;
+	if (!bPassed)
+	{
+		++gnFailures;
+		std::cerr << szFile << '(' << nLine << "): " << gpCurrent->name << ": check failed: " << szExpression << std::endl;
+	}
+}
+
+int main (int argc, char * argv[])
+{
+	// Nothing here renders, the root provides logging and the default work queue, vertex declarations come from a software buffer manager
+	Root * pRoot = new Root(StringUtil::BLANK, StringUtil::BLANK, "Tests.log");
+	DefaultHardwareBufferManager * pBufMan = OGRE_NEW DefaultHardwareBufferManager();
+	size_t nTests = 0;
+
+	for (std::vector< TestCase * >::const_iterator i = TestCase::getRegistry().begin(); i != TestCase::getRegistry().end(); ++i, ++nTests)
+	{
+		gpCurrent = *i;
+		try
+		{
+			(*i)->function();
+		}
+		catch (const std::exception & e)
+		{
+			++gnFailures;
+			std::cerr << (*i)->name << ": unexpected exception: " << e.what() << std::endl;
+		}
+	}
+
+	std::cout << nTests << " tests, " << gnChecks << " checks, " << gnFailures << " failures" << std::endl;
+
+	OGRE_DELETE pBufMan;
+	delete pRoot;
+	return gnFailures > 0 ? 1 : 0;
+}